@@ -0,0 +1,1534 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      filter_bench.c
+*@brief     Micro-benchmark of filter handlers
+*@author    Ziga Miklosic
+*@date      17.10.2026
+*@version   V2.1.0
+*
+*@brief     Every handler is swept over order (taps, sections, channels),
+*           single and repeated instances and warm and cold cache. Each
+*           configuration is measured in repetitions and reported as
+*           median and percentiles of ns/sample, samples/s and
+*           cycles/sample, as table and optionally as JSON.
+*
+*           On Linux hardware performance counters (cycles, instructions,
+*           L1D and LLC read misses, branch misses, front-end and back-end
+*           stall cycles) are read with perf_event_open and reported per
+*           sample together with IPC. Counters that cannot be opened
+*           (permissions, virtual machine, PMU without such event) are
+*           reported as unavailable, with none of them benchmark falls back
+*           to timing only.
+*
+*           Build from root of "General Embedded C Libraries Ecosystem":
+*
+*           gcc -std=gnu11 -O2 -I. -Imiddleware/filter/src
+*               middleware/filter/bench/filter_bench.c
+*               middleware/filter/src/filter.c
+*               middleware/ring_buffer/src/ring_buffer.c -lm
+*
+*           Usage: filter_bench [--json <file>] [--reps <n>] [--kernel <name>]
+*                               [--gate <dir>] [--update] [--threshold <pct>]
+*                               [--no-counters]
+*
+*           Gate mode compares run against baseline stored in
+*           <dir>/filter_bench_<fingerprint>.json, where fingerprint is
+*           hash of CPU model, number of CPUs, compiler and ISA flags.
+*           Missing baseline is created from current run (--update
+*           overwrites it). Configuration is regressed when its median
+*           throughput dropped by more than threshold (default 10 %) and
+*           Mann-Whitney U test rejects equal distributions of repetition
+*           times (p < 0.01). Exit status is 2 on regression.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+
+#if defined( __x86_64__ ) || defined( __i386__ )
+    #include <x86intrin.h>
+#endif
+
+#if defined( __linux__ )
+    #include <errno.h>
+    #include <sys/syscall.h>
+    #include <linux/perf_event.h>
+#endif
+
+#include "filter.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Sampling frequency of benchmarked filters
+ */
+#define BENCH_FS                    ( 1000.0f )
+
+/**
+ *  Number of samples passed to handler per instance and call
+ */
+#define BENCH_BLOCK_SIZE            ( 256U )
+
+/**
+ *  Number of instances in repeated instances run
+ */
+#define BENCH_NUM_OF_INST           ( 256U )
+
+/**
+ *  Default number of repetitions per configuration
+ */
+#define BENCH_REPS_DEF              ( 31U )
+
+/**
+ *  Max. number of repetitions per configuration
+ */
+#define BENCH_REPS_MAX              ( 1001U )
+
+/**
+ *  Min. duration of warm repetition in ns
+ */
+#define BENCH_REP_TIME_MIN          ( 200000.0 )
+
+/**
+ *  Size of buffer written between cold cache repetitions, larger than
+ *  last level cache
+ */
+#define BENCH_EVICT_SIZE            ( 64U * 1024U * 1024U )
+
+/**
+ *  Max. number of measured configurations
+ */
+#define BENCH_NUM_OF_RES_MAX        ( 256U )
+
+/**
+ *  Default gate throughput drop threshold in %
+ */
+#define BENCH_GATE_THRESHOLD_DEF    ( 10.0 )
+
+/**
+ *  Gate significance level of Mann-Whitney U test
+ */
+#define BENCH_GATE_ALPHA            ( 0.01 )
+
+/**
+ *  Hardware performance counters
+ */
+typedef enum
+{
+    eBENCH_CNT_CYCLES = 0,      /**<Core cycles */
+    eBENCH_CNT_INSTR,           /**<Retired instructions */
+    eBENCH_CNT_L1D_MISS,        /**<L1 data cache read misses */
+    eBENCH_CNT_LLC_MISS,        /**<Last level cache read misses */
+    eBENCH_CNT_BRANCH_MISS,     /**<Mispredicted branches */
+    eBENCH_CNT_STALL_FE,        /**<Front-end stall cycles */
+    eBENCH_CNT_STALL_BE,        /**<Back-end stall cycles */
+
+    eBENCH_CNT_NUM_OF
+} bench_cnt_t;
+
+/**
+ *  Benchmarked instance
+ */
+typedef struct
+{
+    void      * p_filter;   /**<Filter instance */
+    void      * p_in;       /**<Kernel specific input (integer, packed) */
+    void      * p_out;      /**<Kernel specific output (integer, packed) */
+    uint32_t    param;      /**<Order, taps, sections or channels */
+} bench_inst_t;
+
+/**
+ *  Benchmarked kernel
+ */
+typedef struct
+{
+    const char    * p_name;                                                                                             /**<Handler name */
+    const char    * p_param;                                                                                            /**<Meaning of parameter */
+    uint32_t        param[4];                                                                                           /**<Swept parameter values, 0 terminates */
+    bool            param_is_ch;                                                                                        /**<Parameter is number of channels, samples are counted per channel */
+    void            (*pf_init)  (bench_inst_t * const p_inst);                                                          /**<Create instance */
+    void            (*pf_run)   (bench_inst_t * const p_inst, const float32_t * const p_in, float32_t * const p_out);   /**<Process BENCH_BLOCK_SIZE samples */
+} bench_kernel_t;
+
+/**
+ *  Benchmark result of configuration
+ */
+typedef struct
+{
+    char        kernel[32];     /**<Kernel name */
+    char        param[16];      /**<Meaning of parameter */
+    uint32_t    value;          /**<Parameter value */
+    uint32_t    num_of_inst;    /**<Number of instances */
+    bool        cold;           /**<Cold cache */
+    double    * p_ns;           /**<Sorted ns/sample of repetitions */
+    uint32_t    num_of_ns;      /**<Number of repetitions */
+    double      median;         /**<Median ns/sample */
+    double      min;            /**<Min. ns/sample */
+    double      p10;            /**<10th percentile ns/sample */
+    double      p90;            /**<90th percentile ns/sample */
+    double      p99;            /**<99th percentile ns/sample */
+    double      cycles;         /**<Median cycles/sample (time stamp counter), negative if unavailable */
+    double      cnt[eBENCH_CNT_NUM_OF]; /**<Hardware counter events per sample over all repetitions, negative if unavailable */
+} bench_res_t;
+
+/**
+ *  Machine fingerprint
+ */
+typedef struct
+{
+    char        cpu[128];       /**<CPU model */
+    uint32_t    num_of_cpu;     /**<Number of online CPUs */
+    char        compiler[64];   /**<Compiler version */
+    char        isa[64];        /**<Enabled ISA extensions and optimization */
+    uint64_t    key;            /**<Hash of all above */
+} bench_fprint_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static void bench_rc_init           (bench_inst_t * const p_inst);
+static void bench_rc_run            (bench_inst_t * const p_inst, const float32_t * const p_in, float32_t * const p_out);
+static void bench_rc_block_run      (bench_inst_t * const p_inst, const float32_t * const p_in, float32_t * const p_out);
+static void bench_cr_init           (bench_inst_t * const p_inst);
+static void bench_cr_run            (bench_inst_t * const p_inst, const float32_t * const p_in, float32_t * const p_out);
+static void bench_cr_block_run      (bench_inst_t * const p_inst, const float32_t * const p_in, float32_t * const p_out);
+static void bench_band_init         (bench_inst_t * const p_inst);
+static void bench_band_block_run    (bench_inst_t * const p_inst, const float32_t * const p_in, float32_t * const p_out);
+static void bench_fir_init          (bench_inst_t * const p_inst);
+static void bench_fir_run           (bench_inst_t * const p_inst, const float32_t * const p_in, float32_t * const p_out);
+static void bench_iir_init          (bench_inst_t * const p_inst);
+static void bench_iir_run           (bench_inst_t * const p_inst, const float32_t * const p_in, float32_t * const p_out);
+static void bench_sos_init          (bench_inst_t * const p_inst);
+static void bench_sos_block_run     (bench_inst_t * const p_inst, const float32_t * const p_in, float32_t * const p_out);
+static void bench_dcb_init          (bench_inst_t * const p_inst);
+static void bench_dcb_block_run     (bench_inst_t * const p_inst, const float32_t * const p_in, float32_t * const p_out);
+static void bench_dcb_bank_init     (bench_inst_t * const p_inst);
+static void bench_dcb_bank_run      (bench_inst_t * const p_inst, const float32_t * const p_in, float32_t * const p_out);
+static void bench_euro_init         (bench_inst_t * const p_inst);
+static void bench_euro_run          (bench_inst_t * const p_inst, const float32_t * const p_in, float32_t * const p_out);
+static void bench_bool_init         (bench_inst_t * const p_inst);
+static void bench_bool_run          (bench_inst_t * const p_inst, const float32_t * const p_in, float32_t * const p_out);
+static void bench_bool_packed_run   (bench_inst_t * const p_inst, const float32_t * const p_in, float32_t * const p_out);
+static void bench_pipe_init         (bench_inst_t * const p_inst);
+static void bench_pipe_run          (bench_inst_t * const p_inst, const float32_t * const p_in, float32_t * const p_out);
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Benchmarked kernels
+ */
+static const bench_kernel_t g_kernel[] =
+{
+    { .p_name = "rc_hndl",              .p_param = "order",     .param = { 1, 2, 4, 8 },        .pf_init = bench_rc_init,       .pf_run = bench_rc_run          },
+    { .p_name = "rc_hndl_block",        .p_param = "order",     .param = { 1, 2, 4, 8 },        .pf_init = bench_rc_init,       .pf_run = bench_rc_block_run    },
+    { .p_name = "cr_hndl",              .p_param = "order",     .param = { 1, 2, 4, 8 },        .pf_init = bench_cr_init,       .pf_run = bench_cr_run          },
+    { .p_name = "cr_hndl_block",        .p_param = "order",     .param = { 1, 2, 4, 8 },        .pf_init = bench_cr_init,       .pf_run = bench_cr_block_run    },
+    { .p_name = "band_hndl_block",      .p_param = "order",     .param = { 1, 2, 4 },           .pf_init = bench_band_init,     .pf_run = bench_band_block_run  },
+    { .p_name = "fir_hndl",             .p_param = "taps",      .param = { 8, 32, 128, 512 },   .pf_init = bench_fir_init,      .pf_run = bench_fir_run         },
+    { .p_name = "iir_hndl",             .p_param = "order",     .param = { 1, 2, 4, 8 },        .pf_init = bench_iir_init,      .pf_run = bench_iir_run         },
+    { .p_name = "sos_hndl_block",       .p_param = "sections",  .param = { 1, 2, 4, 8 },        .pf_init = bench_sos_init,      .pf_run = bench_sos_block_run   },
+    { .p_name = "dcb_hndl_block",       .p_param = "order",     .param = { 1 },                 .pf_init = bench_dcb_init,      .pf_run = bench_dcb_block_run   },
+    { .p_name = "dcb_bank_hndl_block",  .p_param = "channels",  .param = { 8, 64, 256 },        .pf_init = bench_dcb_bank_init, .pf_run = bench_dcb_bank_run,   .param_is_ch = true },
+    { .p_name = "euro_hndl",            .p_param = "order",     .param = { 1 },                 .pf_init = bench_euro_init,     .pf_run = bench_euro_run        },
+    { .p_name = "bool_hndl",            .p_param = "order",     .param = { 1 },                 .pf_init = bench_bool_init,     .pf_run = bench_bool_run        },
+    { .p_name = "bool_hndl_packed",     .p_param = "order",     .param = { 1 },                 .pf_init = bench_bool_init,     .pf_run = bench_bool_packed_run },
+    { .p_name = "pipe_hndl_block",      .p_param = "stages",    .param = { 3 },                 .pf_init = bench_pipe_init,     .pf_run = bench_pipe_run        },
+};
+
+/**
+ *  Number of benchmarked kernels
+ */
+#define BENCH_NUM_OF_KERNELS        ( sizeof( g_kernel ) / sizeof( g_kernel[0] ))
+
+/**
+ *  Input and output samples
+ */
+static float32_t g_in[BENCH_BLOCK_SIZE];
+static float32_t g_out[BENCH_BLOCK_SIZE];
+
+/**
+ *  Cache eviction buffer
+ */
+static volatile uint8_t * gp_evict = NULL;
+
+/**
+ *  Hardware counter names and file descriptors (-1 if unavailable)
+ */
+static const char * const gp_cnt_name[eBENCH_CNT_NUM_OF] = { "cycles", "instructions", "l1d_misses", "llc_misses", "branch_misses", "stalled_cycles_frontend", "stalled_cycles_backend" };
+static int g_cnt_fd[eBENCH_CNT_NUM_OF] = { -1, -1, -1, -1, -1, -1, -1 };
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get monotonic time
+*
+* @return       time - Time in ns
+*/
+////////////////////////////////////////////////////////////////////////////////
+static double bench_time_ns(void)
+{
+    struct timespec ts;
+
+    (void) clock_gettime( CLOCK_MONOTONIC, &ts );
+
+    return (( (double) ts.tv_sec * 1e9 ) + (double) ts.tv_nsec );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get time stamp counter
+*
+* @note     Time stamp counter runs at constant (reference) frequency, it
+*           equals core cycles only when core runs at that frequency.
+*
+* @return       cycles - Counter value, 0 if unavailable
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint64_t bench_cycles(void)
+{
+    #if defined( __x86_64__ ) || defined( __i386__ )
+        return __rdtsc();
+    #else
+        return 0U;
+    #endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Open hardware performance counters
+*
+* @brief    Every counter is opened as its own event, so unsupported
+*           events do not disable the others. Only user space of calling
+*           thread is counted, which is permitted with default
+*           perf_event_paranoid level. When counters exceed number of PMU
+*           registers kernel multiplexes them and readings are scaled.
+*
+* @return       num - Number of opened counters
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t bench_cnt_open(void)
+{
+    uint32_t num = 0U;
+
+    #if defined( __linux__ )
+
+        static const struct { uint32_t type; uint64_t config; } cnt[eBENCH_CNT_NUM_OF] =
+        {
+            [eBENCH_CNT_CYCLES]         = { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+            [eBENCH_CNT_INSTR]          = { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+            [eBENCH_CNT_L1D_MISS]       = { PERF_TYPE_HW_CACHE, ( PERF_COUNT_HW_CACHE_L1D | ( PERF_COUNT_HW_CACHE_OP_READ << 8 ) | ( PERF_COUNT_HW_CACHE_RESULT_MISS << 16 )) },
+            [eBENCH_CNT_LLC_MISS]       = { PERF_TYPE_HW_CACHE, ( PERF_COUNT_HW_CACHE_LL | ( PERF_COUNT_HW_CACHE_OP_READ << 8 ) | ( PERF_COUNT_HW_CACHE_RESULT_MISS << 16 )) },
+            [eBENCH_CNT_BRANCH_MISS]    = { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+            [eBENCH_CNT_STALL_FE]       = { PERF_TYPE_HARDWARE, PERF_COUNT_HW_STALLED_CYCLES_FRONTEND },
+            [eBENCH_CNT_STALL_BE]       = { PERF_TYPE_HARDWARE, PERF_COUNT_HW_STALLED_CYCLES_BACKEND },
+        };
+        int err = 0;
+
+        for ( uint32_t c = 0U; c < eBENCH_CNT_NUM_OF; c++ )
+        {
+            struct perf_event_attr attr;
+
+            memset( &attr, 0, sizeof( attr ));
+
+            attr.size           = sizeof( attr );
+            attr.type           = cnt[c].type;
+            attr.config         = cnt[c].config;
+            attr.read_format    = ( PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING );
+            attr.exclude_kernel = 1;
+            attr.exclude_hv     = 1;
+
+            g_cnt_fd[c] = (int) syscall( SYS_perf_event_open, &attr, 0, -1, -1, 0 );
+
+            if ( g_cnt_fd[c] >= 0 )
+            {
+                num++;
+            }
+            else if ( 0 == err )
+            {
+                err = errno;
+            }
+            else
+            {
+                // Report first failure only
+            }
+        }
+
+        if ( 0U == num )
+        {
+            printf( "Hardware counters unavailable (%s), timing only\n\n", strerror( err ));
+        }
+        else if ( num < eBENCH_CNT_NUM_OF )
+        {
+            printf( "Hardware counters: %u of %u available\n\n", num, (uint32_t) eBENCH_CNT_NUM_OF );
+        }
+        else
+        {
+            // All available
+        }
+
+    #else
+        printf( "Hardware counters not supported on this platform, timing only\n\n" );
+    #endif
+
+    return num;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Read hardware performance counters
+*
+* @param[out]   p_val   - Value, time enabled and time running per counter
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void bench_cnt_read(uint64_t (* const p_val)[3])
+{
+    for ( uint32_t c = 0U; c < eBENCH_CNT_NUM_OF; c++ )
+    {
+        p_val[c][0] = 0U;
+        p_val[c][1] = 0U;
+        p_val[c][2] = 0U;
+
+        if  (   ( g_cnt_fd[c] >= 0 )
+            &&  ( sizeof( p_val[c] ) != read( g_cnt_fd[c], p_val[c], sizeof( p_val[c] ))))
+        {
+            p_val[c][2] = 0U;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Evict caches by writing large buffer
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void bench_evict(void)
+{
+    for ( uint32_t i = 0U; i < BENCH_EVICT_SIZE; i += 64U )
+    {
+        gp_evict[i] = (uint8_t) ( gp_evict[i] + 1U );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Compare doubles for qsort
+*
+* @param[in]    p_a     - First value
+* @param[in]    p_b     - Second value
+* @return       order   - -1, 0 or 1
+*/
+////////////////////////////////////////////////////////////////////////////////
+static int bench_cmp(const void * p_a, const void * p_b)
+{
+    const double a = *(const double*) p_a;
+    const double b = *(const double*) p_b;
+
+    return (( a > b ) - ( a < b ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get percentile of sorted values (nearest rank)
+*
+* @param[in]    p_val   - Sorted values
+* @param[in]    num     - Number of values
+* @param[in]    p       - Percentile, 0 - 100
+* @return       val     - Percentile value
+*/
+////////////////////////////////////////////////////////////////////////////////
+static double bench_percentile(const double * const p_val, const uint32_t num, const double p)
+{
+    uint32_t idx = (uint32_t) ceil(( p / 100.0 ) * (double) num );
+
+    idx = (( idx > 0U ) ? ( idx - 1U ) : 0U );
+    idx = (( idx < num ) ? idx : ( num - 1U ));
+
+    return p_val[idx];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Measure kernel configuration
+*
+* @brief    Warm repetition runs handler as many times as needed to last at
+*           least BENCH_REP_TIME_MIN after untimed warm-up. Cold repetition
+*           runs handler once per instance after caches are evicted.
+*
+* @param[in]    p_kernel    - Kernel
+* @param[in]    p_inst      - Instances
+* @param[in]    num_of_inst - Number of instances
+* @param[in]    cold        - Evict caches before each repetition
+* @param[in]    reps        - Number of repetitions
+* @return       res         - Result
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bench_res_t bench_measure(const bench_kernel_t * const p_kernel, bench_inst_t * const p_inst, const uint32_t num_of_inst, const bool cold, const uint32_t reps)
+{
+    static double   ns[BENCH_REPS_MAX];
+    static double   cyc[BENCH_REPS_MAX];
+    bench_res_t     res         = { 0 };
+    uint64_t        cnt_0[eBENCH_CNT_NUM_OF][3];
+    uint64_t        cnt_1[eBENCH_CNT_NUM_OF][3];
+    double          cnt[eBENCH_CNT_NUM_OF]  = { 0 };
+    bool            cnt_ok[eBENCH_CNT_NUM_OF];
+    uint32_t        iters       = 1U;
+    const double    samples     = ( (double) BENCH_BLOCK_SIZE * (double) num_of_inst * ( p_kernel->param_is_ch ? (double) p_inst[0].param : 1.0 ));
+
+    for ( uint32_t c = 0U; c < eBENCH_CNT_NUM_OF; c++ )
+    {
+        cnt_ok[c] = true;
+    }
+
+    // Warm-up and calibration
+    if ( false == cold )
+    {
+        double t = 0.0;
+
+        do
+        {
+            const double t0 = bench_time_ns();
+
+            for ( uint32_t it = 0U; it < iters; it++ )
+            {
+                for ( uint32_t i = 0U; i < num_of_inst; i++ )
+                {
+                    p_kernel->pf_run( &p_inst[i], g_in, g_out );
+                }
+            }
+
+            t = ( bench_time_ns() - t0 );
+
+            if ( t < BENCH_REP_TIME_MIN )
+            {
+                iters *= 2U;
+            }
+        } while ( t < BENCH_REP_TIME_MIN );
+    }
+
+    for ( uint32_t r = 0U; r < reps; r++ )
+    {
+        double      t0;
+        uint64_t    c0;
+
+        if ( true == cold )
+        {
+            bench_evict();
+        }
+
+        // Counters are read outside of timed region
+        bench_cnt_read( cnt_0 );
+
+        t0 = bench_time_ns();
+        c0 = bench_cycles();
+
+        for ( uint32_t it = 0U; it < iters; it++ )
+        {
+            for ( uint32_t i = 0U; i < num_of_inst; i++ )
+            {
+                p_kernel->pf_run( &p_inst[i], g_in, g_out );
+            }
+        }
+
+        cyc[r]  = ( (double) ( bench_cycles() - c0 ) / ( samples * (double) iters ));
+        ns[r]   = (( bench_time_ns() - t0 ) / ( samples * (double) iters ));
+
+        bench_cnt_read( cnt_1 );
+
+        for ( uint32_t c = 0U; c < eBENCH_CNT_NUM_OF; c++ )
+        {
+            const uint64_t enabled = ( cnt_1[c][1] - cnt_0[c][1] );
+            const uint64_t running = ( cnt_1[c][2] - cnt_0[c][2] );
+
+            // Counter is not open or was not scheduled in repetition
+            if ( 0U == running )
+            {
+                cnt_ok[c] = false;
+                continue;
+            }
+
+            cnt[c] += ( (double) ( cnt_1[c][0] - cnt_0[c][0] ) * ( (double) enabled / (double) running ));
+        }
+    }
+
+    for ( uint32_t c = 0U; c < eBENCH_CNT_NUM_OF; c++ )
+    {
+        res.cnt[c] = (( true == cnt_ok[c] ) ? ( cnt[c] / ( samples * (double) iters * (double) reps )) : -1.0 );
+    }
+
+    qsort( ns, reps, sizeof( double ), bench_cmp );
+    qsort( cyc, reps, sizeof( double ), bench_cmp );
+
+    res.p_ns        = malloc( reps * sizeof( double ));
+    res.num_of_ns   = (( NULL != res.p_ns ) ? reps : 0U );
+
+    if ( NULL != res.p_ns )
+    {
+        memcpy( res.p_ns, ns, reps * sizeof( double ));
+    }
+
+    res.median  = bench_percentile( ns, reps, 50.0 );
+    res.min     = ns[0];
+    res.p10     = bench_percentile( ns, reps, 10.0 );
+    res.p90     = bench_percentile( ns, reps, 90.0 );
+    res.p99     = bench_percentile( ns, reps, 99.0 );
+    res.cycles  = (( cyc[ reps - 1U ] > 0.0 ) ? bench_percentile( cyc, reps, 50.0 ) : -1.0 );
+
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Copy string into JSON string without quotes and backslashes
+*
+* @param[out]   p_dst   - Destination
+* @param[in]    size    - Size of destination
+* @param[in]    p_src   - Source
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void bench_str_copy(char * const p_dst, const size_t size, const char * const p_src)
+{
+    size_t i = 0U;
+
+    for ( ; ( i < ( size - 1U )) && ( '\0' != p_src[i] ) && ( '\n' != p_src[i] ); i++ )
+    {
+        p_dst[i] = ((( '"' == p_src[i] ) || ( '\\' == p_src[i] )) ? ' ' : p_src[i] );
+    }
+
+    p_dst[i] = '\0';
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get machine fingerprint
+*
+* @return       fprint - Fingerprint
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bench_fprint_t bench_fprint_get(void)
+{
+    bench_fprint_t  fprint  = { .cpu = "unknown" };
+    FILE          * p_file  = fopen( "/proc/cpuinfo", "r" );
+    char            line[256];
+    char            key[512];
+
+    if ( NULL != p_file )
+    {
+        while ( NULL != fgets( line, sizeof( line ), p_file ))
+        {
+            const char * const p_val = strchr( line, ':' );
+
+            if  (   ( 0 == strncmp( line, "model name", 10U ))
+                &&  ( NULL != p_val ))
+            {
+                bench_str_copy( fprint.cpu, sizeof( fprint.cpu ), ( p_val + 2 ));
+                break;
+            }
+        }
+
+        fclose( p_file );
+    }
+
+    fprint.num_of_cpu = (uint32_t) sysconf( _SC_NPROCESSORS_ONLN );
+
+    #if defined( __VERSION__ )
+        bench_str_copy( fprint.compiler, sizeof( fprint.compiler ), __VERSION__ );
+    #endif
+
+    (void) snprintf( fprint.isa, sizeof( fprint.isa ), "%s%s%s%s",
+    #if defined( __OPTIMIZE__ )
+        "opt",
+    #else
+        "noopt",
+    #endif
+    #if defined( __AVX2__ )
+        " avx2",
+    #else
+        "",
+    #endif
+    #if defined( __AVX512F__ )
+        " avx512f",
+    #else
+        "",
+    #endif
+    #if defined( __FAST_MATH__ )
+        " fast-math"
+    #else
+        ""
+    #endif
+    );
+
+    // FNV-1a
+    (void) snprintf( key, sizeof( key ), "%s|%u|%s|%s", fprint.cpu, fprint.num_of_cpu, fprint.compiler, fprint.isa );
+
+    fprint.key = 14695981039346656037ULL;
+
+    for ( const char * p_c = key; '\0' != *p_c; p_c++ )
+    {
+        fprint.key = (( fprint.key ^ (uint8_t) *p_c ) * 1099511628211ULL );
+    }
+
+    return fprint;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Print hardware counter columns of result
+*
+* @param[in]    p_r     - Result, NULL prints header
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void bench_cnt_print(const bench_res_t * const p_r)
+{
+    char col[eBENCH_CNT_NUM_OF + 1U][16];
+
+    if ( NULL == p_r )
+    {
+        printf( " %6s %9s %9s %9s %9s %7s %7s", "IPC", "instr/smp", "L1D/smp", "LLC/smp", "brmis/smp", "fe st %", "be st %" );
+        return;
+    }
+
+    for ( uint32_t c = 0U; c < ( eBENCH_CNT_NUM_OF + 1U ); c++ )
+    {
+        (void) snprintf( col[c], sizeof( col[c] ), "-" );
+    }
+
+    if  (   ( p_r->cnt[eBENCH_CNT_CYCLES] > 0.0 )
+        &&  ( p_r->cnt[eBENCH_CNT_INSTR] >= 0.0 ))
+    {
+        (void) snprintf( col[0], sizeof( col[0] ), "%.2f", ( p_r->cnt[eBENCH_CNT_INSTR] / p_r->cnt[eBENCH_CNT_CYCLES] ));
+    }
+
+    for ( uint32_t c = eBENCH_CNT_INSTR; c <= eBENCH_CNT_BRANCH_MISS; c++ )
+    {
+        if ( p_r->cnt[c] >= 0.0 )
+        {
+            (void) snprintf( col[c], sizeof( col[c] ), "%.3g", p_r->cnt[c] );
+        }
+    }
+
+    // Stalls as share of cycles
+    for ( uint32_t c = eBENCH_CNT_STALL_FE; c <= eBENCH_CNT_STALL_BE; c++ )
+    {
+        if  (   ( p_r->cnt[c] >= 0.0 )
+            &&  ( p_r->cnt[eBENCH_CNT_CYCLES] > 0.0 ))
+        {
+            (void) snprintf( col[c], sizeof( col[c] ), "%.1f", ( 100.0 * p_r->cnt[c] / p_r->cnt[eBENCH_CNT_CYCLES] ));
+        }
+    }
+
+    printf( " %6s %9s %9s %9s %9s %7s %7s", col[0], col[eBENCH_CNT_INSTR], col[eBENCH_CNT_L1D_MISS], col[eBENCH_CNT_LLC_MISS],
+            col[eBENCH_CNT_BRANCH_MISS], col[eBENCH_CNT_STALL_FE], col[eBENCH_CNT_STALL_BE] );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Write results as JSON
+*
+* @note     Every result is written in single line, as baseline reader
+*           expects it.
+*
+* @param[in]    p_path      - File path
+* @param[in]    p_fprint    - Machine fingerprint
+* @param[in]    p_res       - Results
+* @param[in]    num_of_res  - Number of results
+* @param[in]    reps        - Number of repetitions
+* @return       status      - true on success
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool bench_json_write(const char * const p_path, const bench_fprint_t * const p_fprint, const bench_res_t * const p_res, const uint32_t num_of_res, const uint32_t reps)
+{
+    FILE * const p_json = fopen( p_path, "w" );
+
+    if ( NULL == p_json )
+    {
+        fprintf( stderr, "Cannot open %s\n", p_path );
+        return false;
+    }
+
+    fprintf( p_json, "{\n  \"fingerprint\": {\"key\": \"%016llx\", \"cpu\": \"%s\", \"cpus\": %u, \"compiler\": \"%s\", \"isa\": \"%s\"},\n",
+             (unsigned long long) p_fprint->key, p_fprint->cpu, p_fprint->num_of_cpu, p_fprint->compiler, p_fprint->isa );
+    fprintf( p_json, "  \"block_size\": %u,\n  \"reps\": %u,\n  \"results\": [\n", BENCH_BLOCK_SIZE, reps );
+
+    for ( uint32_t r = 0U; r < num_of_res; r++ )
+    {
+        const bench_res_t * const p_r = &p_res[r];
+
+        fprintf( p_json, "    {\"kernel\": \"%s\", \"param\": \"%s\", \"value\": %u, \"instances\": %u, \"cache\": \"%s\", "
+                         "\"ns_per_sample\": {\"median\": %.4f, \"min\": %.4f, \"p10\": %.4f, \"p90\": %.4f, \"p99\": %.4f}, "
+                         "\"samples_per_s\": %.6g, \"cycles_per_sample\": ",
+                 p_r->kernel, p_r->param, p_r->value, p_r->num_of_inst, ( p_r->cold ? "cold" : "warm" ),
+                 p_r->median, p_r->min, p_r->p10, p_r->p90, p_r->p99, ( 1e9 / p_r->median ));
+
+        if ( p_r->cycles >= 0.0 )
+        {
+            fprintf( p_json, "%.4f", p_r->cycles );
+        }
+        else
+        {
+            fprintf( p_json, "null" );
+        }
+
+        // Hardware counter events per sample
+        fprintf( p_json, ", \"counters\": {" );
+
+        for ( uint32_t c = 0U; c < eBENCH_CNT_NUM_OF; c++ )
+        {
+            if ( p_r->cnt[c] >= 0.0 )
+            {
+                fprintf( p_json, "\"%s\": %.6g, ", gp_cnt_name[c], p_r->cnt[c] );
+            }
+            else
+            {
+                fprintf( p_json, "\"%s\": null, ", gp_cnt_name[c] );
+            }
+        }
+
+        if  (   ( p_r->cnt[eBENCH_CNT_CYCLES] > 0.0 )
+            &&  ( p_r->cnt[eBENCH_CNT_INSTR] >= 0.0 ))
+        {
+            fprintf( p_json, "\"ipc\": %.4f}", ( p_r->cnt[eBENCH_CNT_INSTR] / p_r->cnt[eBENCH_CNT_CYCLES] ));
+        }
+        else
+        {
+            fprintf( p_json, "\"ipc\": null}" );
+        }
+
+        fprintf( p_json, ", \"ns\": [" );
+
+        for ( uint32_t n = 0U; n < p_r->num_of_ns; n++ )
+        {
+            fprintf( p_json, "%s%.4f", (( 0U == n ) ? "" : ", " ), p_r->p_ns[n] );
+        }
+
+        fprintf( p_json, "]}%s\n", ((( r + 1U ) < num_of_res ) ? "," : "" ));
+    }
+
+    fprintf( p_json, "  ]\n}\n" );
+    fclose( p_json );
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Read results from JSON written by bench_json_write
+*
+* @param[in]    p_path      - File path
+* @param[out]   p_res       - Results
+* @param[in]    size        - Max. number of results
+* @return       num_of_res  - Number of read results, negative if file cannot be opened
+*/
+////////////////////////////////////////////////////////////////////////////////
+static int32_t bench_json_read(const char * const p_path, bench_res_t * const p_res, const uint32_t size)
+{
+    FILE      * p_json  = fopen( p_path, "r" );
+    char      * p_line  = NULL;
+    size_t      len     = 0U;
+    uint32_t    num     = 0U;
+
+    if ( NULL == p_json )
+    {
+        return -1;
+    }
+
+    while  (   ( num < size )
+           &&  ( getline( &p_line, &len, p_json ) > 0 ))
+    {
+        bench_res_t * const p_r         = &p_res[num];
+        const char  *       p_kernel    = strstr( p_line, "\"kernel\": \"" );
+        const char  *       p_value     = strstr( p_line, "\"value\": " );
+        const char  *       p_inst      = strstr( p_line, "\"instances\": " );
+        const char  *       p_cache     = strstr( p_line, "\"cache\": \"" );
+        const char  *       p_ns        = strstr( p_line, "\"ns\": [" );
+
+        if  (   ( NULL == p_kernel )
+            ||  ( NULL == p_value )
+            ||  ( NULL == p_inst )
+            ||  ( NULL == p_cache )
+            ||  ( NULL == p_ns ))
+        {
+            continue;
+        }
+
+        memset( p_r, 0, sizeof( bench_res_t ));
+
+        (void) sscanf( p_kernel, "\"kernel\": \"%31[^\"]", p_r->kernel );
+        p_r->value          = (uint32_t) strtoul( p_value + 9, NULL, 10 );
+        p_r->num_of_inst    = (uint32_t) strtoul( p_inst + 13, NULL, 10 );
+        p_r->cold           = ( 0 == strncmp( p_cache + 10, "cold", 4U ));
+        p_r->p_ns           = malloc( BENCH_REPS_MAX * sizeof( double ));
+
+        if ( NULL == p_r->p_ns )
+        {
+            break;
+        }
+
+        // Repetitions
+        for ( char * p_c = (char*) ( p_ns + 7 ); ( ']' != *p_c ) && ( p_r->num_of_ns < BENCH_REPS_MAX ); )
+        {
+            char * p_end = NULL;
+
+            p_r->p_ns[ p_r->num_of_ns ] = strtod( p_c, &p_end );
+
+            if ( p_end == p_c )
+            {
+                break;
+            }
+
+            p_r->num_of_ns++;
+            p_c = (( ',' == *p_end ) ? ( p_end + 1 ) : p_end );
+        }
+
+        if ( p_r->num_of_ns > 0U )
+        {
+            qsort( p_r->p_ns, p_r->num_of_ns, sizeof( double ), bench_cmp );
+            p_r->median = bench_percentile( p_r->p_ns, p_r->num_of_ns, 50.0 );
+            num++;
+        }
+        else
+        {
+            free( p_r->p_ns );
+        }
+    }
+
+    free( p_line );
+    fclose( p_json );
+
+    return (int32_t) num;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Mann-Whitney U test
+*
+* @brief    Two sided, normal approximation with tie correction and
+*           continuity correction.
+*
+* @param[in]    p_a     - First sample
+* @param[in]    num_a   - Size of first sample
+* @param[in]    p_b     - Second sample
+* @param[in]    num_b   - Size of second sample
+* @return       p       - p-value of equal distributions
+*/
+////////////////////////////////////////////////////////////////////////////////
+static double bench_mann_whitney(const double * const p_a, const uint32_t num_a, const double * const p_b, const uint32_t num_b)
+{
+    const uint32_t  num     = ( num_a + num_b );
+    double        * p_all   = malloc( num * sizeof( double ));
+    double          rank_a  = 0.0;
+    double          ties    = 0.0;
+    double          u;
+    double          mu;
+    double          sigma;
+    uint32_t        i       = 0U;
+
+    if  (   ( NULL == p_all )
+        ||  ( 0U == num_a )
+        ||  ( 0U == num_b ))
+    {
+        free( p_all );
+        return 1.0;
+    }
+
+    memcpy( p_all, p_a, num_a * sizeof( double ));
+    memcpy( &p_all[num_a], p_b, num_b * sizeof( double ));
+    qsort( p_all, num, sizeof( double ), bench_cmp );
+
+    // Sum of ranks of first sample, ties get average rank
+    while ( i < num )
+    {
+        uint32_t    j       = i;
+        uint32_t    cnt_a   = 0U;
+
+        while (( j < num ) && ( p_all[j] == p_all[i] ))
+        {
+            j++;
+        }
+
+        for ( uint32_t k = 0U; k < num_a; k++ )
+        {
+            cnt_a += ( p_a[k] == p_all[i] );
+        }
+
+        rank_a  += ( cnt_a * ((( i + 1U ) + j ) / 2.0 ));
+        ties    += ( pow((double) ( j - i ), 3.0 ) - (double) ( j - i ));
+        i = j;
+    }
+
+    free( p_all );
+
+    u       = ( rank_a - (( num_a * ( num_a + 1.0 )) / 2.0 ));
+    mu      = (( (double) num_a * num_b ) / 2.0 );
+    sigma   = sqrt((( (double) num_a * num_b ) / 12.0 ) * (( num + 1.0 ) - ( ties / ( (double) num * ( num - 1.0 )))));
+
+    if ( sigma <= 0.0 )
+    {
+        return 1.0;
+    }
+
+    return erfc( fmax( 0.0, ( fabs( u - mu ) - 0.5 )) / ( sigma * sqrt( 2.0 )));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Compare results against baseline
+*
+* @param[in]    p_base      - Baseline results
+* @param[in]    num_of_base - Number of baseline results
+* @param[in]    p_res       - Current results
+* @param[in]    num_of_res  - Number of current results
+* @param[in]    threshold   - Max. throughput drop in %
+* @return       num         - Number of regressed configurations
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t bench_gate(const bench_res_t * const p_base, const uint32_t num_of_base, const bench_res_t * const p_res, const uint32_t num_of_res, const double threshold)
+{
+    uint32_t num_of_reg = 0U;
+
+    printf( "\n%-20s %5s %5s %5s %12s %12s %9s %9s  %s\n", "kernel", "value", "inst", "cache", "base ns", "current ns", "thrpt %", "p", "status" );
+
+    for ( uint32_t r = 0U; r < num_of_res; r++ )
+    {
+        const bench_res_t * const   p_r     = &p_res[r];
+        const bench_res_t *         p_b     = NULL;
+        const char *                p_sts   = "ok";
+        double                      delta   = 0.0;
+        double                      p       = 1.0;
+
+        for ( uint32_t b = 0U; ( b < num_of_base ) && ( NULL == p_b ); b++ )
+        {
+            if  (   ( 0 == strcmp( p_base[b].kernel, p_r->kernel ))
+                &&  ( p_base[b].value == p_r->value )
+                &&  ( p_base[b].num_of_inst == p_r->num_of_inst )
+                &&  ( p_base[b].cold == p_r->cold ))
+            {
+                p_b = &p_base[b];
+            }
+        }
+
+        if ( NULL == p_b )
+        {
+            printf( "%-20s %5u %5u %5s %12s %12.3f %9s %9s  %s\n", p_r->kernel, p_r->value, p_r->num_of_inst, ( p_r->cold ? "cold" : "warm" ), "-", p_r->median, "-", "-", "new" );
+            continue;
+        }
+
+        // Throughput change, negative is slower
+        delta   = ((( p_b->median / p_r->median ) - 1.0 ) * 100.0 );
+        p       = bench_mann_whitney( p_b->p_ns, p_b->num_of_ns, p_r->p_ns, p_r->num_of_ns );
+
+        if ( p < BENCH_GATE_ALPHA )
+        {
+            if ( delta < -threshold )
+            {
+                p_sts = "REGRESSED";
+                num_of_reg++;
+            }
+            else if ( delta > threshold )
+            {
+                p_sts = "improved";
+            }
+            else
+            {
+                // Significant, but within threshold
+            }
+        }
+
+        printf( "%-20s %5u %5u %5s %12.3f %12.3f %+9.2f %9.2g  %s\n", p_r->kernel, p_r->value, p_r->num_of_inst, ( p_r->cold ? "cold" : "warm" ), p_b->median, p_r->median, delta, p, p_sts );
+    }
+
+    return num_of_reg;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Run benchmark
+*
+* @param[in]    argc    - Number of arguments
+* @param[in]    argv    - Arguments
+* @return       status  - 0 on success, 1 on error, 2 on regression
+*/
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char ** argv)
+{
+    const char    * p_json_path = NULL;
+    const char    * p_only      = NULL;
+    const char    * p_gate_dir  = NULL;
+    bool            update      = false;
+    bool            counters    = true;
+    uint32_t        num_of_cnt  = 0U;
+    double          threshold   = BENCH_GATE_THRESHOLD_DEF;
+    uint32_t        reps        = BENCH_REPS_DEF;
+    bench_inst_t  * p_inst      = NULL;
+    bench_res_t   * p_res       = NULL;
+    uint32_t        num_of_res  = 0U;
+    bench_fprint_t  fprint;
+
+    for ( int a = 1; a < argc; a++ )
+    {
+        if  (   ( 0 == strcmp( argv[a], "--json" ))
+            &&  (( a + 1 ) < argc ))
+        {
+            p_json_path = argv[++a];
+        }
+        else if (   ( 0 == strcmp( argv[a], "--reps" ))
+                &&  (( a + 1 ) < argc ))
+        {
+            reps = (uint32_t) strtoul( argv[++a], NULL, 10 );
+            reps = (( reps < 1U ) ? 1U : (( reps > BENCH_REPS_MAX ) ? BENCH_REPS_MAX : reps ));
+        }
+        else if (   ( 0 == strcmp( argv[a], "--kernel" ))
+                &&  (( a + 1 ) < argc ))
+        {
+            p_only = argv[++a];
+        }
+        else if (   ( 0 == strcmp( argv[a], "--gate" ))
+                &&  (( a + 1 ) < argc ))
+        {
+            p_gate_dir = argv[++a];
+        }
+        else if ( 0 == strcmp( argv[a], "--update" ))
+        {
+            update = true;
+        }
+        else if ( 0 == strcmp( argv[a], "--no-counters" ))
+        {
+            counters = false;
+        }
+        else if (   ( 0 == strcmp( argv[a], "--threshold" ))
+                &&  (( a + 1 ) < argc ))
+        {
+            threshold = strtod( argv[++a], NULL );
+        }
+        else
+        {
+            fprintf( stderr, "Usage: %s [--json <file>] [--reps <n>] [--kernel <name>] [--gate <dir>] [--update] [--threshold <pct>] [--no-counters]\n", argv[0] );
+            return 1;
+        }
+    }
+
+    gp_evict    = calloc( BENCH_EVICT_SIZE, 1U );
+    p_inst      = calloc( BENCH_NUM_OF_INST, sizeof( bench_inst_t ));
+    p_res       = calloc( BENCH_NUM_OF_RES_MAX, sizeof( bench_res_t ));
+
+    if  (   ( NULL == gp_evict )
+        ||  ( NULL == p_inst )
+        ||  ( NULL == p_res ))
+    {
+        fprintf( stderr, "Out of memory\n" );
+        return 1;
+    }
+
+    fprint = bench_fprint_get();
+
+    printf( "Machine: %s, %u CPUs, %s, %s (fingerprint %016llx)\n\n", fprint.cpu, fprint.num_of_cpu, fprint.compiler, fprint.isa, (unsigned long long) fprint.key );
+
+    // Input: noise in [-1, 1]
+    for ( uint32_t n = 0U; n < BENCH_BLOCK_SIZE; n++ )
+    {
+        g_in[n] = (float32_t) (( 2.0 * ( (double) rand() / (double) RAND_MAX )) - 1.0 );
+    }
+
+    if ( true == counters )
+    {
+        num_of_cnt = bench_cnt_open();
+    }
+
+    printf( "%-20s %-9s %5s %5s %5s %10s %10s %10s %10s %12s %10s", "kernel", "param", "value", "inst", "cache", "median ns", "p10 ns", "p90 ns", "p99 ns", "samples/s", "cyc/sample" );
+
+    if ( num_of_cnt > 0U )
+    {
+        bench_cnt_print( NULL );
+    }
+
+    printf( "\n" );
+
+    for ( uint32_t k = 0U; k < BENCH_NUM_OF_KERNELS; k++ )
+    {
+        const bench_kernel_t * const p_kernel = &g_kernel[k];
+
+        if  (   ( NULL != p_only )
+            &&  ( 0 != strcmp( p_only, p_kernel->p_name )))
+        {
+            continue;
+        }
+
+        for ( uint32_t p = 0U; ( p < 4U ) && ( 0U != p_kernel->param[p] ); p++ )
+        {
+            // Instances are created once per parameter, single instance runs use first one
+            for ( uint32_t i = 0U; i < BENCH_NUM_OF_INST; i++ )
+            {
+                p_inst[i].param = p_kernel->param[p];
+                p_kernel->pf_init( &p_inst[i] );
+            }
+
+            for ( uint32_t cfg = 0U; ( cfg < 4U ) && ( num_of_res < BENCH_NUM_OF_RES_MAX ); cfg++ )
+            {
+                const uint32_t      num_of_inst = ((( cfg / 2U ) == 0U ) ? 1U : BENCH_NUM_OF_INST );
+                const bool          cold        = (( cfg % 2U ) == 1U );
+                bench_res_t * const p_r         = &p_res[ num_of_res++ ];
+
+                *p_r = bench_measure( p_kernel, p_inst, num_of_inst, cold, reps );
+
+                bench_str_copy( p_r->kernel, sizeof( p_r->kernel ), p_kernel->p_name );
+                bench_str_copy( p_r->param, sizeof( p_r->param ), p_kernel->p_param );
+                p_r->value          = p_kernel->param[p];
+                p_r->num_of_inst    = num_of_inst;
+                p_r->cold           = cold;
+
+                printf( "%-20s %-9s %5u %5u %5s %10.3f %10.3f %10.3f %10.3f %12.4g %10.2f",
+                        p_r->kernel, p_r->param, p_r->value, p_r->num_of_inst, ( cold ? "cold" : "warm" ),
+                        p_r->median, p_r->p10, p_r->p90, p_r->p99, ( 1e9 / p_r->median ), p_r->cycles );
+
+                if ( num_of_cnt > 0U )
+                {
+                    bench_cnt_print( p_r );
+                }
+
+                printf( "\n" );
+            }
+        }
+    }
+
+    if  (   ( NULL != p_json_path )
+        &&  ( false == bench_json_write( p_json_path, &fprint, p_res, num_of_res, reps )))
+    {
+        return 1;
+    }
+
+    if ( NULL != p_gate_dir )
+    {
+        static bench_res_t  base[BENCH_NUM_OF_RES_MAX];
+        char                path[1024];
+        int32_t             num_of_base = -1;
+
+        (void) snprintf( path, sizeof( path ), "%s/filter_bench_%016llx.json", p_gate_dir, (unsigned long long) fprint.key );
+
+        if ( false == update )
+        {
+            num_of_base = bench_json_read( path, base, BENCH_NUM_OF_RES_MAX );
+        }
+
+        if ( num_of_base < 0 )
+        {
+            if ( false == bench_json_write( path, &fprint, p_res, num_of_res, reps ))
+            {
+                return 1;
+            }
+
+            printf( "\nBaseline stored to %s\n", path );
+        }
+        else
+        {
+            const uint32_t num_of_reg = bench_gate( base, (uint32_t) num_of_base, p_res, num_of_res, threshold );
+
+            printf( "\nBaseline %s: %u regression(s) over %.1f %% threshold\n", path, num_of_reg, threshold );
+
+            if ( num_of_reg > 0U )
+            {
+                return 2;
+            }
+        }
+    }
+
+    return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Kernel wrappers
+*
+* @note     Instances are never freed, as filter module does not support it.
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void bench_rc_init(bench_inst_t * const p_inst)
+{
+    (void) filter_rc_init((p_filter_rc_t*) &p_inst->p_filter, 10.0f, BENCH_FS, (uint8_t) p_inst->param, 0.0f );
+}
+
+static void bench_rc_run(bench_inst_t * const p_inst, const float32_t * const p_in, float32_t * const p_out)
+{
+    for ( uint32_t n = 0U; n < BENCH_BLOCK_SIZE; n++ )
+    {
+        (void) filter_rc_hndl((p_filter_rc_t) p_inst->p_filter, p_in[n], &p_out[n] );
+    }
+}
+
+static void bench_rc_block_run(bench_inst_t * const p_inst, const float32_t * const p_in, float32_t * const p_out)
+{
+    (void) filter_rc_hndl_block((p_filter_rc_t) p_inst->p_filter, p_in, p_out, BENCH_BLOCK_SIZE );
+}
+
+static void bench_cr_init(bench_inst_t * const p_inst)
+{
+    (void) filter_cr_init((p_filter_cr_t*) &p_inst->p_filter, 10.0f, BENCH_FS, (uint8_t) p_inst->param );
+}
+
+static void bench_cr_run(bench_inst_t * const p_inst, const float32_t * const p_in, float32_t * const p_out)
+{
+    for ( uint32_t n = 0U; n < BENCH_BLOCK_SIZE; n++ )
+    {
+        (void) filter_cr_hndl((p_filter_cr_t) p_inst->p_filter, p_in[n], &p_out[n] );
+    }
+}
+
+static void bench_cr_block_run(bench_inst_t * const p_inst, const float32_t * const p_in, float32_t * const p_out)
+{
+    (void) filter_cr_hndl_block((p_filter_cr_t) p_inst->p_filter, p_in, p_out, BENCH_BLOCK_SIZE );
+}
+
+static void bench_band_init(bench_inst_t * const p_inst)
+{
+    (void) filter_band_init((p_filter_band_t*) &p_inst->p_filter, 5.0f, 100.0f, BENCH_FS, (uint8_t) p_inst->param, (uint8_t) p_inst->param );
+}
+
+static void bench_band_block_run(bench_inst_t * const p_inst, const float32_t * const p_in, float32_t * const p_out)
+{
+    (void) filter_band_hndl_block((p_filter_band_t) p_inst->p_filter, p_in, p_out, BENCH_BLOCK_SIZE );
+}
+
+static void bench_fir_init(bench_inst_t * const p_inst)
+{
+    float32_t * const p_a = malloc( p_inst->param * sizeof( float32_t ));
+
+    if ( NULL != p_a )
+    {
+        for ( uint32_t i = 0U; i < p_inst->param; i++ )
+        {
+            p_a[i] = ( 1.0f / (float32_t) p_inst->param );
+        }
+
+        (void) filter_fir_init((p_filter_fir_t*) &p_inst->p_filter, p_a, p_inst->param, 0.0f );
+        free( p_a );
+    }
+}
+
+static void bench_fir_run(bench_inst_t * const p_inst, const float32_t * const p_in, float32_t * const p_out)
+{
+    for ( uint32_t n = 0U; n < BENCH_BLOCK_SIZE; n++ )
+    {
+        p_out[n] = 0.0f;
+        (void) filter_fir_hndl((p_filter_fir_t) p_inst->p_filter, p_in[n], &p_out[n] );
+    }
+}
+
+static void bench_iir_init(bench_inst_t * const p_inst)
+{
+    const uint32_t      num     = ( p_inst->param + 1U );
+    float32_t   * const p_pole  = calloc( num, sizeof( float32_t ));
+    float32_t   * const p_zero  = calloc( num, sizeof( float32_t ));
+
+    if  (   ( NULL != p_pole )
+        &&  ( NULL != p_zero ))
+    {
+        filter_iir_coeff_t coeff = { .p_pole = p_pole, .p_zero = p_zero, .num_of_pole = num, .num_of_zero = num };
+
+        // All poles at 0.5: ( 1 - 0.5*z^-1 )^order, zeros at -1
+        p_pole[0] = 1.0f;
+        p_zero[0] = 1.0f;
+
+        for ( uint32_t k = 1U; k < num; k++ )
+        {
+            for ( uint32_t i = k; i > 0U; i-- )
+            {
+                p_pole[i] = ( p_pole[i] - ( 0.5f * p_pole[ i - 1U ] ));
+                p_zero[i] = ( p_zero[i] + p_zero[ i - 1U ] );
+            }
+        }
+
+        (void) filter_iir_init((p_filter_iir_t*) &p_inst->p_filter, &coeff );
+    }
+
+    free( p_pole );
+    free( p_zero );
+}
+
+static void bench_iir_run(bench_inst_t * const p_inst, const float32_t * const p_in, float32_t * const p_out)
+{
+    for ( uint32_t n = 0U; n < BENCH_BLOCK_SIZE; n++ )
+    {
+        p_out[n] = 0.0f;
+        (void) filter_iir_hndl((p_filter_iir_t) p_inst->p_filter, p_in[n], &p_out[n] );
+    }
+}
+
+static void bench_sos_init(bench_inst_t * const p_inst)
+{
+    filter_sos_coeff_t * const p_sect = malloc( p_inst->param * sizeof( filter_sos_coeff_t ));
+
+    if ( NULL != p_sect )
+    {
+        for ( uint32_t s = 0U; s < p_inst->param; s++ )
+        {
+            (void) filter_iir_coeff_calc_2nd_lpf( 50.0f, 0.7f, BENCH_FS, p_sect[s].a, p_sect[s].b );
+        }
+
+        (void) filter_sos_init((p_filter_sos_t*) &p_inst->p_filter, p_sect, p_inst->param );
+        free( p_sect );
+    }
+}
+
+static void bench_sos_block_run(bench_inst_t * const p_inst, const float32_t * const p_in, float32_t * const p_out)
+{
+    (void) filter_sos_hndl_block((p_filter_sos_t) p_inst->p_filter, p_in, p_out, BENCH_BLOCK_SIZE );
+}
+
+static void bench_dcb_init(bench_inst_t * const p_inst)
+{
+    int16_t * const p_in = malloc( BENCH_BLOCK_SIZE * sizeof( int16_t ));
+
+    p_inst->p_in    = p_in;
+    p_inst->p_out   = malloc( BENCH_BLOCK_SIZE * sizeof( int16_t ));
+
+    if ( NULL != p_in )
+    {
+        for ( uint32_t n = 0U; n < BENCH_BLOCK_SIZE; n++ )
+        {
+            p_in[n] = (int16_t) (( g_in[n] * 10000.0f ) + 1000.0f );
+        }
+    }
+
+    (void) filter_dcb_init((p_filter_dcb_t*) &p_inst->p_filter, 5.0f, BENCH_FS );
+}
+
+static void bench_dcb_block_run(bench_inst_t * const p_inst, const float32_t * const p_in, float32_t * const p_out)
+{
+    (void) p_in;
+    (void) p_out;
+
+    (void) filter_dcb_hndl_block((p_filter_dcb_t) p_inst->p_filter, p_inst->p_in, p_inst->p_out, BENCH_BLOCK_SIZE );
+}
+
+static void bench_dcb_bank_init(bench_inst_t * const p_inst)
+{
+    int16_t * const p_in = malloc( BENCH_BLOCK_SIZE * p_inst->param * sizeof( int16_t ));
+
+    p_inst->p_in    = p_in;
+    p_inst->p_out   = malloc( BENCH_BLOCK_SIZE * p_inst->param * sizeof( int16_t ));
+
+    if ( NULL != p_in )
+    {
+        for ( uint32_t n = 0U; n < ( BENCH_BLOCK_SIZE * p_inst->param ); n++ )
+        {
+            p_in[n] = (int16_t) (( g_in[ n % BENCH_BLOCK_SIZE ] * 10000.0f ) + 1000.0f );
+        }
+    }
+
+    (void) filter_dcb_bank_init((p_filter_dcb_bank_t*) &p_inst->p_filter, p_inst->param, 5.0f, BENCH_FS );
+}
+
+static void bench_dcb_bank_run(bench_inst_t * const p_inst, const float32_t * const p_in, float32_t * const p_out)
+{
+    (void) p_in;
+    (void) p_out;
+
+    (void) filter_dcb_bank_hndl_block((p_filter_dcb_bank_t) p_inst->p_filter, p_inst->p_in, p_inst->p_out, BENCH_BLOCK_SIZE );
+}
+
+static void bench_euro_init(bench_inst_t * const p_inst)
+{
+    (void) filter_euro_init((p_filter_euro_t*) &p_inst->p_filter, 1.0f, 0.1f, 1.0f, BENCH_FS, 0.0f );
+}
+
+static void bench_euro_run(bench_inst_t * const p_inst, const float32_t * const p_in, float32_t * const p_out)
+{
+    for ( uint32_t n = 0U; n < BENCH_BLOCK_SIZE; n++ )
+    {
+        (void) filter_euro_hndl((p_filter_euro_t) p_inst->p_filter, p_in[n], &p_out[n] );
+    }
+}
+
+static void bench_bool_init(bench_inst_t * const p_inst)
+{
+    uint64_t * const p_in = calloc( BENCH_BLOCK_SIZE / 64U, sizeof( uint64_t ));
+
+    p_inst->p_in    = p_in;
+    p_inst->p_out   = calloc( BENCH_BLOCK_SIZE / 64U, sizeof( uint64_t ));
+
+    // Bursts of noisy input
+    if ( NULL != p_in )
+    {
+        for ( uint32_t n = 0U; n < BENCH_BLOCK_SIZE; n++ )
+        {
+            if ( g_in[n] > ((( n / 64U ) % 2U ) ? -0.8f : 0.8f ))
+            {
+                p_in[ n / 64U ] |= ( 1ULL << ( n % 64U ));
+            }
+        }
+    }
+
+    (void) filter_bool_init((p_filter_bool_t*) &p_inst->p_filter, 10.0f, BENCH_FS, 0.2f );
+}
+
+static void bench_bool_run(bench_inst_t * const p_inst, const float32_t * const p_in, float32_t * const p_out)
+{
+    (void) p_in;
+    (void) p_out;
+
+    const uint64_t * const  p_w = p_inst->p_in;
+    uint64_t * const        p_y = p_inst->p_out;
+
+    for ( uint32_t n = 0U; n < BENCH_BLOCK_SIZE; n++ )
+    {
+        bool y = false;
+
+        (void) filter_bool_hndl((p_filter_bool_t) p_inst->p_filter, ( 0U != (( p_w[ n / 64U ] >> ( n % 64U )) & 1U )), &y );
+
+        p_y[ n / 64U ] ^= (uint64_t) y;
+    }
+}
+
+static void bench_bool_packed_run(bench_inst_t * const p_inst, const float32_t * const p_in, float32_t * const p_out)
+{
+    (void) p_in;
+    (void) p_out;
+
+    (void) filter_bool_hndl_packed((p_filter_bool_t) p_inst->p_filter, p_inst->p_in, p_inst->p_out, ( BENCH_BLOCK_SIZE / 64U ));
+}
+
+static void bench_pipe_init(bench_inst_t * const p_inst)
+{
+    float32_t       pole[3];
+    float32_t       zero[3];
+    p_filter_cr_t   cr          = NULL;
+    p_filter_iir_t  iir         = NULL;
+    p_filter_rc_t   rc          = NULL;
+    p_filter_t      stage[3]    = { NULL };
+
+    (void) filter_iir_coeff_calc_2nd_lpf( 50.0f, 0.7f, BENCH_FS, pole, zero );
+    (void) filter_cr_init( &cr, 1.0f, BENCH_FS, 1U );
+    (void) filter_iir_init( &iir, &(filter_iir_coeff_t){ .p_pole = pole, .p_zero = zero, .num_of_pole = 3U, .num_of_zero = 3U });
+    (void) filter_rc_init( &rc, 200.0f, BENCH_FS, 2U, 0.0f );
+    (void) filter_from_cr( &stage[0], cr );
+    (void) filter_from_iir( &stage[1], iir );
+    (void) filter_from_rc( &stage[2], rc );
+    (void) filter_pipe_init((p_filter_pipe_t*) &p_inst->p_filter, stage, 3U );
+}
+
+static void bench_pipe_run(bench_inst_t * const p_inst, const float32_t * const p_in, float32_t * const p_out)
+{
+    (void) filter_pipe_hndl_block((p_filter_pipe_t) p_inst->p_filter, p_in, p_out, BENCH_BLOCK_SIZE );
+}
@@ -0,0 +1,946 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      filter_scale.c
+*@brief     Multichannel scaling benchmark of filters
+*@author    Ziga Miklosic
+*@date      17.10.2026
+*@version   V2.1.0
+*
+*@brief     RC, CR and biquad filters are built for 1 to 100k channels and
+*           processed by 1 to all cores. Each point reports aggregate
+*           throughput, working set and cache level the working set of one
+*           thread fits into, so fall off from L1 to DRAM is visible.
+*
+*           Layouts:
+*               - malloc: one library instance per channel (as application
+*                         would allocate them)
+*               - bank:   library RC/CR filter bank (SoA, one instance)
+*               - aos:    harness contiguous array of per channel state
+*               - soa:    harness contiguous arrays per coefficient/state
+*
+*           Harness layouts use same recurrences as library, therefore
+*           difference to "malloc" layout is the cost of layout and call
+*           overhead.
+*
+*           Build from root of "General Embedded C Libraries Ecosystem":
+*
+*           gcc -std=gnu11 -O2 -I. -Imiddleware/filter/src
+*               middleware/filter/bench/filter_scale.c
+*               middleware/filter/src/filter.c
+*               middleware/ring_buffer/src/ring_buffer.c -lm -lpthread
+*
+*           Usage: filter_scale [--json <file>] [--channels <max>] [--threads <max>]
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sched.h>
+#include <malloc.h>
+
+#include "filter.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Sampling frequency of benchmarked filters
+ */
+#define SCALE_FS                    ( 1000.0f )
+
+/**
+ *  Number of ticks processed per block
+ */
+#define SCALE_BLOCK_SIZE            ( 64U )
+
+/**
+ *  Default max. number of channels
+ */
+#define SCALE_CH_MAX_DEF            ( 100000U )
+
+/**
+ *  Max. number of threads
+ */
+#define SCALE_THREAD_MAX            ( 256U )
+
+/**
+ *  Number of timed repetitions per point
+ */
+#define SCALE_REPS                  ( 5U )
+
+/**
+ *  Min. duration of repetition in ns
+ */
+#define SCALE_REP_TIME_MIN          ( 20e6 )
+
+/**
+ *  Min./max. of two values
+ */
+#define SCALE_MIN(a,b)              ((( a ) < ( b )) ? ( a ) : ( b ))
+#define SCALE_MAX(a,b)              ((( a ) > ( b )) ? ( a ) : ( b ))
+
+/**
+ *  Filter types
+ */
+typedef enum
+{
+    eSCALE_TYPE_RC = 0,     /**<1st order RC */
+    eSCALE_TYPE_CR,         /**<1st order CR */
+    eSCALE_TYPE_BIQUAD,     /**<2nd order low pass section */
+
+    eSCALE_TYPE_NUM_OF
+} scale_type_t;
+
+/**
+ *  Memory layouts
+ */
+typedef enum
+{
+    eSCALE_LAYOUT_MALLOC = 0,   /**<Library instance per channel */
+    eSCALE_LAYOUT_BANK,         /**<Library filter bank */
+    eSCALE_LAYOUT_AOS,          /**<Harness array of structures */
+    eSCALE_LAYOUT_SOA,          /**<Harness structure of arrays */
+
+    eSCALE_LAYOUT_NUM_OF
+} scale_layout_t;
+
+/**
+ *  Harness RC/CR channel state (array of structures)
+ */
+typedef struct
+{
+    float32_t   alpha;  /**<Filter coefficient */
+    float32_t   y;      /**<Output state */
+    float32_t   x;      /**<Previous input (CR only) */
+} scale_1st_t;
+
+/**
+ *  Harness biquad channel state (array of structures)
+ */
+typedef struct
+{
+    float32_t   b[3];   /**<Numerator */
+    float32_t   a[2];   /**<Denominator, a0 = 1 omitted */
+    float32_t   w[2];   /**<Transposed direct form II state */
+} scale_biquad_t;
+
+/**
+ *  Channels of one layout
+ */
+typedef struct
+{
+    scale_type_t    type;           /**<Filter type */
+    scale_layout_t  layout;         /**<Memory layout */
+    uint32_t        num_of_ch;      /**<Number of channels */
+    size_t          bytes;          /**<Allocated bytes of filter state (incl. allocator overhead) */
+    void         ** p_inst;         /**<Library instances (malloc) */
+    void          * p_bank;         /**<Library bank (bank) */
+    void          * p_aos;          /**<Harness state (aos) */
+    float32_t     * p_soa[7];       /**<Harness state (soa) */
+} scale_set_t;
+
+/**
+ *  Worker thread
+ */
+typedef struct
+{
+    pthread_t           thread;     /**<Thread */
+    const scale_set_t * p_set;      /**<Channels */
+    uint32_t            ch_start;   /**<First channel */
+    uint32_t            ch_end;     /**<One past last channel */
+    uint32_t            cpu;        /**<Pinned CPU */
+    float32_t         * p_out;      /**<Output (frame of channels or block of samples) */
+} scale_worker_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Type and layout names
+ */
+static const char * const gp_type_name[eSCALE_TYPE_NUM_OF]      = { "rc", "cr", "biquad" };
+static const char * const gp_layout_name[eSCALE_LAYOUT_NUM_OF]  = { "malloc", "bank", "aos", "soa" };
+
+/**
+ *  Input: channel c at tick n reads g_p_in[ n + c ], noise repeated with
+ *  period SCALE_BLOCK_SIZE, so channels and ticks see different samples
+ */
+static float32_t * g_p_in = NULL;
+
+/**
+ *  Biquad coefficients
+ */
+static float32_t g_biquad_a[3];
+static float32_t g_biquad_b[3];
+
+/**
+ *  Worker synchronization
+ */
+static pthread_barrier_t    g_barrier;
+static volatile uint32_t    g_blocks    = 0U;
+static volatile bool        g_stop      = false;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get monotonic time
+*
+* @return       time - Time in ns
+*/
+////////////////////////////////////////////////////////////////////////////////
+static double scale_time_ns(void)
+{
+    struct timespec ts;
+
+    (void) clock_gettime( CLOCK_MONOTONIC, &ts );
+
+    return (( (double) ts.tv_sec * 1e9 ) + (double) ts.tv_nsec );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get allocated heap bytes
+*
+* @return       bytes - Allocated bytes, 0 if unknown
+*/
+////////////////////////////////////////////////////////////////////////////////
+static size_t scale_heap_get(void)
+{
+    #if defined( __GLIBC__ ) && (( __GLIBC__ > 2 ) || (( __GLIBC__ == 2 ) && ( __GLIBC_MINOR__ >= 33 )))
+        const struct mallinfo2 info = mallinfo2();
+
+        // Large allocations are mapped and are not part of arena
+        return ( info.uordblks + info.hblkhd );
+    #else
+        return 0U;
+    #endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get cache level working set fits into
+*
+* @param[in]    ws_thread   - Working set of one thread in bytes
+* @param[in]    ws_total    - Working set of all threads in bytes
+* @return       name        - Cache level name
+*/
+////////////////////////////////////////////////////////////////////////////////
+static const char * scale_cache_level(const size_t ws_thread, const size_t ws_total)
+{
+    const long l1 = sysconf( _SC_LEVEL1_DCACHE_SIZE );
+    const long l2 = sysconf( _SC_LEVEL2_CACHE_SIZE );
+    const long l3 = sysconf( _SC_LEVEL3_CACHE_SIZE );
+
+    if (( l1 > 0 ) && ( ws_thread <= (size_t) l1 ))
+    {
+        return "L1";
+    }
+    else if (( l2 > 0 ) && ( ws_thread <= (size_t) l2 ))
+    {
+        return "L2";
+    }
+    else if (( l3 > 0 ) && ( ws_total <= (size_t) l3 ))
+    {
+        return "L3";
+    }
+    else if (( l1 <= 0 ) && ( l2 <= 0 ) && ( l3 <= 0 ))
+    {
+        return "?";
+    }
+    else
+    {
+        return "DRAM";
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Compare doubles for qsort
+*
+* @param[in]    p_a     - First value
+* @param[in]    p_b     - Second value
+* @return       order   - -1, 0 or 1
+*/
+////////////////////////////////////////////////////////////////////////////////
+static int scale_cmp(const void * p_a, const void * p_b)
+{
+    const double a = *(const double*) p_a;
+    const double b = *(const double*) p_b;
+
+    return (( a > b ) - ( a < b ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Build channels of type and layout
+*
+* @note     Library instances are never freed, as filter module does not
+*           support it, therefore they are built once per channel count.
+*
+* @param[out]   p_set       - Channels
+* @param[in]    type        - Filter type
+* @param[in]    layout      - Memory layout
+* @param[in]    num_of_ch   - Number of channels
+* @return       status      - true if built
+*
+* @note     Bank layout is available for RC and CR type only.
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool scale_set_build(scale_set_t * const p_set, const scale_type_t type, const scale_layout_t layout, const uint32_t num_of_ch)
+{
+    const size_t    heap    = scale_heap_get();
+    const float32_t alpha_rc    = ( 1.0f / ( 1.0f + ( SCALE_FS / ( 2.0f * (float32_t) M_PI * 10.0f ))));
+    const float32_t alpha_cr    = ( SCALE_FS / ( SCALE_FS + ( 2.0f * (float32_t) M_PI * 10.0f )));
+    bool            ok      = true;
+
+    memset( p_set, 0, sizeof( scale_set_t ));
+
+    p_set->type         = type;
+    p_set->layout       = layout;
+    p_set->num_of_ch    = num_of_ch;
+
+    switch( layout )
+    {
+        case eSCALE_LAYOUT_MALLOC:
+            p_set->p_inst = calloc( num_of_ch, sizeof( void* ));
+            ok = ( NULL != p_set->p_inst );
+
+            for ( uint32_t c = 0U; ( c < num_of_ch ) && ( true == ok ); c++ )
+            {
+                if ( eSCALE_TYPE_RC == type )
+                {
+                    ok = ( eFILTER_OK == filter_rc_init((p_filter_rc_t*) &p_set->p_inst[c], 10.0f, SCALE_FS, 1U, 0.0f ));
+                }
+                else if ( eSCALE_TYPE_CR == type )
+                {
+                    ok = ( eFILTER_OK == filter_cr_init((p_filter_cr_t*) &p_set->p_inst[c], 10.0f, SCALE_FS, 1U ));
+                }
+                else
+                {
+                    filter_sos_coeff_t sect;
+
+                    memcpy( sect.a, g_biquad_a, sizeof( sect.a ));
+                    memcpy( sect.b, g_biquad_b, sizeof( sect.b ));
+
+                    ok = ( eFILTER_OK == filter_sos_init((p_filter_sos_t*) &p_set->p_inst[c], &sect, 1U ));
+                }
+            }
+            break;
+
+        case eSCALE_LAYOUT_BANK:
+            if ( eSCALE_TYPE_RC == type )
+            {
+                ok = ( eFILTER_OK == filter_rc_bank_init((p_filter_rc_bank_t*) &p_set->p_bank, num_of_ch, 10.0f, SCALE_FS, 1U, 0.0f ));
+            }
+            else
+            {
+                ok = ( eFILTER_OK == filter_cr_bank_init((p_filter_cr_bank_t*) &p_set->p_bank, num_of_ch, 10.0f, SCALE_FS, 1U ));
+            }
+            break;
+
+        case eSCALE_LAYOUT_AOS:
+            if ( eSCALE_TYPE_BIQUAD == type )
+            {
+                scale_biquad_t * const p_aos = calloc( num_of_ch, sizeof( scale_biquad_t ));
+
+                p_set->p_aos = p_aos;
+                ok = ( NULL != p_aos );
+
+                for ( uint32_t c = 0U; ( c < num_of_ch ) && ( true == ok ); c++ )
+                {
+                    memcpy( p_aos[c].b, g_biquad_b, sizeof( p_aos[c].b ));
+                    p_aos[c].a[0] = g_biquad_a[1];
+                    p_aos[c].a[1] = g_biquad_a[2];
+                }
+            }
+            else
+            {
+                scale_1st_t * const p_aos = calloc( num_of_ch, sizeof( scale_1st_t ));
+
+                p_set->p_aos = p_aos;
+                ok = ( NULL != p_aos );
+
+                for ( uint32_t c = 0U; ( c < num_of_ch ) && ( true == ok ); c++ )
+                {
+                    p_aos[c].alpha = (( eSCALE_TYPE_RC == type ) ? alpha_rc : alpha_cr );
+                }
+            }
+            break;
+
+        case eSCALE_LAYOUT_SOA:
+        default:
+        {
+            const uint32_t num_of_arr = (( eSCALE_TYPE_BIQUAD == type ) ? 7U : 3U );
+
+            for ( uint32_t i = 0U; ( i < num_of_arr ) && ( true == ok ); i++ )
+            {
+                p_set->p_soa[i] = calloc( num_of_ch, sizeof( float32_t ));
+                ok = ( NULL != p_set->p_soa[i] );
+            }
+
+            for ( uint32_t c = 0U; ( c < num_of_ch ) && ( true == ok ); c++ )
+            {
+                if ( eSCALE_TYPE_BIQUAD == type )
+                {
+                    p_set->p_soa[0][c] = g_biquad_b[0];
+                    p_set->p_soa[1][c] = g_biquad_b[1];
+                    p_set->p_soa[2][c] = g_biquad_b[2];
+                    p_set->p_soa[3][c] = g_biquad_a[1];
+                    p_set->p_soa[4][c] = g_biquad_a[2];
+                }
+                else
+                {
+                    p_set->p_soa[0][c] = (( eSCALE_TYPE_RC == type ) ? alpha_rc : alpha_cr );
+                }
+            }
+            break;
+        }
+    }
+
+    p_set->bytes = ( scale_heap_get() - heap );
+
+    return ok;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Free harness channels
+*
+* @param[in]    p_set   - Channels
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void scale_set_free(scale_set_t * const p_set)
+{
+    free( p_set->p_aos );
+
+    for ( uint32_t i = 0U; i < 7U; i++ )
+    {
+        free( p_set->p_soa[i] );
+    }
+
+    p_set->p_aos = NULL;
+    memset( p_set->p_soa, 0, sizeof( p_set->p_soa ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Process one block of worker channels
+*
+* @brief    Instance layouts are processed channel by channel with block
+*           handler, bank and SoA layouts tick by tick over all channels.
+*
+* @param[in]    p_w     - Worker
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void scale_block(scale_worker_t * const p_w)
+{
+    const scale_set_t * const   p_set   = p_w->p_set;
+    const uint32_t              c0      = p_w->ch_start;
+    const uint32_t              c1      = p_w->ch_end;
+    float32_t * const           p_out   = p_w->p_out;
+
+    switch( p_set->layout )
+    {
+        case eSCALE_LAYOUT_MALLOC:
+            for ( uint32_t c = c0; c < c1; c++ )
+            {
+                if ( eSCALE_TYPE_RC == p_set->type )
+                {
+                    (void) filter_rc_hndl_block((p_filter_rc_t) p_set->p_inst[c], &g_p_in[c], p_out, SCALE_BLOCK_SIZE );
+                }
+                else if ( eSCALE_TYPE_CR == p_set->type )
+                {
+                    (void) filter_cr_hndl_block((p_filter_cr_t) p_set->p_inst[c], &g_p_in[c], p_out, SCALE_BLOCK_SIZE );
+                }
+                else
+                {
+                    (void) filter_sos_hndl_block((p_filter_sos_t) p_set->p_inst[c], &g_p_in[c], p_out, SCALE_BLOCK_SIZE );
+                }
+            }
+            break;
+
+        case eSCALE_LAYOUT_BANK:
+            // Bank handles all of its channels, it is split between threads as whole
+            if ( 0U == c0 )
+            {
+                for ( uint32_t n = 0U; n < SCALE_BLOCK_SIZE; n++ )
+                {
+                    if ( eSCALE_TYPE_RC == p_set->type )
+                    {
+                        (void) filter_rc_bank_hndl((p_filter_rc_bank_t) p_set->p_bank, &g_p_in[n], p_out );
+                    }
+                    else
+                    {
+                        (void) filter_cr_bank_hndl((p_filter_cr_bank_t) p_set->p_bank, &g_p_in[n], p_out );
+                    }
+                }
+            }
+            break;
+
+        case eSCALE_LAYOUT_AOS:
+            if ( eSCALE_TYPE_BIQUAD == p_set->type )
+            {
+                scale_biquad_t * const p_aos = p_set->p_aos;
+
+                for ( uint32_t c = c0; c < c1; c++ )
+                {
+                    scale_biquad_t * const  p_s = &p_aos[c];
+                    float32_t               w0  = p_s->w[0];
+                    float32_t               w1  = p_s->w[1];
+
+                    for ( uint32_t n = 0U; n < SCALE_BLOCK_SIZE; n++ )
+                    {
+                        const float32_t x = g_p_in[ n + c ];
+                        const float32_t y = (( p_s->b[0] * x ) + w0 );
+
+                        w0 = (( p_s->b[1] * x ) - ( p_s->a[0] * y ) + w1 );
+                        w1 = (( p_s->b[2] * x ) - ( p_s->a[1] * y ));
+                        p_out[n] = y;
+                    }
+
+                    p_s->w[0] = w0;
+                    p_s->w[1] = w1;
+                }
+            }
+            else
+            {
+                scale_1st_t * const p_aos   = p_set->p_aos;
+                const bool          is_rc   = ( eSCALE_TYPE_RC == p_set->type );
+
+                for ( uint32_t c = c0; c < c1; c++ )
+                {
+                    scale_1st_t * const p_s     = &p_aos[c];
+                    const float32_t     alpha   = p_s->alpha;
+                    float32_t           y       = p_s->y;
+                    float32_t           x1      = p_s->x;
+
+                    for ( uint32_t n = 0U; n < SCALE_BLOCK_SIZE; n++ )
+                    {
+                        const float32_t x = g_p_in[ n + c ];
+
+                        if ( true == is_rc )
+                        {
+                            y = ( y + ( alpha * ( x - y )));
+                        }
+                        else
+                        {
+                            y = ( alpha * ( y + x - x1 ));
+                            x1 = x;
+                        }
+
+                        p_out[n] = y;
+                    }
+
+                    p_s->y = y;
+                    p_s->x = x1;
+                }
+            }
+            break;
+
+        case eSCALE_LAYOUT_SOA:
+        default:
+            for ( uint32_t n = 0U; n < SCALE_BLOCK_SIZE; n++ )
+            {
+                const float32_t * const p_x = &g_p_in[n];
+
+                if ( eSCALE_TYPE_BIQUAD == p_set->type )
+                {
+                    const float32_t * const p_b0 = p_set->p_soa[0];
+                    const float32_t * const p_b1 = p_set->p_soa[1];
+                    const float32_t * const p_b2 = p_set->p_soa[2];
+                    const float32_t * const p_a1 = p_set->p_soa[3];
+                    const float32_t * const p_a2 = p_set->p_soa[4];
+                    float32_t * const       p_w0 = p_set->p_soa[5];
+                    float32_t * const       p_w1 = p_set->p_soa[6];
+
+                    for ( uint32_t c = c0; c < c1; c++ )
+                    {
+                        const float32_t y = (( p_b0[c] * p_x[c] ) + p_w0[c] );
+
+                        p_w0[c] = (( p_b1[c] * p_x[c] ) - ( p_a1[c] * y ) + p_w1[c] );
+                        p_w1[c] = (( p_b2[c] * p_x[c] ) - ( p_a2[c] * y ));
+                        p_out[c] = y;
+                    }
+                }
+                else if ( eSCALE_TYPE_RC == p_set->type )
+                {
+                    const float32_t * const p_alpha = p_set->p_soa[0];
+                    float32_t * const       p_y     = p_set->p_soa[1];
+
+                    for ( uint32_t c = c0; c < c1; c++ )
+                    {
+                        p_y[c] = ( p_y[c] + ( p_alpha[c] * ( p_x[c] - p_y[c] )));
+                        p_out[c] = p_y[c];
+                    }
+                }
+                else
+                {
+                    const float32_t * const p_alpha = p_set->p_soa[0];
+                    float32_t * const       p_y     = p_set->p_soa[1];
+                    float32_t * const       p_x1    = p_set->p_soa[2];
+
+                    for ( uint32_t c = c0; c < c1; c++ )
+                    {
+                        p_y[c] = ( p_alpha[c] * ( p_y[c] + p_x[c] - p_x1[c] ));
+                        p_x1[c] = p_x[c];
+                        p_out[c] = p_y[c];
+                    }
+                }
+            }
+            break;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Worker thread
+*
+* @brief    Every repetition starts and ends on barrier, main thread
+*           (worker 0) sets number of blocks and stop flag in between.
+*
+* @param[in]    p_arg   - Worker
+* @return       NULL
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void * scale_worker(void * p_arg)
+{
+    scale_worker_t * const p_w = p_arg;
+
+    for (;;)
+    {
+        (void) pthread_barrier_wait( &g_barrier );
+
+        if ( true == g_stop )
+        {
+            break;
+        }
+
+        for ( uint32_t b = 0U; b < g_blocks; b++ )
+        {
+            scale_block( p_w );
+        }
+
+        (void) pthread_barrier_wait( &g_barrier );
+    }
+
+    return NULL;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Pin calling thread to CPU
+*
+* @param[in]    cpu - CPU index
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void scale_pin(const uint32_t cpu)
+{
+    cpu_set_t set;
+
+    CPU_ZERO( &set );
+    CPU_SET( cpu, &set );
+
+    (void) pthread_setaffinity_np( pthread_self(), sizeof( set ), &set );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Measure aggregate throughput of channels on threads
+*
+* @param[in]    p_set       - Channels
+* @param[in]    num_of_th   - Number of threads
+* @param[in]    num_of_cpu  - Number of CPUs
+* @return       rate        - Median channel samples per second, 0 on error
+*/
+////////////////////////////////////////////////////////////////////////////////
+static double scale_measure(const scale_set_t * const p_set, const uint32_t num_of_th, const uint32_t num_of_cpu)
+{
+    static scale_worker_t   worker[SCALE_THREAD_MAX];
+    double                  rate[SCALE_REPS]    = { 0 };
+    double                  t       = 0.0;
+    uint32_t                r       = 0U;
+    const uint32_t          out_len = SCALE_MAX( p_set->num_of_ch, SCALE_BLOCK_SIZE );
+    bool                    ok      = true;
+
+    if ( 0 != pthread_barrier_init( &g_barrier, NULL, num_of_th ))
+    {
+        return 0.0;
+    }
+
+    g_blocks    = 1U;
+    g_stop      = false;
+
+    for ( uint32_t i = 0U; i < num_of_th; i++ )
+    {
+        worker[i].p_set     = p_set;
+        worker[i].ch_start  = (uint32_t) (( (uint64_t) p_set->num_of_ch * i ) / num_of_th );
+        worker[i].ch_end    = (uint32_t) (( (uint64_t) p_set->num_of_ch * ( i + 1U )) / num_of_th );
+        worker[i].cpu       = ( i % num_of_cpu );
+        worker[i].p_out     = malloc( out_len * sizeof( float32_t ));
+
+        ok &= ( NULL != worker[i].p_out );
+    }
+
+    // Main thread is worker 0
+    for ( uint32_t i = 1U; ( i < num_of_th ) && ( true == ok ); i++ )
+    {
+        ok = ( 0 == pthread_create( &worker[i].thread, NULL, scale_worker, &worker[i] ));
+
+        if ( true == ok )
+        {
+            cpu_set_t set;
+
+            CPU_ZERO( &set );
+            CPU_SET( worker[i].cpu, &set );
+            (void) pthread_setaffinity_np( worker[i].thread, sizeof( set ), &set );
+        }
+        else
+        {
+            fprintf( stderr, "Cannot create thread %u\n", i );
+            exit( 1 );
+        }
+    }
+
+    scale_pin( 0U );
+
+    // Calibrate blocks, then timed repetitions
+    while (( true == ok ) && ( r < SCALE_REPS ))
+    {
+        double t0;
+
+        (void) pthread_barrier_wait( &g_barrier );
+        t0 = scale_time_ns();
+
+        for ( uint32_t b = 0U; b < g_blocks; b++ )
+        {
+            scale_block( &worker[0] );
+        }
+
+        (void) pthread_barrier_wait( &g_barrier );
+        t = ( scale_time_ns() - t0 );
+
+        if ( t < SCALE_REP_TIME_MIN )
+        {
+            g_blocks = ( g_blocks * 2U );
+        }
+        else
+        {
+            rate[r] = ((( (double) p_set->num_of_ch * SCALE_BLOCK_SIZE * g_blocks ) / t ) * 1e9 );
+            r++;
+        }
+    }
+
+    g_stop = true;
+    (void) pthread_barrier_wait( &g_barrier );
+
+    for ( uint32_t i = 1U; i < num_of_th; i++ )
+    {
+        (void) pthread_join( worker[i].thread, NULL );
+    }
+
+    for ( uint32_t i = 0U; i < num_of_th; i++ )
+    {
+        free( worker[i].p_out );
+    }
+
+    (void) pthread_barrier_destroy( &g_barrier );
+
+    qsort( rate, SCALE_REPS, sizeof( double ), scale_cmp );
+
+    return ( ok ? rate[ SCALE_REPS / 2U ] : 0.0 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Run scaling benchmark
+*
+* @param[in]    argc    - Number of arguments
+* @param[in]    argv    - Arguments
+* @return       status  - 0 on success
+*/
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char ** argv)
+{
+    const char    * p_json_path = NULL;
+    FILE          * p_json      = NULL;
+    uint32_t        ch_max      = SCALE_CH_MAX_DEF;
+    uint32_t        num_of_cpu  = (uint32_t) sysconf( _SC_NPROCESSORS_ONLN );
+    uint32_t        th_max      = 0U;
+    bool            first       = true;
+
+    for ( int a = 1; a < argc; a++ )
+    {
+        if  (   ( 0 == strcmp( argv[a], "--json" ))
+            &&  (( a + 1 ) < argc ))
+        {
+            p_json_path = argv[++a];
+        }
+        else if (   ( 0 == strcmp( argv[a], "--channels" ))
+                &&  (( a + 1 ) < argc ))
+        {
+            ch_max = (uint32_t) strtoul( argv[++a], NULL, 10 );
+        }
+        else if (   ( 0 == strcmp( argv[a], "--threads" ))
+                &&  (( a + 1 ) < argc ))
+        {
+            th_max = (uint32_t) strtoul( argv[++a], NULL, 10 );
+        }
+        else
+        {
+            fprintf( stderr, "Usage: %s [--json <file>] [--channels <max>] [--threads <max>]\n", argv[0] );
+            return 1;
+        }
+    }
+
+    num_of_cpu  = (( num_of_cpu < 1U ) ? 1U : num_of_cpu );
+    th_max      = ((( th_max < 1U ) || ( th_max > SCALE_THREAD_MAX )) ? SCALE_MIN( num_of_cpu, SCALE_THREAD_MAX ) : th_max );
+    ch_max      = (( ch_max < 1U ) ? 1U : ch_max );
+
+    g_p_in = malloc(( ch_max + SCALE_BLOCK_SIZE ) * sizeof( float32_t ));
+
+    if ( NULL == g_p_in )
+    {
+        fprintf( stderr, "Out of memory\n" );
+        return 1;
+    }
+
+    for ( uint32_t n = 0U; n < ( ch_max + SCALE_BLOCK_SIZE ); n++ )
+    {
+        g_p_in[n] = (( n < SCALE_BLOCK_SIZE ) ? (float32_t) (( 2.0 * ( (double) rand() / (double) RAND_MAX )) - 1.0 ) : g_p_in[ n % SCALE_BLOCK_SIZE ] );
+    }
+
+    (void) filter_iir_coeff_calc_2nd_lpf( 50.0f, 0.7f, SCALE_FS, g_biquad_a, g_biquad_b );
+
+    // Normalize to a0 = 1
+    for ( uint32_t i = 0U; i < 3U; i++ )
+    {
+        g_biquad_b[i] /= g_biquad_a[0];
+    }
+
+    g_biquad_a[1] /= g_biquad_a[0];
+    g_biquad_a[2] /= g_biquad_a[0];
+    g_biquad_a[0] = 1.0f;
+
+    if ( NULL != p_json_path )
+    {
+        p_json = fopen( p_json_path, "w" );
+
+        if ( NULL == p_json )
+        {
+            fprintf( stderr, "Cannot open %s\n", p_json_path );
+            return 1;
+        }
+
+        fprintf( p_json, "{\n  \"block_size\": %u,\n  \"cpus\": %u,\n  \"results\": [\n", SCALE_BLOCK_SIZE, num_of_cpu );
+    }
+
+    printf( "%-7s %-7s %8s %4s %12s %5s %12s %10s %8s\n", "type", "layout", "channels", "thr", "bytes/ch", "cache", "samples/s", "ns/sample", "speedup" );
+
+    for ( uint32_t type = 0U; type < eSCALE_TYPE_NUM_OF; type++ )
+    {
+        for ( uint32_t layout = 0U; layout < eSCALE_LAYOUT_NUM_OF; layout++ )
+        {
+            // Library has no biquad bank
+            if  (   ( eSCALE_LAYOUT_BANK == layout )
+                &&  ( eSCALE_TYPE_BIQUAD == type ))
+            {
+                continue;
+            }
+
+            // Channels: 1, 10, 100, ... ch_max
+            for ( uint32_t ch = 1U; ; ch = SCALE_MIN(( ch * 10U ), ch_max ))
+            {
+                scale_set_t set;
+                double      rate_1  = 0.0;
+
+                if ( false == scale_set_build( &set, (scale_type_t) type, (scale_layout_t) layout, ch ))
+                {
+                    fprintf( stderr, "Cannot build %s/%s with %u channels\n", gp_type_name[type], gp_layout_name[layout], ch );
+                    scale_set_free( &set );
+                    break;
+                }
+
+                // Threads: 1, 2, 4, ... th_max
+                for ( uint32_t th = 1U; ; th = SCALE_MIN(( th * 2U ), th_max ))
+                {
+                    // Bank is single instance, it does not split over threads
+                    const uint32_t  num_of_th   = (( eSCALE_LAYOUT_BANK == layout ) ? 1U : SCALE_MIN( th, ch ));
+                    const size_t    ws_state    = (( set.bytes > 0U ) ? set.bytes : ( (size_t) ch * sizeof( float32_t ) * 3U ));
+                    const size_t    ws_total    = ( ws_state + ( (size_t) ch * sizeof( float32_t ) * 2U ));
+                    const size_t    ws_thread   = ( ws_total / num_of_th );
+                    const double    rate        = scale_measure( &set, num_of_th, num_of_cpu );
+
+                    if ( th > 1U )
+                    {
+                        if ( num_of_th != th )
+                        {
+                            break;
+                        }
+                    }
+                    else
+                    {
+                        rate_1 = rate;
+                    }
+
+                    printf( "%-7s %-7s %8u %4u %12.1f %5s %12.4g %10.3f %8.2f\n",
+                            gp_type_name[type], gp_layout_name[layout], ch, num_of_th, ( (double) set.bytes / ch ),
+                            scale_cache_level( ws_thread, ws_total ), rate, ( 1e9 / rate ), ( rate / rate_1 ));
+
+                    if ( NULL != p_json )
+                    {
+                        fprintf( p_json, "%s    {\"type\": \"%s\", \"layout\": \"%s\", \"channels\": %u, \"threads\": %u, "
+                                         "\"state_bytes\": %zu, \"working_set_bytes\": %zu, \"cache\": \"%s\", "
+                                         "\"samples_per_s\": %.6g, \"ns_per_sample\": %.4f, \"speedup\": %.4f}",
+                                 ( first ? "" : ",\n" ), gp_type_name[type], gp_layout_name[layout], ch, num_of_th,
+                                 set.bytes, ws_total, scale_cache_level( ws_thread, ws_total ), rate, ( 1e9 / rate ), ( rate / rate_1 ));
+
+                        first = false;
+                    }
+
+                    if ( th == th_max )
+                    {
+                        break;
+                    }
+                }
+
+                scale_set_free( &set );
+
+                if ( ch == ch_max )
+                {
+                    break;
+                }
+            }
+        }
+    }
+
+    if ( NULL != p_json )
+    {
+        fprintf( p_json, "\n  ]\n}\n" );
+        fclose( p_json );
+    }
+
+    return 0;
+}
@@ -6,8 +6,8 @@
 *@file      filter.c
 *@brief     Various filter designs
 *@author    Ziga Miklosic
-*@date      26.10.2023
-*@version   V2.0.0
+*@date      17.10.2026
+*@version   V2.1.0
 *
 *@section   Description
 *   
@@ -36,8 +36,16 @@
 #include <math.h>
 #include <assert.h>
 
+#if ( 1 == FILTER_CFG_ATOMIC_EN )
+    #include <stdatomic.h>
+#endif
+
 #include "middleware/ring_buffer/src/ring_buffer.h"
 
+#if defined( __AVX512F__ ) || defined( __AVX2__ )
+    #include <immintrin.h>
+#endif
+
 /**
  *     Compatibility check with RING_BUFFER
  *
@@ -56,17 +64,143 @@ _Static_assert( 2 == RING_BUFFER_VER_MAJOR );
  */
 #define FILTER_TWOPI        ((float32_t) ( 2.0 * M_PI ))
 
+/**
+ *  Upper limit of normalized angular cutoff frequency (w = 2*pi*fc/fs)
+ *  used by fast cutoff modulation path. Equals to fc = fs/2.
+ */
+#define FILTER_FAST_W_MAX   ((float32_t) ( M_PI ))
+
+/**
+ *  Reciprocal approximation initial guess magic number
+ */
+#define FILTER_FAST_RECIP_MAGIC     ( 0x7EF311C3UL )
+
+/**
+ *  Base 2 logarithm of e
+ */
+#define FILTER_LOG2E                ((float32_t) ( 1.44269504088896 ))
+
+/**
+ *  Normalized angular cutoff below which RC alpha for irregular
+ *  time step is calculated by power series instead of exponent
+ */
+#define FILTER_DT_SERIES_LIMIT      ( 0.1f )
+
+/**
+ *  DC blocker pole fixed point format (Q15)
+ */
+#define FILTER_DCB_Q                ( 15 )
+#define FILTER_DCB_FRAC_MASK        ( 0x7FFFL )
+#define FILTER_DCB_R_MAX            ( 0x7FFFL )
+
+/**
+ *  Integer boolean filter fixed point formats. State and coefficient are
+ *  both in Q30 (input high equals to 1 << 30), product is 64-bit.
+ */
+#define FILTER_BOOL_CNT_Q           ( 30 )
+#define FILTER_BOOL_CNT_ONE         ((int32_t) ( 1L << FILTER_BOOL_CNT_Q ))
+#define FILTER_BOOL_CNT_ALPHA_Q     ( 30 )
+#define FILTER_BOOL_CNT_FRAC_MASK   ((int64_t) (( 1LL << FILTER_BOOL_CNT_ALPHA_Q ) - 1LL ))
+
+/**
+ *  Integer boolean filter level calibration limit in samples
+ */
+#define FILTER_BOOL_CNT_SIM_MAX     ( 1UL << 24 )
+
+/**
+ *  Maximum number of bit planes (integrator width) of boolean filter bank
+ *  and number of planes added above minimum for resolution
+ */
+#define FILTER_BOOL_BANK_PLANES_MAX     ( 32U )
+#define FILTER_BOOL_BANK_PLANES_EXTRA   ( 2U )
+
+/**
+ *  Number of packed words processed at once when extracting boolean
+ *  filter edges
+ */
+#define FILTER_BOOL_EDGE_CHUNK      ( 16U )
+
+/**
+ *  Filter pipeline tile size in samples
+ *
+ * @note    Two tiles are used as scratch, they shall fit into L1 cache
+ *          together with filter states.
+ */
+#define FILTER_PIPE_TILE_SIZE       ( 64U )
+
+/**
+ *  Max. number of IIR poles/zeros that can be fused with preceding CR
+ *  filter in pipeline (biquad)
+ */
+#define FILTER_PIPE_FUSE_IIR_MAX    ( 3U )
+
+/**
+ *  LTI stages fusion root tolerance
+ *
+ * @note    Relative to root magnitude (at least 1). Zero and pole closer
+ *          than that cancel, root with smaller imaginary part is real.
+ */
+#define FILTER_FUSE_ROOT_TOL        ( 1e-6 )
+
+/**
+ *  LTI stages fusion max. relative response deviation of fused filter
+ */
+#define FILTER_FUSE_RESP_TOL        ( 1e-3 )
+
+/**
+ *  LTI stages fusion number of response check frequencies, from 0 to fs/2
+ */
+#define FILTER_FUSE_NUM_OF_FREQ     ( 32U )
+
+/**
+ *  LTI stages fusion root finder iteration limit and relative step
+ *  at which it stops
+ */
+#define FILTER_FUSE_ROOT_ITER_MAX   ( 500U )
+#define FILTER_FUSE_ROOT_STEP_MIN   ( 1e-14 )
+
+/**
+ *  Larger of two values
+ */
+#define FILTER_MAX_OF(a,b)          ((( a ) > ( b )) ? ( a ) : ( b ))
+
+#if ( 1 == FILTER_CFG_ATOMIC_EN )
+
+/**
+ *     Concurrent parameter update lock (seqlock)
+ *
+ * @note    Sequence is odd while control thread writes new parameters.
+ *          Sample path takes new parameters only if sequence was even and
+ *          did not change during copy, otherwise it keeps old parameters
+ *          and retries on next call, so it never waits.
+ */
+typedef struct
+{
+    _Atomic uint32_t    seq;        /**<Update sequence, odd while update in progress */
+    uint32_t            applied;    /**<Sequence of parameters in use by sample path */
+} filter_seqlock_t;
+
+#endif
+
 /**
  *     RC Filter data
  */
 typedef struct filter_rc_s
 {
-    float32_t * p_y;        /**<Output of filter + previous values */
-    float32_t   alpha;      /**<Filter smoothing factor */
-    float32_t   fc;         /**<Filter cutoff frequency */
-    float32_t   fs;         /**<Filter sampling frequency */
-    uint8_t     order;      /**<Filter order - number of cascaded filter */
-    bool        is_init;    /**<Filter instance initialization success flag */
+    float32_t       * p_y;          /**<Output of filter + previous values */
+    float32_t         alpha;        /**<Filter smoothing factor */
+    float32_t         fc;           /**<Filter cutoff frequency */
+    float32_t         fs;           /**<Filter sampling frequency */
+    float32_t         w_scale;      /**<Cutoff to normalized angular frequency factor (2*pi/fs) */
+    #if ( 1 == FILTER_CFG_ATOMIC_EN )
+        float32_t         alpha_new;    /**<Filter smoothing factor set by concurrent setter */
+        float32_t         fc_new;       /**<Filter cutoff frequency set by concurrent setter */
+        filter_seqlock_t  lock;         /**<Concurrent parameter update lock */
+        _Atomic float32_t fc_pend;      /**<Cutoff frequency set by deferred setter */
+        _Atomic bool      fc_dirty;     /**<Deferred cutoff not yet applied */
+    #endif
+    uint8_t           order;        /**<Filter order - number of cascaded filter */
+    bool              is_init;      /**<Filter instance initialization success flag */
 } filter_rc_t;
 
 /**
@@ -74,13 +208,21 @@ typedef struct filter_rc_s
  */
 typedef struct filter_cr_s
 {
-    float32_t * p_y;        /**<Output of filter + previous values */
-    float32_t * p_x;        /**<Input of filter + previous values */
-    float32_t   alpha;      /**<Filter smoothing factor */
-    float32_t   fc;         /**<Filter cutoff frequency */
-    float32_t   fs;         /**<Filter sampling frequency */
-    uint8_t     order;      /**<Filter order - number of cascaded filter */
-    bool        is_init;    /**<Filter instance initialization success flag */
+    float32_t       * p_y;          /**<Output of filter + previous values */
+    float32_t       * p_x;          /**<Input of filter + previous values */
+    float32_t         alpha;        /**<Filter smoothing factor */
+    float32_t         fc;           /**<Filter cutoff frequency */
+    float32_t         fs;           /**<Filter sampling frequency */
+    float32_t         w_scale;      /**<Cutoff to normalized angular frequency factor (2*pi/fs) */
+    #if ( 1 == FILTER_CFG_ATOMIC_EN )
+        float32_t         alpha_new;    /**<Filter smoothing factor set by concurrent setter */
+        float32_t         fc_new;       /**<Filter cutoff frequency set by concurrent setter */
+        filter_seqlock_t  lock;         /**<Concurrent parameter update lock */
+        _Atomic float32_t fc_pend;      /**<Cutoff frequency set by deferred setter */
+        _Atomic bool      fc_dirty;     /**<Deferred cutoff not yet applied */
+    #endif
+    uint8_t           order;        /**<Filter order - number of cascaded filter */
+    bool              is_init;      /**<Filter instance initialization success flag */
 } filter_cr_t;
 
 /**
@@ -90,6 +232,11 @@ typedef struct filter_fir_s
 {
     p_ring_buffer_t   p_x;          /**<Previous values of input filter */
     float32_t       * p_a;          /**<Filter coefficients */
+    #if ( 1 == FILTER_CFG_ATOMIC_EN )
+        float32_t       * p_a_new;      /**<Filter coefficients set by concurrent setter */
+        float32_t       * p_a_stage;    /**<Sample path copy of concurrently set coefficients */
+        filter_seqlock_t  lock;         /**<Concurrent parameter update lock */
+    #endif
     uint32_t          order;        /**<Number of FIR filter taps - order of filter */
     bool              is_init;      /**<Filter instance initialization success flag */
 } filter_fir_t;
@@ -102,9 +249,40 @@ typedef struct filter_iir_s
     p_ring_buffer_t     p_y;            /**<Previous values of filter outputs */
     p_ring_buffer_t     p_x;            /**<Previous values of filter inputs*/
     filter_iir_coeff_t  coeff;          /**<Filter coefficients */
+    #if ( 1 == FILTER_CFG_ATOMIC_EN )
+        float32_t         * p_coeff_new;    /**<Poles followed by zeros set by concurrent setter */
+        float32_t         * p_coeff_stage;  /**<Sample path copy of concurrently set coefficients */
+        filter_seqlock_t    lock;           /**<Concurrent parameter update lock */
+    #endif
     bool                is_init;        /**<Filter instance initialization success flag */
 } filter_iir_t;
 
+/**
+ *     SOS section data
+ *
+ * @note    Coefficients are normalized to b0 = a0 = 1, b0 of all sections
+ *          is in filter gain.
+ */
+typedef struct
+{
+    float32_t   b[2];           /**<Numerator coefficients b1, b2 */
+    float32_t   a[2];           /**<Denominator coefficients a1, a2 */
+    float32_t   w[2];           /**<Direct form II states w[n-1], w[n-2] */
+    uint8_t     num_of_zero;    /**<Numerator order */
+    uint8_t     num_of_pole;    /**<Denominator order */
+} filter_sos_sect_t;
+
+/**
+ *     SOS (cascade of 1st/2nd order sections) filter data
+ */
+typedef struct filter_sos_s
+{
+    filter_sos_sect_t * p_sect;         /**<Sections, in cascade order */
+    float32_t           gain;           /**<Gain, product of section b0/a0 */
+    uint32_t            num_of_sect;    /**<Number of sections */
+    bool                is_init;        /**<Filter instance initialization success flag */
+} filter_sos_t;
+
 /**
  *     Boolean Filter data
  */
@@ -116,6 +294,254 @@ typedef struct filter_bool_s
     bool            is_init;    /**<Filter instance initialization success flag */
 } filter_bool_t;
 
+/**
+ *     Integer Boolean Filter data
+ */
+typedef struct filter_bool_cnt_s
+{
+    float32_t        fc;            /**<Filter cutoff frequency */
+    float32_t        fs;            /**<Filter sampling frequency */
+    int32_t          acc;           /**<Leaky integrator state in Q30 */
+    int32_t          alpha;         /**<Leaky integrator coefficient in Q30 */
+    int32_t          lvl_on;        /**<Comparator on level in Q30 */
+    int32_t          lvl_off;       /**<Comparator off level in Q30 */
+    #if ( 1 == FILTER_CFG_ATOMIC_EN )
+        float32_t        fc_new;        /**<Filter cutoff frequency set by concurrent setter */
+        int32_t          alpha_new;     /**<Leaky integrator coefficient set by concurrent setter */
+        int32_t          lvl_on_new;    /**<Comparator on level set by concurrent setter */
+        int32_t          lvl_off_new;   /**<Comparator off level set by concurrent setter */
+        filter_seqlock_t lock;          /**<Concurrent parameter update lock */
+    #endif
+    bool             y;             /**<Output value of comparator/filter */
+    bool             is_init;       /**<Filter instance initialization success flag */
+} filter_bool_cnt_t;
+
+/**
+ *     Boolean Filter bank data
+ *
+ * @note    Channels are bit-sliced: each channel is one bit of 64-bit word
+ *          and its integrator is spread over "num_of_planes" words,
+ *          plane "b" holding bit "b" of integrator of all 64 channels:
+ *          p_acc[ word * num_of_planes + b ]
+ */
+typedef struct filter_bool_bank_s
+{
+    uint64_t  * p_acc;          /**<Leaky integrator bit planes */
+    uint64_t  * p_y;            /**<Output of comparator/filter, one bit per channel */
+    float32_t   fc;             /**<Filter cutoff frequency */
+    float32_t   fs;             /**<Filter sampling frequency */
+    uint32_t    lvl_on;         /**<Comparator on level */
+    uint32_t    lvl_off;        /**<Comparator off level */
+    uint32_t    num_of_ch;      /**<Number of channels */
+    uint32_t    num_of_words;   /**<Number of 64-bit words */
+    uint8_t     num_of_planes;  /**<Number of integrator bit planes */
+    uint8_t     shift;          /**<Integrator shift, alpha = 2^-shift */
+    bool        is_init;        /**<Filter instance initialization success flag */
+} filter_bool_bank_t;
+
+/**
+ *     RC Filter bank data
+ *
+ * @note    Stage outputs are stored stage by stage, each stage holding
+ *          contiguous array of all channels: p_y[ stage * num_of_ch + ch ]
+ */
+typedef struct filter_rc_bank_s
+{
+    float32_t        * p_y;         /**<Output of filter stages for all channels */
+    float32_t        * p_alpha;     /**<Filter smoothing factor per channel */
+    float32_t        * p_fc;        /**<Filter cutoff frequency per channel */
+    #if ( 1 == FILTER_CFG_ATOMIC_EN )
+        float32_t        * p_par_new;   /**<Smoothing factors followed by cutoffs set by concurrent setter */
+        float32_t        * p_par_stage; /**<Sample path copy of concurrently set parameters */
+        filter_seqlock_t   lock;        /**<Concurrent parameter update lock */
+    #endif
+    float32_t          fs;          /**<Filter sampling frequency */
+    uint32_t           num_of_ch;   /**<Number of channels */
+    uint8_t            order;       /**<Filter order - number of cascaded filter */
+    bool               is_init;     /**<Filter instance initialization success flag */
+} filter_rc_bank_t;
+
+/**
+ *     CR Filter bank data
+ *
+ * @note    Stage inputs and outputs are stored stage by stage, each stage
+ *          holding contiguous array of all channels: p_y[ stage * num_of_ch + ch ]
+ */
+typedef struct filter_cr_bank_s
+{
+    float32_t        * p_y;         /**<Output of filter stages for all channels */
+    float32_t        * p_x;         /**<Input of filter stages for all channels */
+    float32_t        * p_alpha;     /**<Filter smoothing factor per channel */
+    float32_t        * p_fc;        /**<Filter cutoff frequency per channel */
+    #if ( 1 == FILTER_CFG_ATOMIC_EN )
+        float32_t        * p_par_new;   /**<Smoothing factors followed by cutoffs set by concurrent setter */
+        float32_t        * p_par_stage; /**<Sample path copy of concurrently set parameters */
+        filter_seqlock_t   lock;        /**<Concurrent parameter update lock */
+    #endif
+    float32_t          fs;          /**<Filter sampling frequency */
+    uint32_t           num_of_ch;   /**<Number of channels */
+    uint8_t            order;       /**<Filter order - number of cascaded filter */
+    bool               is_init;     /**<Filter instance initialization success flag */
+} filter_cr_bank_t;
+
+/**
+ *     Band (CR + RC) filter data
+ */
+typedef struct filter_band_s
+{
+    float32_t        * p_y_cr;          /**<Output of CR stages */
+    float32_t        * p_x_cr;          /**<Input of CR stages */
+    float32_t        * p_y_rc;          /**<Output of RC stages */
+    float32_t          alpha_cr;        /**<CR stages smoothing factor */
+    float32_t          alpha_rc;        /**<RC stages smoothing factor */
+    float32_t          fc_cr;           /**<CR (high-pass) cutoff frequency */
+    float32_t          fc_rc;           /**<RC (low-pass) cutoff frequency */
+    float32_t          fs;              /**<Filter sampling frequency */
+    #if ( 1 == FILTER_CFG_ATOMIC_EN )
+        float32_t          alpha_cr_new;    /**<CR stages smoothing factor set by concurrent setter */
+        float32_t          alpha_rc_new;    /**<RC stages smoothing factor set by concurrent setter */
+        float32_t          fc_cr_new;       /**<CR cutoff frequency set by concurrent setter */
+        float32_t          fc_rc_new;       /**<RC cutoff frequency set by concurrent setter */
+        filter_seqlock_t   lock;            /**<Concurrent parameter update lock */
+    #endif
+    uint8_t            order_cr;        /**<Number of cascaded CR filters */
+    uint8_t            order_rc;        /**<Number of cascaded RC filters */
+    bool               is_init;         /**<Filter instance initialization success flag */
+} filter_band_t;
+
+/**
+ *     Integer DC blocker data
+ */
+typedef struct filter_dcb_s
+{
+    int32_t     x1;         /**<Previous input */
+    int32_t     y1;         /**<Previous output */
+    int32_t     e;          /**<Feedback fractional part carried to next sample */
+    int32_t     r;          /**<Pole in Q15 format */
+    float32_t   fc;         /**<Filter cutoff frequency */
+    float32_t   fs;         /**<Filter sampling frequency */
+    bool        is_init;    /**<Filter instance initialization success flag */
+} filter_dcb_t;
+
+/**
+ *     Integer DC blocker bank data
+ */
+typedef struct filter_dcb_bank_s
+{
+    int32_t   * p_x1;       /**<Previous input for all channels */
+    int32_t   * p_y1;       /**<Previous output for all channels */
+    int32_t   * p_e;        /**<Feedback fractional part for all channels */
+    int32_t     r;          /**<Pole in Q15 format */
+    float32_t   fc;         /**<Filter cutoff frequency */
+    float32_t   fs;         /**<Filter sampling frequency */
+    uint32_t    num_of_ch;  /**<Number of channels */
+    bool        is_init;    /**<Filter instance initialization success flag */
+} filter_dcb_bank_t;
+
+/**
+ *     One-euro (adaptive cutoff RC) filter data
+ */
+typedef struct filter_euro_s
+{
+    float32_t   y;          /**<Output of filter */
+    float32_t   dy;         /**<Filtered derivative of input signal */
+    float32_t   alpha_d;    /**<Derivative filter smoothing factor */
+    float32_t   fc_min;     /**<Minimum cutoff frequency */
+    float32_t   beta;       /**<Cutoff frequency increase per unit of derivative */
+    float32_t   fs;         /**<Filter sampling frequency */
+    float32_t   w_scale;    /**<Cutoff to normalized angular frequency factor (2*pi/fs) */
+    bool        is_init;    /**<Filter instance initialization success flag */
+} filter_euro_t;
+
+/**
+ *     One-euro (adaptive cutoff RC) filter bank data
+ */
+typedef struct filter_euro_bank_s
+{
+    float32_t * p_y;        /**<Output of filter for all channels */
+    float32_t * p_dy;       /**<Filtered derivative of input signal for all channels */
+    float32_t   alpha_d;    /**<Derivative filter smoothing factor */
+    float32_t   fc_min;     /**<Minimum cutoff frequency */
+    float32_t   beta;       /**<Cutoff frequency increase per unit of derivative */
+    float32_t   fs;         /**<Filter sampling frequency */
+    float32_t   w_scale;    /**<Cutoff to normalized angular frequency factor (2*pi/fs) */
+    uint32_t    num_of_ch;  /**<Number of channels */
+    bool        is_init;    /**<Filter instance initialization success flag */
+} filter_euro_bank_t;
+
+/**
+ *     Generic filter data
+ */
+typedef struct filter_s
+{
+    const filter_iface_t  * p_iface;    /**<Filter interface */
+    void                  * p_inst;     /**<Filter instance */
+    bool                    is_init;    /**<Filter instance initialization success flag */
+} filter_t;
+
+/**
+ *     Filter pipeline data
+ */
+typedef struct filter_pipe_s
+{
+    p_filter_t    * p_stage;        /**<Pipeline stages */
+    float32_t     * p_tile;         /**<Scratch tiles, two of FILTER_PIPE_TILE_SIZE */
+    uint32_t        num_of_stages;  /**<Number of stages */
+    bool            is_init;        /**<Filter instance initialization success flag */
+} filter_pipe_t;
+
+/**
+ *     LTI stages fusion complex number
+ */
+typedef struct
+{
+    double  re;     /**<Real part */
+    double  im;     /**<Imaginary part */
+} filter_fuse_cplx_t;
+
+/**
+ *     LTI stages fusion zeros, poles and gain of cascade
+ *
+ * @note    Roots are in z-plane, gain is gain of monic factors
+ *          ( 1 - r*z^-1 ).
+ */
+typedef struct
+{
+    filter_fuse_cplx_t  * p_zero;                           /**<Zeros */
+    filter_fuse_cplx_t  * p_pole;                           /**<Poles */
+    filter_fuse_cplx_t    h_ref[ FILTER_FUSE_NUM_OF_FREQ ]; /**<Response of stages, for check of fused filter */
+    double              * p_poly;                           /**<Scratch, stage polynomial */
+    double              * p_q;                              /**<Scratch, monic polynomial */
+    bool                * p_taken;                          /**<Scratch, root pairing flags */
+    double                gain;                             /**<Gain */
+    uint32_t              num_of_zero;                      /**<Number of zeros */
+    uint32_t              num_of_pole;                      /**<Number of poles */
+    bool                  is_valid;                         /**<All stage polynomials factored */
+} filter_fuse_zpk_t;
+
+/**
+ *     LTI stages fusion real factor, ( 1 + c0*z^-1 [+ c1*z^-2] )
+ */
+typedef struct
+{
+    filter_fuse_cplx_t  root;       /**<Root, with positive imaginary part for complex pair */
+    double              c[2];       /**<Factor coefficients c0, c1 */
+    uint8_t             deg;        /**<Factor degree, 1 real root, 2 complex pair */
+    bool                is_used;    /**<Factor taken by section */
+} filter_fuse_unit_t;
+
+/**
+ *     LTI stages fusion section
+ */
+typedef struct
+{
+    filter_fuse_cplx_t  pole;           /**<Representative pole, 0 for zero only section */
+    double              b[2];           /**<Numerator coefficients b1, b2 */
+    double              a[2];           /**<Denominator coefficients a1, a2 */
+    uint8_t             num_of_zero;    /**<Numerator order */
+    uint8_t             num_of_pole;    /**<Denominator order */
+} filter_fuse_sect_t;
+
 ////////////////////////////////////////////////////////////////////////////////
 // Variables
 ////////////////////////////////////////////////////////////////////////////////
@@ -126,6 +552,137 @@ typedef struct filter_bool_s
 static filter_status_t  filter_rc_calculate_alpha   (const float32_t fc, const float32_t fs, float32_t * const p_alpha);
 static filter_status_t  filter_cr_calculate_alpha   (const float32_t fc, const float32_t fs, float32_t * const p_alpha);
 static void             filter_buf_fill             (const p_ring_buffer_t buf_inst, const float32_t val);
+static inline float32_t filter_fast_recip           (const float32_t x);
+static inline float32_t filter_fast_fc_lim          (const float32_t fc, const float32_t fs);
+static inline float32_t filter_fast_w               (const float32_t fc, const float32_t w_scale);
+static inline float32_t filter_fast_exp_neg         (const float32_t u);
+static inline float32_t filter_rc_dt_alpha          (const float32_t wdt);
+static inline float32_t filter_band_step            (filter_band_t * const p_band, const float32_t in);
+static filter_status_t  filter_bool_cnt_calc_par     (const float32_t fc, const float32_t fs, const float32_t comp_lvl, filter_bool_cnt_t * const p_filter);
+static inline int32_t   filter_bool_cnt_step         (const int32_t acc, const int32_t x, const int32_t alpha);
+static bool             filter_bool_cnt_sim          (const float32_t alpha, const int32_t alpha_q, const float32_t comp_lvl, int32_t * const p_lvl_on, int32_t * const p_lvl_off);
+static bool             filter_bool_bank_sim         (const uint8_t shift, const uint8_t num_of_planes, const uint32_t num_of_steps, uint32_t * const p_lvl_on, uint32_t * const p_lvl_off);
+static filter_status_t  filter_bool_bank_calc_par    (const float32_t fc, const float32_t fs, const float32_t comp_lvl, filter_bool_bank_t * const p_bank);
+static inline uint64_t  filter_bool_bank_acc_ge      (const uint64_t * const p_acc, const uint8_t num_of_planes, const uint32_t val);
+static uint64_t         filter_bool_bank_word       (filter_bool_bank_t * const p_bank, const uint32_t w, const uint64_t in);
+static uint32_t         filter_bool_edges_add       (const uint64_t y, const uint64_t y_prev, const uint32_t idx_base, filter_bool_edge_t * const p_edge, const uint32_t max_edges, uint32_t num_of_edges);
+static filter_status_t  filter_dcb_calc_pole        (const float32_t fc, const float32_t fs, int32_t * const p_r);
+static inline int16_t   filter_dcb_step             (int32_t * const p_x1, int32_t * const p_y1, int32_t * const p_e, const int32_t r, const int16_t in);
+static void             filter_dcb_bank_frame       (filter_dcb_bank_t * const p_bank, const int16_t * const p_in, int16_t * const p_out);
+static inline float32_t filter_euro_step            (float32_t * const p_y, float32_t * const p_dy, const float32_t in, const filter_euro_t * const p_par);
+static filter_status_t  filter_euro_par_calc        (filter_euro_t * const p_par, const float32_t fc_min, const float32_t beta, const float32_t fc_d, const float32_t fs);
+static void             filter_rc_block_stage_4     (float32_t * const p_y, const float32_t alpha, const float32_t * const p_in, float32_t * const p_out, const uint32_t size);
+static void             filter_rc_block_stage_1     (float32_t * const p_y, const float32_t alpha, const float32_t * const p_in, float32_t * const p_out, const uint32_t size);
+static void             filter_cr_block_stage_4     (float32_t * const p_y, float32_t * const p_x, const float32_t alpha, const float32_t * const p_in, float32_t * const p_out, const uint32_t size);
+static filter_status_t  filter_rc_calculate_alpha_vec   (const float32_t * const p_fc, const float32_t fs, float32_t * const p_alpha, const uint32_t num_of_ch);
+static filter_status_t  filter_cr_calculate_alpha_vec   (const float32_t * const p_fc, const float32_t fs, float32_t * const p_alpha, const uint32_t num_of_ch);
+static bool             filter_bank_fc_is_valid         (const float32_t * const p_fc, const float32_t fs, const uint32_t num_of_ch);
+static void             filter_cr_block_stage_1     (float32_t * const p_y, float32_t * const p_x, const float32_t alpha, const float32_t * const p_in, float32_t * const p_out, const uint32_t size);
+
+static filter_status_t  filter_rc_if_hndl           (void * const p_inst, const float32_t in, float32_t * const p_out);
+static filter_status_t  filter_rc_if_block          (void * const p_inst, const float32_t * const p_in, float32_t * const p_out, const uint32_t size);
+static filter_status_t  filter_rc_if_reset          (void * const p_inst);
+static uint32_t         filter_rc_if_state_size     (const void * const p_inst);
+static float32_t        filter_rc_if_fs_get         (const void * const p_inst);
+static filter_status_t  filter_cr_if_hndl           (void * const p_inst, const float32_t in, float32_t * const p_out);
+static filter_status_t  filter_cr_if_block          (void * const p_inst, const float32_t * const p_in, float32_t * const p_out, const uint32_t size);
+static filter_status_t  filter_cr_if_reset          (void * const p_inst);
+static uint32_t         filter_cr_if_state_size     (const void * const p_inst);
+static float32_t        filter_cr_if_fs_get         (const void * const p_inst);
+static filter_status_t  filter_fir_if_hndl          (void * const p_inst, const float32_t in, float32_t * const p_out);
+static filter_status_t  filter_fir_if_block         (void * const p_inst, const float32_t * const p_in, float32_t * const p_out, const uint32_t size);
+static filter_status_t  filter_fir_if_reset         (void * const p_inst);
+static uint32_t         filter_fir_if_state_size    (const void * const p_inst);
+static filter_status_t  filter_iir_if_hndl          (void * const p_inst, const float32_t in, float32_t * const p_out);
+static filter_status_t  filter_iir_if_block         (void * const p_inst, const float32_t * const p_in, float32_t * const p_out, const uint32_t size);
+static filter_status_t  filter_iir_if_reset         (void * const p_inst);
+static uint32_t         filter_iir_if_state_size    (const void * const p_inst);
+static filter_status_t  filter_sos_if_hndl          (void * const p_inst, const float32_t in, float32_t * const p_out);
+static filter_status_t  filter_sos_if_block         (void * const p_inst, const float32_t * const p_in, float32_t * const p_out, const uint32_t size);
+static filter_status_t  filter_sos_if_reset         (void * const p_inst);
+static uint32_t         filter_sos_if_state_size    (const void * const p_inst);
+static uint8_t          filter_sos_poly_order       (const float32_t * const p_c);
+static inline float32_t filter_sos_sect_hndl        (filter_sos_sect_t * const p_sect, const float32_t x);
+static filter_status_t  filter_bool_if_hndl         (void * const p_inst, const float32_t in, float32_t * const p_out);
+static filter_status_t  filter_bool_if_block        (void * const p_inst, const float32_t * const p_in, float32_t * const p_out, const uint32_t size);
+static filter_status_t  filter_bool_if_reset        (void * const p_inst);
+static uint32_t         filter_bool_if_state_size   (const void * const p_inst);
+static float32_t        filter_bool_if_fs_get       (const void * const p_inst);
+static filter_status_t  filter_band_if_hndl         (void * const p_inst, const float32_t in, float32_t * const p_out);
+static filter_status_t  filter_band_if_block        (void * const p_inst, const float32_t * const p_in, float32_t * const p_out, const uint32_t size);
+static filter_status_t  filter_band_if_reset        (void * const p_inst);
+static uint32_t         filter_band_if_state_size   (const void * const p_inst);
+static float32_t        filter_band_if_fs_get       (const void * const p_inst);
+static filter_status_t  filter_euro_if_hndl         (void * const p_inst, const float32_t in, float32_t * const p_out);
+static filter_status_t  filter_euro_if_block        (void * const p_inst, const float32_t * const p_in, float32_t * const p_out, const uint32_t size);
+static filter_status_t  filter_euro_if_reset        (void * const p_inst);
+static uint32_t         filter_euro_if_state_size   (const void * const p_inst);
+static float32_t        filter_euro_if_fs_get       (const void * const p_inst);
+static filter_status_t  filter_from_iface           (p_filter_t * p_filter_inst, const filter_iface_t * const p_iface, void * const p_inst, const bool is_inst_init);
+
+#if ( 1 == FILTER_CFG_ATOMIC_EN )
+static void             filter_seqlock_init         (filter_seqlock_t * const p_lock);
+static void             filter_seqlock_write_begin  (filter_seqlock_t * const p_lock);
+static void             filter_seqlock_write_end    (filter_seqlock_t * const p_lock);
+static inline bool      filter_seqlock_read_begin   (filter_seqlock_t * const p_lock, uint32_t * const p_seq);
+static inline bool      filter_seqlock_read_end     (filter_seqlock_t * const p_lock, const uint32_t seq);
+static inline bool      filter_seqlock_is_pending   (filter_seqlock_t * const p_lock);
+static bool             filter_seqlock_publish_begin(filter_seqlock_t * const p_lock, uint32_t * const p_seq);
+static void             filter_seqlock_publish_end  (filter_seqlock_t * const p_lock, const uint32_t seq);
+static void             filter_rc_param_apply       (filter_rc_t * const p_rc);
+static void             filter_cr_param_apply       (filter_cr_t * const p_cr);
+static void             filter_fir_param_apply      (filter_fir_t * const p_fir);
+static void             filter_iir_param_apply      (filter_iir_t * const p_iir);
+static void             filter_rc_bank_param_apply  (filter_rc_bank_t * const p_bank);
+static void             filter_cr_bank_param_apply  (filter_cr_bank_t * const p_bank);
+static void             filter_band_param_apply     (filter_band_t * const p_band);
+static void             filter_bool_cnt_param_apply (filter_bool_cnt_t * const p_filter);
+static void             filter_rc_param_publish     (filter_rc_t * const p_rc);
+static void             filter_cr_param_publish     (filter_cr_t * const p_cr);
+static void             filter_fir_param_publish    (filter_fir_t * const p_fir);
+static void             filter_iir_param_publish    (filter_iir_t * const p_iir);
+static void             filter_rc_bank_param_publish(filter_rc_bank_t * const p_bank);
+static void             filter_cr_bank_param_publish(filter_cr_bank_t * const p_bank);
+static void             filter_band_param_publish   (filter_band_t * const p_band);
+static void             filter_bool_cnt_param_publish   (filter_bool_cnt_t * const p_filter);
+#else
+    // Parameters set in sample path are in use immediately, nothing to apply or publish
+    #define filter_rc_param_apply(p_rc)                 ((void) 0 )
+    #define filter_cr_param_apply(p_cr)                 ((void) 0 )
+    #define filter_fir_param_apply(p_fir)               ((void) 0 )
+    #define filter_iir_param_apply(p_iir)               ((void) 0 )
+    #define filter_rc_bank_param_apply(p_bank)          ((void) 0 )
+    #define filter_cr_bank_param_apply(p_bank)          ((void) 0 )
+    #define filter_band_param_apply(p_band)             ((void) 0 )
+    #define filter_bool_cnt_param_apply(p_filter)       ((void) 0 )
+    #define filter_rc_param_publish(p_rc)               ((void) 0 )
+    #define filter_cr_param_publish(p_cr)               ((void) 0 )
+    #define filter_fir_param_publish(p_fir)             ((void) 0 )
+    #define filter_iir_param_publish(p_iir)             ((void) 0 )
+    #define filter_rc_bank_param_publish(p_bank)        ((void) 0 )
+    #define filter_cr_bank_param_publish(p_bank)        ((void) 0 )
+    #define filter_band_param_publish(p_band)           ((void) 0 )
+    #define filter_bool_cnt_param_publish(p_filter)     ((void) 0 )
+#endif
+
+static bool             filter_pipe_can_fuse        (const filter_t * const p_first, const filter_t * const p_second);
+static void             filter_pipe_cr_iir_fused    (filter_cr_t * const p_cr, filter_iir_t * const p_iir, const float32_t * const p_in, float32_t * const p_out, const uint32_t size);
+
+static filter_status_t  filter_fuse_stage_info      (const filter_t * const p_stage, uint32_t * const p_num_deg, uint32_t * const p_den_deg, uint32_t * const p_ops, uint32_t * const p_states);
+static void             filter_sos_coeff_cost       (const filter_sos_coeff_t * const p_sect, const uint32_t num_of_sect, uint32_t * const p_ops, uint32_t * const p_states);
+static inline filter_fuse_cplx_t filter_fuse_cplx_mul   (const filter_fuse_cplx_t a, const filter_fuse_cplx_t b);
+static inline filter_fuse_cplx_t filter_fuse_cplx_div   (const filter_fuse_cplx_t a, const filter_fuse_cplx_t b);
+static inline double    filter_fuse_cplx_dist       (const filter_fuse_cplx_t a, const filter_fuse_cplx_t b);
+static filter_fuse_cplx_t filter_fuse_poly_resp     (const double * const p_poly, const uint32_t len, const double w);
+static bool             filter_fuse_roots           (const double * const p_q, const uint32_t deg, filter_fuse_cplx_t * const p_root);
+static void             filter_fuse_zpk_add         (filter_fuse_zpk_t * const p_zpk, const double * const p_poly, const uint32_t len, const bool is_pole);
+static void             filter_fuse_stage_zpk       (const filter_t * const p_stage, filter_fuse_zpk_t * const p_zpk);
+static void             filter_fuse_zpk_cancel      (filter_fuse_zpk_t * const p_zpk);
+static bool             filter_fuse_units           (const filter_fuse_cplx_t * const p_root, const uint32_t num_of_root, bool * const p_taken, filter_fuse_unit_t * const p_unit, uint32_t * const p_num_of_unit);
+static uint32_t         filter_fuse_unit_nearest    (const filter_fuse_unit_t * const p_unit, const uint32_t num_of_unit, const uint8_t deg, const filter_fuse_cplx_t root);
+static void             filter_fuse_unit_mul        (double * const p_c, uint8_t * const p_order, filter_fuse_unit_t * const p_unit);
+static uint32_t         filter_fuse_sect_build      (filter_fuse_unit_t * const p_zu, const uint32_t num_of_zu, filter_fuse_unit_t * const p_pu, const uint32_t num_of_pu, filter_fuse_sect_t * const p_sect);
+static bool             filter_fuse_resp_check      (const filter_fuse_zpk_t * const p_zpk, const filter_sos_coeff_t * const p_sect, const uint32_t num_of_sect);
 
 ////////////////////////////////////////////////////////////////////////////////
 // Functions
@@ -181,6 +738,10 @@ static filter_status_t filter_cr_calculate_alpha(const float32_t fc, const float
     {
         *p_alpha = (float32_t) (( 1.0f / ( FILTER_TWOPI * fc )) / (( 1.0f / fs ) + ( 1.0f / ( FILTER_TWOPI * fc ))));
     }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
 
     return status;
 }
@@ -210,145 +771,187 @@ static void filter_buf_fill(const p_ring_buffer_t buf_inst, const float32_t val)
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-* @} <!-- END GROUP -->
+*       Fast reciprocal approximation
+*
+* @note     Initial guess is made by manipulation of floating point exponent
+*           bits, then refined by two Newton-Raphson iterations:
+*
+*               r[k+1] = r[k] * ( 2 - x * r[k] )
+*
+*           Relative error is below 7e-6 for any positive normal x.
+*
+* @param[in]    x       - Value to invert, must be positive
+* @return       1/x approximation
 */
 ////////////////////////////////////////////////////////////////////////////////
+static inline float32_t filter_fast_recip(const float32_t x)
+{
+    uint32_t    bits    = 0U;
+    float32_t   r       = 0.0f;
+
+    // Initial guess
+    memcpy( &bits, &x, sizeof( bits ));
+    bits = ( FILTER_FAST_RECIP_MAGIC - bits );
+    memcpy( &r, &bits, sizeof( r ));
+
+    // Newton-Raphson refinement
+    r = ( r * ( 2.0f - ( x * r )));
+    r = ( r * ( 2.0f - ( x * r )));
+
+    return r;
+}
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*@addtogroup FILTER_API
-* @{ <!-- BEGIN GROUP -->
+*       Limit cutoff frequency to range [0, fs/2] for fast alpha calculation
 *
-*   Following functions are part of API calls.
+* @note     NaN cutoff frequency is limited to 0.
+*
+* @param[in]    fc      - Cutoff frequency
+* @param[in]    fs      - Sampling frequency
+* @return       fc_lim  - Limited cutoff frequency
 */
 ////////////////////////////////////////////////////////////////////////////////
+static inline float32_t filter_fast_fc_lim(const float32_t fc, const float32_t fs)
+{
+    const float32_t fc_max  = ( 0.5f * fs );
+    float32_t       fc_lim  = (( fc > 0.0f ) ? fc : 0.0f );
+
+    fc_lim = (( fc_lim < fc_max ) ? fc_lim : fc_max );
+
+    return fc_lim;
+}
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*   Initialize RC filter
+*       Calculate normalized angular cutoff frequency for fast alpha calculation
 *
-* @note Order of RC filter is represented as number of cascaded RC
-*        analog equivalent circuits!
-*
-* @note Fs and order cannot be change later!
+* @note     Result is limited to range [0, pi], meaning that cutoff frequency
+*           outside range [0, fs/2] is clamped instead of reported as error.
 *
-* @param[in]    p_filter_inst   - Pointer to RC filter instance
-* @param[in]    fc              - Filter cutoff frequency
-* @param[in]    fs              - Sample frequency
-* @param[in]    order           - Order of filter (number of cascaded filter)
-* @param[in]    init_value      - Initial value
-* @return       status          - Status of operation
+* @param[in]    fc      - Cutoff frequency
+* @param[in]    w_scale - Cutoff to normalized angular frequency factor (2*pi/fs)
+* @return       w       - Normalized angular cutoff frequency
 */
 ////////////////////////////////////////////////////////////////////////////////
-filter_status_t filter_rc_init(p_filter_rc_t * p_filter_inst, const float32_t fc, const float32_t fs, const uint8_t order, const float32_t init_value)
+static inline float32_t filter_fast_w(const float32_t fc, const float32_t w_scale)
 {
-    filter_status_t status = eFILTER_OK;
-
-    if (( NULL != p_filter_inst ) && ( order > 0UL ))
-    {
-        // Allocate space
-        *p_filter_inst          = malloc( sizeof( filter_rc_t ));
-        (*p_filter_inst)->p_y   = malloc( order  * sizeof( float32_t ));
-
-        // Check if allocation succeed
-        if  (   ( NULL != *p_filter_inst )
-            &&  ( NULL != (*p_filter_inst)->p_y ))
-        {
-            // Calculate coefficient
-            status = filter_rc_calculate_alpha( fc, fs, &(*p_filter_inst)->alpha );
+    float32_t w = ( fc * w_scale );
 
-            if ( eFILTER_OK == status )
-            {
-                // Store order & fc
-                (*p_filter_inst)->order = order;
-                (*p_filter_inst)->fc = fc;
-                (*p_filter_inst)->fs = fs;
+    w = (( w > 0.0f ) ? w : 0.0f );
+    w = (( w < FILTER_FAST_W_MAX ) ? w : FILTER_FAST_W_MAX );
 
-                // Initial value
-                for ( uint32_t i = 0; i < order; i++)
-                {
-                    (*p_filter_inst)->p_y[i] = init_value;
-                }
+    return w;
+}
 
-                // Init success
-                (*p_filter_inst)->is_init = true;
-            }
-        }
-        else
-        {
-            status = eFILTER_ERROR;
-        }
-    }
-    else
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Fast exponent approximation of negative argument: e^(-u)
+*
+* @note     Calculated as 2^t, where t = -u * log2(e). Exponent t is split
+*           into nearest integer n and fraction f within [-0.5, 0.5]. 2^n is
+*           constructed directly in floating point exponent bits and 2^f
+*           is approximated by 6th order polynomial.
+*
+*           Relative error is below 1e-5 for u within [0, 87]. For larger
+*           u result is 0.
+*
+* @param[in]    u   - Non-negative argument
+* @return       e^(-u) approximation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline float32_t filter_fast_exp_neg(const float32_t u)
+{
+    const float32_t t       = -( u * FILTER_LOG2E );
+    float32_t       exp_2n  = 0.0f;
+    float32_t       exp_2f  = 0.0f;
+    float32_t       f       = 0.0f;
+    int32_t         n       = 0;
+    uint32_t        bits    = 0U;
+
+    // Below smallest normal number
+    if ( t < -126.0f )
     {
-        status = eFILTER_ERROR;
+        return 0.0f;
     }
 
-    return status;
+    // Nearest integer (t is non-positive) and fraction
+    n = (int32_t) ( t - 0.5f );
+    f = ( t - (float32_t) n );
+
+    // 2^f, Taylor series of exp( f * ln(2) )
+    exp_2f = ( 1.0f + ( f * ( 0.693147181f + ( f * ( 0.240226507f + ( f * ( 0.0555041087f
+           + ( f * ( 0.00961812911f + ( f * ( 0.00133335581f + ( f * 0.000154035304f ))))))))))));
+
+    // 2^n
+    bits = ((uint32_t) ( n + 127 ) << 23U );
+    memcpy( &exp_2n, &bits, sizeof( exp_2n ));
+
+    return ( exp_2f * exp_2n );
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Get initialization status of RC filter
+*       Calculate RC alpha for time step dt
 *
-* @param[in]    filter_inst - RC filter instance
-* @param[out]   p_is_init   - RC filter init state
-* @return       status      - Status of operation
+* @note     Exact discretization of RC filter for input held constant
+*           during time step:
+*
+*               alpha = 1 - e^(-2*pi*fc*dt)
+*
+*           For small arguments power series is used, to avoid loss of
+*           precision when subtracting from 1. Relative error is below 1e-5.
+*
+* @param[in]    wdt     - Normalized angular cutoff: 2*pi*fc*dt
+* @return       alpha   - RC alpha
 */
 ////////////////////////////////////////////////////////////////////////////////
-filter_status_t filter_rc_is_init(p_filter_rc_t filter_inst, bool * const p_is_init)
+static inline float32_t filter_rc_dt_alpha(const float32_t wdt)
 {
-    filter_status_t status = eFILTER_OK;
+    float32_t alpha = 0.0f;
 
-    if  (   ( NULL != filter_inst )
-        &&  ( NULL != p_is_init ))
+    if ( wdt < FILTER_DT_SERIES_LIMIT )
     {
-        *p_is_init = filter_inst->is_init;
+        alpha = ( wdt * ( 1.0f - ( wdt * ( 0.5f - ( wdt * ( 0.166666667f - ( wdt * ( 0.0416666667f - ( wdt * 0.00833333333f )))))))));
     }
     else
     {
-        status = eFILTER_ERROR;
+        alpha = ( 1.0f - filter_fast_exp_neg( wdt ));
     }
 
-    return status;
+    return alpha;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Handle RC filter
+*       Calculate one-euro filter parameters
 *
-* @note This function must be called in equidistant time period defined by 1/fs!
-*
-* @param[in]    filter_inst - RC filter instance
-* @param[in]    in          - Input value
-* @param[out]   p_out       - Output (filtered) value
-* @return       status      - Status of operation
+* @param[out]   p_par   - Filter parameters
+* @param[in]    fc_min  - Minimum cutoff frequency
+* @param[in]    beta    - Cutoff frequency increase per unit of derivative
+* @param[in]    fc_d    - Derivative filter cutoff frequency
+* @param[in]    fs      - Sample frequency
+* @return       status  - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-filter_status_t filter_rc_hndl(p_filter_rc_t filter_inst, const float32_t in, float32_t * const p_out)
+static filter_status_t filter_euro_par_calc(filter_euro_t * const p_par, const float32_t fc_min, const float32_t beta, const float32_t fc_d, const float32_t fs)
 {
     filter_status_t status = eFILTER_OK;
 
-    // Check for instance and success init
-    if  (   ( NULL != filter_inst )
-        &&  ( NULL != p_out ))
+    // Check Nyquist/Shannon sampling theorem
+    if  (   ( fc_min > 0.0f )
+        &&  ( fc_min < ( fs / 2.0f ))
+        &&  ( beta >= 0.0f ))
     {
-        // Is instance init?
-        if ( true == filter_inst->is_init )
-        {
-            for ( uint32_t n = 0; n < filter_inst->order; n++)
-            {
-                if ( 0 == n )
-                {
-                    filter_inst->p_y[0] = ( filter_inst->p_y[0] + ( filter_inst->alpha * ( in - filter_inst->p_y[0] )));
-                }
-                else
-                {
-                    filter_inst->p_y[n] = ( filter_inst->p_y[n] + ( filter_inst->alpha * ( filter_inst->p_y[n-1] - filter_inst->p_y[n] )));
-                }
-            }
+        // Derivative is smoothed with fixed cutoff
+        status = filter_rc_calculate_alpha( fc_d, fs, &p_par->alpha_d );
 
-            *p_out = filter_inst->p_y[ filter_inst->order - 1U ];
+        if ( eFILTER_OK == status )
+        {
+            p_par->fc_min   = fc_min;
+            p_par->beta     = beta;
+            p_par->fs       = fs;
+            p_par->w_scale  = ( FILTER_TWOPI / fs );
         }
     }
     else
@@ -361,107 +964,182 @@ filter_status_t filter_rc_hndl(p_filter_rc_t filter_inst, const float32_t in, fl
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Reset RC filter buffers
+*       Band (CR + RC) filter single sample step
 *
-* @param[in]    filter_inst - RC filter instance
-* @param[in]    rst_value   - Reset value
-* @return       status      - Status of operation
+* @note     Each stage is calculated exactly as in "filter_cr_hndl()"
+*           and "filter_rc_hndl()".
+*
+* @param[in]    p_band  - Band filter instance
+* @param[in]    in      - Input value
+* @return       y       - Output (filtered) value
 */
 ////////////////////////////////////////////////////////////////////////////////
-filter_status_t filter_rc_reset(p_filter_rc_t filter_inst, const float32_t rst_value)
+static inline float32_t filter_band_step(filter_band_t * const p_band, const float32_t in)
 {
-    filter_status_t status  = eFILTER_OK;
+    const float32_t alpha_cr    = p_band->alpha_cr;
+    const float32_t alpha_rc    = p_band->alpha_rc;
+    float32_t       x           = in;
 
-    if ( NULL != filter_inst )
+    // CR stages
+    for ( uint32_t n = 0U; n < p_band->order_cr; n++ )
     {
-        // Is instance init?
-        if ( true == filter_inst->is_init )
-        {
-            // Initial value
-            for ( uint32_t i = 0; i < filter_inst->order; i++)
-            {
-                filter_inst->p_y[i] = rst_value;
-            }
-        }
-        else
-        {
-            status = eFILTER_ERROR;
-        }
+        const float32_t x_1 = p_band->p_x_cr[n];
+
+        p_band->p_x_cr[n] = x;
+        p_band->p_y_cr[n] = (( alpha_cr * p_band->p_y_cr[n] ) + ( alpha_cr * ( x - x_1 )));
+        x = p_band->p_y_cr[n];
     }
-    else
+
+    // RC stages
+    for ( uint32_t n = 0U; n < p_band->order_rc; n++ )
     {
-        status = eFILTER_ERROR;
+        p_band->p_y_rc[n] = ( p_band->p_y_rc[n] + ( alpha_rc * ( x - p_band->p_y_rc[n] )));
+        x = p_band->p_y_rc[n];
     }
 
-    return status;
+    return x;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Set cutoff frequency of RC filter on-the-fly
+*       Integer boolean filter leaky integrator single step
 *
-* @param[in]    filter_inst - RC filter instance
-* @param[in]    fc          - Cutoff frequency
-* @return       status      - Status of operation
+* @brief    Increment is rounded away from zero, towards input, so that
+*           integrator reaches both rails exactly instead of stalling
+*           1/alpha below the upper one.
+*
+* @param[in]    acc     - Integrator state in Q30
+* @param[in]    x       - Input in Q30
+* @param[in]    alpha   - Coefficient in Q30
+* @return       acc     - New integrator state in Q30
 */
 ////////////////////////////////////////////////////////////////////////////////
-filter_status_t filter_rc_fc_set(p_filter_rc_t filter_inst, const float32_t fc)
+static inline int32_t filter_bool_cnt_step(const int32_t acc, const int32_t x, const int32_t alpha)
 {
-    filter_status_t status     = eFILTER_OK;
-    float32_t         alpha    = 0.0f;
+    const int64_t p = ( (int64_t) ( x - acc ) * alpha );
 
-    if ( NULL != filter_inst )
+    return ( acc + (int32_t) (( p + (( p > 0 ) ? FILTER_BOOL_CNT_FRAC_MASK : 0 )) >> FILTER_BOOL_CNT_ALPHA_Q ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Simulate integer boolean filter integrator against boolean filter
+*
+* @brief    Floating RC recursion of "filter_bool_hndl()" is stepped from
+*           zero with input high until it reaches on level, while integer
+*           integrator is stepped along with it. On level is then moved
+*           (only if needed) between integrator values of that and
+*           previous sample. Off level is found the same way, stepping
+*           both from settled full scale with input low. Thus quantized
+*           integrator switches on exactly same sample as boolean filter
+*           for step input, while levels stay as close as possible to
+*           nominal ones for noise rejection.
+*
+* @param[in]        alpha       - RC alpha
+* @param[in]        alpha_q     - Integrator coefficient in Q30
+* @param[in]        comp_lvl    - Comparator level
+* @param[in,out]    p_lvl_on    - Comparator on level, nominal on input
+* @param[in,out]    p_lvl_off   - Comparator off level, nominal on input
+* @return       valid       - True if levels are valid
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool filter_bool_cnt_sim(const float32_t alpha, const int32_t alpha_q, const float32_t comp_lvl, int32_t * const p_lvl_on, int32_t * const p_lvl_off)
+{
+    float32_t   y           = 0.0f;
+    float32_t   y_top       = 0.0f;
+    float32_t   y_prev      = -1.0f;
+    int32_t     acc         = 0;
+    int32_t     acc_prev    = 0;
+    uint32_t    n           = 0U;
+    bool        valid       = true;
+
+    // Rise from zero
+    for ( n = 0U; ( n < FILTER_BOOL_CNT_SIM_MAX ) && ( y < ( 1.0f - comp_lvl )); n++ )
     {
-        // Is instance init?
-        if ( true == filter_inst->is_init )
-        {
-            // Calculate new alpha
-            status = filter_rc_calculate_alpha( fc, filter_inst->fs, &alpha );
+        y = ( y + ( alpha * ( 1.0f - y )));
+        acc_prev = acc;
+        acc = filter_bool_cnt_step( acc, FILTER_BOOL_CNT_ONE, alpha_q );
+    }
 
-            // Store data for newly set cutoff
-            if ( eFILTER_OK == status )
-            {
-                filter_inst->alpha = alpha;
-                filter_inst->fc = fc;
-            }
-        }
-        else
-        {
-            status = eFILTER_ERROR;
-        }
+    // Integrator must not reach level before boolean filter does
+    valid = (( y >= ( 1.0f - comp_lvl )) && ( acc > acc_prev ));
+    *p_lvl_on = (( *p_lvl_on > acc ) ? acc : (( *p_lvl_on <= acc_prev ) ? ( acc_prev + 1 ) : *p_lvl_on ));
+
+    // Settle, as boolean filter does on long high input
+    for ( y_top = y; ( n < FILTER_BOOL_CNT_SIM_MAX ) && ( y_top > y_prev ); n++ )
+    {
+        y_prev  = y_top;
+        y_top   = ( y_top + ( alpha * ( 1.0f - y_top )));
     }
-    else
+
+    // Fall from full scale
+    y   = y_top;
+    acc = FILTER_BOOL_CNT_ONE;
+
+    for ( n = 0U; ( n < FILTER_BOOL_CNT_SIM_MAX ) && ( y > comp_lvl ); n++ )
     {
-        status = eFILTER_ERROR;
+        y = ( y + ( alpha * ( 0.0f - y )));
+        acc_prev = acc;
+        acc = filter_bool_cnt_step( acc, 0, alpha_q );
     }
 
-    return status;
+    valid = (( true == valid ) && ( y <= comp_lvl ) && ( acc < acc_prev ));
+    *p_lvl_off = (( *p_lvl_off < acc ) ? acc : (( *p_lvl_off >= acc_prev ) ? ( acc_prev - 1 ) : *p_lvl_off ));
+
+    return (( true == valid ) && ( *p_lvl_off < *p_lvl_on ));
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Get RC filter cutoff frequency
+*       Calculate integer boolean filter coefficient and comparator levels
 *
-* @param[in]    filter_inst - RC filter instance
-* @param[out]   p_fc        - Filter cutoff frequency in Hz
+* @note     Comparator levels are calibrated so that step response switches
+*           on same sample as "filter_bool_hndl()". Nominal levels are used
+*           if calibration fails (extremely low fc/fs).
+*
+* @note     Filter parameters are changed only on success.
+*
+* @param[in]    fc          - Cutoff frequency
+* @param[in]    fs          - Sample frequency
+* @param[in]    comp_lvl    - Comparator level
+* @param[out]   p_filter    - Integer boolean filter
 * @return       status      - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-filter_status_t filter_rc_fc_get(p_filter_rc_t filter_inst, float32_t * const p_fc)
+static filter_status_t filter_bool_cnt_calc_par(const float32_t fc, const float32_t fs, const float32_t comp_lvl, filter_bool_cnt_t * const p_filter)
 {
-    filter_status_t status = eFILTER_OK;
+    filter_status_t status  = eFILTER_OK;
+    float32_t       alpha   = 0.0f;
+    float32_t       alpha_q = 0.0f;
+    int32_t         lvl_on  = 0;
+    int32_t         lvl_off = 0;
 
-    if  (   ( NULL != filter_inst )
-        &&  ( NULL != p_fc ))
+    if  (( comp_lvl > 0.0f ) && ( comp_lvl < 0.4f ))
     {
-        // Is instance init?
-        if ( true == filter_inst->is_init )
-        {
-            *p_fc = filter_inst->fc;
-        }
-        else
+        status = filter_rc_calculate_alpha( fc, fs, &alpha );
+
+        if ( eFILTER_OK == status )
         {
-            status = eFILTER_ERROR;
+            alpha_q = roundf( alpha * (float32_t) ( 1L << FILTER_BOOL_CNT_ALPHA_Q ));
+
+            // Limit to non-zero coefficient
+            alpha_q = (( alpha_q > 1.0f ) ? alpha_q : 1.0f );
+
+            // Move levels to where integrator is when boolean filter switches
+            lvl_off = (int32_t) ( comp_lvl * (float32_t) FILTER_BOOL_CNT_ONE );
+            lvl_on  = ( FILTER_BOOL_CNT_ONE - lvl_off );
+
+            if ( false == filter_bool_cnt_sim( alpha, (int32_t) alpha_q, comp_lvl, &lvl_on, &lvl_off ))
+            {
+                lvl_off = (int32_t) ( comp_lvl * (float32_t) FILTER_BOOL_CNT_ONE );
+                lvl_on  = ( FILTER_BOOL_CNT_ONE - lvl_off );
+            }
+
+            p_filter->fc        = fc;
+            p_filter->fs        = fs;
+            p_filter->alpha     = (int32_t) alpha_q;
+            p_filter->lvl_on    = lvl_on;
+            p_filter->lvl_off   = lvl_off;
         }
     }
     else
@@ -474,93 +1152,132 @@ filter_status_t filter_rc_fc_get(p_filter_rc_t filter_inst, float32_t * const p_
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Get RC filter sampling frequency
+*       Simulate boolean filter bank integrator on step input
 *
-* @param[in]    filter_inst - RC filter instance
-* @param[out]   p_fs        - Filter sampling frequency in Hz
-* @return       status      - Status of operation
+* @brief    Integrator is stepped from zero with input high for "num_of_steps"
+*           samples, giving on level. Then it is stepped from full scale
+*           with input low for "num_of_steps" samples, giving off level. Both sequences must be strictly
+*           monotonic, so that output switches exactly at step
+*           "num_of_steps" and not before.
+*
+* @param[in]    shift           - Integrator shift (alpha = 2^-shift)
+* @param[in]    num_of_planes   - Integrator width in bits
+* @param[in]    num_of_steps    - Debounce time in samples
+* @param[out]   p_lvl_on        - Comparator on level
+* @param[out]   p_lvl_off       - Comparator off level
+* @return       valid           - True if levels are valid
 */
 ////////////////////////////////////////////////////////////////////////////////
-filter_status_t filter_rc_fs_get(p_filter_rc_t filter_inst, float32_t * const p_fs)
+static bool filter_bool_bank_sim(const uint8_t shift, const uint8_t num_of_planes, const uint32_t num_of_steps, uint32_t * const p_lvl_on, uint32_t * const p_lvl_off)
 {
-    filter_status_t status = eFILTER_OK;
-
-    if  (   ( NULL != filter_inst )
-        &&  ( NULL != p_fs ))
+    const uint32_t  top     = (uint32_t) (( 1ULL << num_of_planes ) - 1ULL );
+    const uint32_t  frac    = (uint32_t) (( 1ULL << shift ) - 1ULL );
+    uint32_t        acc     = 0U;
+    uint32_t        d       = 0U;
+    bool            valid   = true;
+
+    // Rise from zero
+    for ( uint32_t n = 0U; ( n < num_of_steps ) && ( true == valid ); n++ )
     {
-        // Is instance init?
-        if ( true == filter_inst->is_init )
-        {
-            *p_fs = filter_inst->fs;
-        }
-        else
-        {
-            status = eFILTER_ERROR;
-        }
+        d = ((( top - acc ) >> shift ) + (((( top - acc ) & frac ) > 0U ) ? 1U : 0U ));
+        acc += d;
+        valid = ( d > 0U );
     }
-    else
+
+    *p_lvl_on = acc;
+
+    // Fall from full scale
+    acc = top;
+
+    for ( uint32_t n = 0U; ( n < num_of_steps ) && ( true == valid ); n++ )
     {
-        status = eFILTER_ERROR;
+        d = (( acc >> shift ) + ((( acc & frac ) > 0U ) ? 1U : 0U ));
+        acc -= d;
+        valid = ( d > 0U );
     }
 
-    return status;
+    *p_lvl_off = acc;
+
+    return (( true == valid ) && ( *p_lvl_off < *p_lvl_on ));
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*   Initialize CR filter
-*
-* @note    Order of CR filter is represented as number of cascaded CR
-*        analog equivalent circuits!
+*       Calculate boolean filter bank integrator and comparator levels
 *
-* @note Fs and order cannot be change later!
+* @brief    Boolean filter RC output, starting from one rail with input
+*           held at other rail, crosses comparator level after
+*           N = ceil( ln(comp_lvl) / ln(1 - alpha) ) samples. Bank
+*           integrator uses alpha rounded up to power of two, thus
+*           comparator levels are placed to where integrator is after N
+*           samples, giving same debounce time (but not same noise
+*           rejection). Integrator width is
+*           smallest one with strictly monotonic step response, plus
+*           FILTER_BOOL_BANK_PLANES_EXTRA planes of resolution.
 *
-* @param[in]    p_filter_inst   - Pointer to CR filter instance
-* @param[in]    fc              - Filter cutoff frequency
-* @param[in]    fs              - Sample frequency
-* @param[in]    order           - Order of filter (number of cascaded filter)
-* @return       status          - Status of operation
+* @param[in]    fc          - Cutoff frequency
+* @param[in]    fs          - Sample frequency
+* @param[in]    comp_lvl    - Comparator level
+* @param[out]   p_bank      - Boolean filter bank
+* @return       status      - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-filter_status_t filter_cr_init(p_filter_cr_t * p_filter_inst, const float32_t fc, const float32_t fs, const uint8_t order)
+static filter_status_t filter_bool_bank_calc_par(const float32_t fc, const float32_t fs, const float32_t comp_lvl, filter_bool_bank_t * const p_bank)
 {
-    filter_status_t status = eFILTER_OK;
-
-    if (( NULL != p_filter_inst ) && ( order > 0UL ))
+    filter_status_t status          = eFILTER_OK;
+    float32_t       alpha           = 0.0f;
+    uint32_t        num_of_steps    = 1U;
+    uint8_t         shift           = 0U;
+    uint8_t         num_of_planes   = 0U;
+    uint32_t        lvl_on          = 0U;
+    uint32_t        lvl_off         = 0U;
+    bool            valid           = false;
+
+    if  (( comp_lvl > 0.0f ) && ( comp_lvl < 0.4f ))
     {
-        // Allocate space
-        *p_filter_inst          = malloc( sizeof( filter_cr_t ));
-        (*p_filter_inst)->p_y   = malloc( order  * sizeof( float32_t ));
-        (*p_filter_inst)->p_x   = malloc( order  * sizeof( float32_t ));
+        status = filter_rc_calculate_alpha( fc, fs, &alpha );
 
-        // Check if allocation succeed
-        if  (   ( NULL != *p_filter_inst )
-            &&  ( NULL != (*p_filter_inst)->p_y )
-            &&  ( NULL != (*p_filter_inst)->p_x ))
+        if ( eFILTER_OK == status )
         {
-            // Calculate coefficient
-            status = filter_cr_calculate_alpha( fc, fs, &(*p_filter_inst)->alpha );
+            const float32_t steps = ceilf( logf( comp_lvl ) / logf( 1.0f - alpha ));
 
-            if ( eFILTER_OK == status )
+            if ( steps > 1.0f )
             {
-                // Store order & fc
-                (*p_filter_inst)->order = order;
-                (*p_filter_inst)->fc = fc;
+                num_of_steps = (( steps < (float32_t) UINT16_MAX ) ? (uint32_t) steps : UINT16_MAX );
 
-                // Initial value
-                for ( uint32_t i = 0; i < order; i++)
+                // Largest shift with 2^-shift >= alpha, at least one
+                shift = 1U;
+
+                while (( ldexpf( 1.0f, -(int32_t) ( shift + 1U )) >= alpha ) && ( shift < FILTER_BOOL_BANK_PLANES_MAX ))
                 {
-                    (*p_filter_inst)->p_y[i] = 0.0f;
-                    (*p_filter_inst)->p_x[i] = 0.0f;
+                    shift++;
                 }
+            }
 
-                // Init success
-                (*p_filter_inst)->is_init = true;
+            // Smallest width giving exact debounce time
+            for ( num_of_planes = (uint8_t) ( shift + 1U ); ( num_of_planes <= FILTER_BOOL_BANK_PLANES_MAX ) && ( false == valid ); num_of_planes++ )
+            {
+                valid = filter_bool_bank_sim( shift, num_of_planes, num_of_steps, &lvl_on, &lvl_off );
+            }
+
+            // Add resolution
+            num_of_planes = (uint8_t) ( num_of_planes - 1U + FILTER_BOOL_BANK_PLANES_EXTRA );
+
+            if  (   ( true == valid )
+                &&  ( num_of_planes <= FILTER_BOOL_BANK_PLANES_MAX )
+                &&  ( true == filter_bool_bank_sim( shift, num_of_planes, num_of_steps, &lvl_on, &lvl_off )))
+            {
+                p_bank->fc              = fc;
+                p_bank->fs              = fs;
+                p_bank->shift           = shift;
+                p_bank->num_of_planes   = num_of_planes;
+                p_bank->lvl_on          = lvl_on;
+                p_bank->lvl_off         = lvl_off;
+            }
+            else
+            {
+                status = eFILTER_ERROR;
             }
-        }
-        else
-        {
-            status = eFILTER_ERROR;
         }
     }
     else
@@ -573,389 +1290,7171 @@ filter_status_t filter_cr_init(p_filter_cr_t * p_filter_inst, const float32_t fc
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Get initialization status of CR filter
+*       Compare bit-sliced integrators with constant
 *
-* @param[in]    filter_inst - CR filter instance
-* @param[out]   p_is_init   - CR filter init state
-* @return       status      - Status of operation
+* @param[in]    p_acc           - Integrator bit planes of 64 channels
+* @param[in]    num_of_planes   - Number of bit planes
+* @param[in]    val             - Value to compare with
+* @return       ge              - Bit set for each channel with integrator >= val
 */
 ////////////////////////////////////////////////////////////////////////////////
-filter_status_t filter_cr_is_init(p_filter_cr_t filter_inst, bool * const p_is_init)
+static inline uint64_t filter_bool_bank_acc_ge(const uint64_t * const p_acc, const uint8_t num_of_planes, const uint32_t val)
 {
-    filter_status_t status = eFILTER_OK;
+    uint64_t gt = 0U;
+    uint64_t eq = UINT64_MAX;
 
-    if  (   ( NULL != filter_inst )
-        &&  ( NULL != p_is_init ))
-    {
-        *p_is_init = filter_inst->is_init;
-    }
-    else
+    // From MSB down
+    for ( uint32_t b = num_of_planes; b > 0U; b-- )
     {
-        status = eFILTER_ERROR;
+        if ((( val >> ( b - 1U )) & 1U ) != 0U )
+        {
+            eq &= p_acc[ b - 1U ];
+        }
+        else
+        {
+            gt |= ( eq & p_acc[ b - 1U ] );
+            eq &= ~p_acc[ b - 1U ];
+        }
     }
 
-    return status;
+    return ( gt | eq );
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Handle CR filter
+*       Handle single word (64 channels) of boolean filter bank
 *
-* @note This function must be called in equidistant time period defined by 1/fs!
+* @note     Integrator of each channel is stepped as:
 *
-* @param[in]    filter_inst - CR filter instance
-* @param[in]    in          - Input value
-* @param[out]   p_out       - Output (filtered) value
-* @return       status      - Status of operation
+*               acc += ceil( ~acc / 2^shift ),  when input is high
+*               acc -= ceil(  acc / 2^shift ),  when input is low
+*
+*           Rounding up makes integrator settle exactly at full scale and
+*           zero, as RC filter does. Both are done as single bit-sliced
+*           addition of (( acc ^ in ) >> shift ) ^ ~in with carry in ~in,
+*           toggled when any of shifted out bits is set.
+*
+* @note     Input bits above "num_of_ch" in last word are masked out, so
+*           unused channels stay low and never report edges.
+*
+* @param[in]    p_bank  - Boolean filter bank
+* @param[in]    w       - Word index
+* @param[in]    in_raw  - Input word
+* @return       y       - Output (filtered) word
 */
 ////////////////////////////////////////////////////////////////////////////////
-filter_status_t filter_cr_hndl(p_filter_cr_t filter_inst, const float32_t in, float32_t * const p_out)
+static uint64_t filter_bool_bank_word(filter_bool_bank_t * const p_bank, const uint32_t w, const uint64_t in_raw)
 {
-    filter_status_t status = eFILTER_OK;
+    const uint32_t      num_of_used     = ( p_bank->num_of_ch - ( w * 64U ));
+    const uint64_t      in              = (( num_of_used < 64U ) ? ( in_raw & (( 1ULL << num_of_used ) - 1ULL )) : in_raw );
+    const uint8_t       num_of_planes   = p_bank->num_of_planes;
+    const uint8_t       shift           = p_bank->shift;
+    uint64_t * const    p_acc           = &p_bank->p_acc[ w * num_of_planes ];
+    uint64_t            carry           = 0U;
+
+    // Shifted out bits round up
+    for ( uint32_t b = 0U; ( b < shift ) && ( b < num_of_planes ); b++ )
+    {
+        carry |= ( p_acc[b] ^ in );
+    }
 
-    // Check for instance and success init
-    if  (   ( NULL != filter_inst )
-        &&  ( NULL != p_out ))
+    carry ^= ~in;
+
+    // Ripple add, plane "b + shift" is read before it is written
+    for ( uint32_t b = 0U; b < num_of_planes; b++ )
     {
-        // Is instance init?
-        if ( true == filter_inst->is_init )
-        {
-            for ( uint32_t n = 0U; n < filter_inst->order; n++)
-            {
-                if ( 0U == n )
-                {
-                    filter_inst->p_y[0] = (( filter_inst->alpha * filter_inst->p_y[0] ) + ( filter_inst->alpha * ( in - filter_inst->p_x[0] )));
-                    filter_inst->p_x[0] = in;
-                }
-                else
-                {
-                    filter_inst->p_y[n] = (( filter_inst->alpha * filter_inst->p_y[n] ) + ( filter_inst->alpha * ( filter_inst->p_y[n-1] - filter_inst->p_x[n] )));
-                    filter_inst->p_x[n] = filter_inst->p_y[n-1];
-                }
-            }
+        const uint64_t a    = p_acc[b];
+        const uint64_t d    = ((( b + shift ) < num_of_planes ) ? ( p_acc[ b + shift ] ^ in ) : 0U );
+        const uint64_t e    = ( d ^ ~in );
+        const uint64_t t    = ( a ^ e );
 
-            *p_out = filter_inst->p_y[ filter_inst->order - 1U ];
-        }
+        p_acc[b]    = ( t ^ carry );
+        carry       = (( a & e ) | ( carry & t ));
     }
 
-    return status;
+    // Apply comparator
+    p_bank->p_y[w] |= filter_bool_bank_acc_ge( p_acc, num_of_planes, p_bank->lvl_on );
+    p_bank->p_y[w] &= filter_bool_bank_acc_ge( p_acc, num_of_planes, p_bank->lvl_off + 1U );
+
+    return p_bank->p_y[w];
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Reset CR filter buffers
+*       Add boolean filter edges of single word to edge list
 *
-* @param[in]    filter_inst - CR filter instance
-* @return       status      - Status of operation
+* @note     Edges above "max_edges" are counted but not stored.
+*
+* @param[in]    y               - New output word
+* @param[in]    y_prev          - Word of previous outputs, bit by bit
+* @param[in]    idx_base        - Index of bit 0
+* @param[out]   p_edge          - Edge list
+* @param[in]    max_edges       - Size of edge list
+* @param[in]    num_of_edges    - Number of edges before this word
+* @return       num_of_edges    - Number of edges including this word
 */
 ////////////////////////////////////////////////////////////////////////////////
-filter_status_t filter_cr_reset(p_filter_cr_t filter_inst)
+static uint32_t filter_bool_edges_add(const uint64_t y, const uint64_t y_prev, const uint32_t idx_base, filter_bool_edge_t * const p_edge, const uint32_t max_edges, uint32_t num_of_edges)
 {
-    filter_status_t status  = eFILTER_OK;
+    uint64_t edges = ( y ^ y_prev );
 
-    if ( NULL != filter_inst )
+    while ( 0U != edges )
     {
-        // Is instance init?
-        if ( true == filter_inst->is_init )
-        {
-            // Initial value
-            for ( uint32_t i = 0U; i < filter_inst->order; i++ )
+        // Lowest set bit
+        const uint64_t  lsb = ( edges & ( ~edges + 1U ));
+        uint32_t        b   = 0U;
+
+        #if defined( __GNUC__ )
+            b = (uint32_t) __builtin_ctzll( edges );
+        #else
+            while ((( edges >> b ) & 1U ) == 0U )
             {
-                filter_inst->p_y[i] = 0.0f;
-                filter_inst->p_x[i] = 0.0f;
+                b++;
             }
-        }
-        else
+        #endif
+
+        if ( num_of_edges < max_edges )
         {
-            status = eFILTER_ERROR;
+            p_edge[num_of_edges].idx    = ( idx_base + b );
+            p_edge[num_of_edges].state  = ( 0U != ( y & lsb ));
         }
-    }
-    else
-    {
-        status = eFILTER_ERROR;
+
+        num_of_edges++;
+        edges ^= lsb;
     }
 
-    return status;
+    return num_of_edges;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Set cutoff frequency of CR filter on-the-fly
+*       Calculate integer DC blocker pole
 *
-* @param[in]    filter_inst - CR filter instance
-* @param[in]    fc          - Cutoff frequency
-* @return       status      - Status of operation
+* @note     Pole equals to CR filter alpha, therefore fc and fs have same
+*           meaning as at "filter_cr_init()".
+*
+* @param[in]    fc      - Cutoff frequency
+* @param[in]    fs      - Sample frequency
+* @param[out]   p_r     - Pole in Q15 format
+* @return       status  - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-filter_status_t filter_cr_fc_set(p_filter_cr_t filter_inst, const float32_t fc)
+static filter_status_t filter_dcb_calc_pole(const float32_t fc, const float32_t fs, int32_t * const p_r)
 {
     filter_status_t status  = eFILTER_OK;
     float32_t       alpha   = 0.0f;
 
-    if ( NULL != filter_inst )
+    status = filter_cr_calculate_alpha( fc, fs, &alpha );
+
+    if ( eFILTER_OK == status )
     {
-        // Is instance init?
-        if ( true == filter_inst->is_init )
-        {
-            // Calculate new alpha
-            status = filter_cr_calculate_alpha( fc, filter_inst->fs, &alpha );
+        *p_r = (int32_t) (( alpha * (float32_t) ( 1UL << FILTER_DCB_Q )) + 0.5f );
 
-            // Store data for newly set cutoff
-            if ( eFILTER_OK == status )
-            {
-                filter_inst->alpha = alpha;
-                filter_inst->fc = fc;
-            }
-        }
-        else
+        // Pole must stay inside unit circle
+        if ( *p_r > FILTER_DCB_R_MAX )
         {
-            status = eFILTER_ERROR;
+            *p_r = FILTER_DCB_R_MAX;
         }
     }
-    else
-    {
-        status = eFILTER_ERROR;
-    }
 
     return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Get CR filter cutoff frequency
+*       Integer DC blocker single sample step
 *
-* @param[in]    filter_inst - CR filter instance
-* @param[out]   p_fc        - Filter cutoff frequency in Hz
-* @return       status      - Status of operation
+* @brief    Calculates y[n] = x[n] - x[n-1] + R*y[n-1]. Fractional part of
+*           R*y[n-1] that is lost by the shift is carried to next sample,
+*           so rounding error does not accumulate into DC offset.
+*
+* @note     Output (and stored state) is saturated to int16 range.
+*
+* @param[in,out]    p_x1    - Previous input
+* @param[in,out]    p_y1    - Previous output
+* @param[in,out]    p_e     - Feedback fractional part
+* @param[in]        r       - Pole in Q15 format
+* @param[in]        in      - Input sample
+* @return           y       - Output sample
 */
 ////////////////////////////////////////////////////////////////////////////////
-filter_status_t filter_cr_fc_get(p_filter_cr_t filter_inst, float32_t * const p_fc)
+static inline int16_t filter_dcb_step(int32_t * const p_x1, int32_t * const p_y1, int32_t * const p_e, const int32_t r, const int16_t in)
 {
-    filter_status_t status = eFILTER_OK;
+    const int32_t   p = (( r * *p_y1 ) + *p_e );
+    int32_t         y = (( (int32_t) in - *p_x1 ) + ( p >> FILTER_DCB_Q ));
 
-    if  (   ( NULL != filter_inst )
-        &&  ( NULL != p_fc ))
-    {
-        // Is instance init?
-        if ( true == filter_inst->is_init )
-        {
-            *p_fc = filter_inst->fc;
-        }
-        else
-        {
-            status = eFILTER_ERROR;
-        }
-    }
-    else
-    {
-        status = eFILTER_ERROR;
-    }
+    // Saturate
+    y = ( y > INT16_MAX ) ? INT16_MAX : y;
+    y = ( y < INT16_MIN ) ? INT16_MIN : y;
 
-    return status;
+    *p_e    = ( p & FILTER_DCB_FRAC_MASK );
+    *p_x1   = (int32_t) in;
+    *p_y1   = y;
+
+    return (int16_t) y;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Get CR filter sampling frequency
+*       Integer DC blocker bank single frame
 *
-* @param[in]    filter_inst - CR filter instance
-* @param[out]   p_fs        - Filter sampling frequency in Hz
-* @return       status      - Status of operation
+* @param[in]    p_bank  - DC blocker bank
+* @param[in]    p_in    - Input samples, one per channel
+* @param[out]   p_out   - Output samples, one per channel
+* @return       void
 */
 ////////////////////////////////////////////////////////////////////////////////
-filter_status_t filter_cr_fs_get(p_filter_cr_t filter_inst, float32_t * const p_fs)
+static void filter_dcb_bank_frame(filter_dcb_bank_t * const p_bank, const int16_t * const p_in, int16_t * const p_out)
 {
-    filter_status_t status = eFILTER_OK;
+    const uint32_t  num_of_ch   = p_bank->num_of_ch;
+    const int32_t   r           = p_bank->r;
+    uint32_t        ch          = 0U;
 
-    if  (   ( NULL != filter_inst )
-        &&  ( NULL != p_fs ))
-    {
-        // Is instance init?
-        if ( true == filter_inst->is_init )
+    #if defined( __AVX512F__ )
+        const __m512i v_r       = _mm512_set1_epi32( r );
+        const __m512i v_mask    = _mm512_set1_epi32( FILTER_DCB_FRAC_MASK );
+        const __m512i v_max     = _mm512_set1_epi32( INT16_MAX );
+        const __m512i v_min     = _mm512_set1_epi32( INT16_MIN );
+
+        for ( ; ( ch + 16U ) <= num_of_ch; ch += 16U )
         {
-            *p_fs = filter_inst->fs;
+            const __m512i v_x   = _mm512_cvtepi16_epi32( _mm256_loadu_si256((const __m256i*) &p_in[ch] ));
+            const __m512i v_x1  = _mm512_loadu_si512( &p_bank->p_x1[ch] );
+            const __m512i v_y1  = _mm512_loadu_si512( &p_bank->p_y1[ch] );
+            const __m512i v_e   = _mm512_loadu_si512( &p_bank->p_e[ch] );
+            const __m512i v_p   = _mm512_add_epi32( _mm512_mullo_epi32( v_r, v_y1 ), v_e );
+            __m512i       v_y   = _mm512_add_epi32( _mm512_sub_epi32( v_x, v_x1 ), _mm512_srai_epi32( v_p, FILTER_DCB_Q ));
+
+            v_y = _mm512_min_epi32( _mm512_max_epi32( v_y, v_min ), v_max );
+
+            _mm512_storeu_si512( &p_bank->p_e[ch], _mm512_and_si512( v_p, v_mask ));
+            _mm512_storeu_si512( &p_bank->p_x1[ch], v_x );
+            _mm512_storeu_si512( &p_bank->p_y1[ch], v_y );
+            _mm256_storeu_si256((__m256i*) &p_out[ch], _mm512_cvtepi32_epi16( v_y ));
         }
-        else
+    #elif defined( __AVX2__ )
+        const __m256i v_r       = _mm256_set1_epi32( r );
+        const __m256i v_mask    = _mm256_set1_epi32( FILTER_DCB_FRAC_MASK );
+
+        for ( ; ( ch + 8U ) <= num_of_ch; ch += 8U )
         {
-            status = eFILTER_ERROR;
+            const __m256i v_x   = _mm256_cvtepi16_epi32( _mm_loadu_si128((const __m128i*) &p_in[ch] ));
+            const __m256i v_x1  = _mm256_loadu_si256((const __m256i*) &p_bank->p_x1[ch] );
+            const __m256i v_y1  = _mm256_loadu_si256((const __m256i*) &p_bank->p_y1[ch] );
+            const __m256i v_e   = _mm256_loadu_si256((const __m256i*) &p_bank->p_e[ch] );
+            const __m256i v_p   = _mm256_add_epi32( _mm256_mullo_epi32( v_r, v_y1 ), v_e );
+            const __m256i v_y   = _mm256_add_epi32( _mm256_sub_epi32( v_x, v_x1 ), _mm256_srai_epi32( v_p, FILTER_DCB_Q ));
+
+            // Saturating pack to int16 and back for state
+            const __m128i v_out = _mm_packs_epi32( _mm256_castsi256_si128( v_y ), _mm256_extracti128_si256( v_y, 1 ));
+
+            _mm256_storeu_si256((__m256i*) &p_bank->p_e[ch], _mm256_and_si256( v_p, v_mask ));
+            _mm256_storeu_si256((__m256i*) &p_bank->p_x1[ch], v_x );
+            _mm256_storeu_si256((__m256i*) &p_bank->p_y1[ch], _mm256_cvtepi16_epi32( v_out ));
+            _mm_storeu_si128((__m128i*) &p_out[ch], v_out );
         }
-    }
-    else
+    #endif
+
+    // Remaining channels
+    for ( ; ch < num_of_ch; ch++ )
     {
-        status = eFILTER_ERROR;
+        p_out[ch] = filter_dcb_step( &p_bank->p_x1[ch], &p_bank->p_y1[ch], &p_bank->p_e[ch], r, p_in[ch] );
     }
-
-    return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*   Initialize boolean/debounce filter
-*
-* @brief    Boolean filter is basically LPF (RC filter) + comparator
-*           at the end of signal path.
+*       One-euro filter single sample step
 *
-*           Input to filter in bool and output of filer is bool. Signal
-*           in between is being converted to float either 0.0f or 1.0f. That
-*           signal then goes to LPF. Output of LPF goes to schmitt trigger
-*           comparator with configurable trip levels at init phase
+* @note     Derivative estimation, cutoff calculation and smoothing are fused
+*           into single step without divisions:
 *
-*           Input "comp_lvl" setup comparator trip level symmetrical to 0.5
-*           value. E.g.: comp_lvl = 0.1 will result in levels:
+*               dx  = ( x - y ) * fs
+*               dy  = dy + alpha_d * ( dx - dy )
+*               fc  = fc_min + beta * |dy|
+*               y   = y + alpha(fc) * ( x - y )
 *
-*               OFF -> ON:  level = 0.9
-*               ON  -> OFF: level = 0.1
+*           where alpha(fc) is fast RC alpha (see "filter_rc_fc_set_fast()").
+*           Cutoff is not limited to fs/2, as alpha = w / ( 1 + w ) stays
+*           below 1 for any cutoff and only approaches no smoothing.
 *
-* @param[in]    filter_inst - Pointer to bool filter instance
-* @param[in]    fc          - Cuttoff frequency of LPF
-* @param[in]    fs          - Sample time of filter
-* @param[in]    comp_lvl    - Comparator trip level
-* @return       status      - Status of initialization
+* @param[in]    p_y     - Pointer to filter output state
+* @param[in]    p_dy    - Pointer to filtered derivative state
+* @param[in]    in      - Input value
+* @param[in]    p_par   - Filter parameters
+* @return       y       - Output (filtered) value
 */
 ////////////////////////////////////////////////////////////////////////////////
-filter_status_t filter_bool_init(p_filter_bool_t * p_filter_inst, const float32_t fc, const float32_t fs, const float32_t comp_lvl)
+static inline float32_t filter_euro_step(float32_t * const p_y, float32_t * const p_dy, const float32_t in, const filter_euro_t * const p_par)
 {
-    filter_status_t status = eFILTER_OK;
+    const float32_t dx  = (( in - *p_y ) * p_par->fs );
+    const float32_t dy  = ( *p_dy + ( p_par->alpha_d * ( dx - *p_dy )));
+    const float32_t w   = (( p_par->fc_min + ( p_par->beta * fabsf( dy ))) * p_par->w_scale );
+    const float32_t y   = ( *p_y + (( w * filter_fast_recip( 1.0f + w )) * ( in - *p_y )));
 
-    if ( NULL != p_filter_inst )
-    {
-        // Allocate space
-        *p_filter_inst = malloc( sizeof( filter_bool_t ));
+    *p_dy   = dy;
+    *p_y    = y;
 
-        // Check if allocation succeed & valid configs
-        if  (   ( NULL != p_filter_inst )
-            &&  (( comp_lvl > 0.0f ) && ( comp_lvl < 0.4f )))
-        {
-            // Init LPF
-            status = filter_rc_init( &(*p_filter_inst)->lpf, fc, fs, 1U, 0.0f );
+    return y;
+}
 
-            if ( eFILTER_OK == status )
-            {
-                (*p_filter_inst)->comp_lvl  = comp_lvl;
-                (*p_filter_inst)->y = false;
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Process block of samples through four cascaded RC stages
+*
+* @note     All four stage states and alpha are kept in registers for
+*           the whole block. Independent stage recursions are interleaved
+*           sample by sample, so pipeline latency of each stage is hidden.
+*
+* @note     Input and output buffer can be the same (in-place).
+*
+* @param[in]    p_y     - Pointer to first of four stage states
+* @param[in]    alpha   - RC alpha
+* @param[in]    p_in    - Input samples
+* @param[out]   p_out   - Output samples
+* @param[in]    size    - Number of samples
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void filter_rc_block_stage_4(float32_t * const p_y, const float32_t alpha, const float32_t * const p_in, float32_t * const p_out, const uint32_t size)
+{
+    const float32_t beta = ( 1.0f - alpha );
+    float32_t       y0   = p_y[0];
+    float32_t       y1   = p_y[1];
+    float32_t       y2   = p_y[2];
+    float32_t       y3   = p_y[3];
 
-                // Init succeed
-                (*p_filter_inst)->is_init = true;
-            }
-        }
-        else
-        {
-            status = eFILTER_ERROR;
-        }
-    }
-    else
+    for ( uint32_t i = 0U; i < size; i++ )
     {
-        status = eFILTER_ERROR;
+        y0 = (( beta * y0 ) + ( alpha * p_in[i] ));
+        y1 = (( beta * y1 ) + ( alpha * y0 ));
+        y2 = (( beta * y2 ) + ( alpha * y1 ));
+        y3 = (( beta * y3 ) + ( alpha * y2 ));
+
+        p_out[i] = y3;
     }
 
-    return status;
+    p_y[0] = y0;
+    p_y[1] = y1;
+    p_y[2] = y2;
+    p_y[3] = y3;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Get initialization status of boolean filter
+*       Process block of samples through single RC stage
 *
-* @param[in]    filter_inst - Boolean filter instance
-* @param[out]   p_is_init   - Boolean filter init state
-* @return       status      - Status of operation
+* @note     Input and output buffer can be the same (in-place).
+*
+* @param[in]    p_y     - Pointer to stage state
+* @param[in]    alpha   - RC alpha
+* @param[in]    p_in    - Input samples
+* @param[out]   p_out   - Output samples
+* @param[in]    size    - Number of samples
+* @return       void
 */
 ////////////////////////////////////////////////////////////////////////////////
-filter_status_t filter_bool_is_init(p_filter_bool_t filter_inst, bool * const p_is_init)
+static void filter_rc_block_stage_1(float32_t * const p_y, const float32_t alpha, const float32_t * const p_in, float32_t * const p_out, const uint32_t size)
 {
-    filter_status_t status = eFILTER_OK;
+    const float32_t beta = ( 1.0f - alpha );
+    float32_t       y    = *p_y;
 
-    if  (   ( NULL != filter_inst )
-        &&  ( NULL != p_is_init ))
+    for ( uint32_t i = 0U; i < size; i++ )
     {
-        *p_is_init = filter_inst->is_init;
+        y = (( beta * y ) + ( alpha * p_in[i] ));
+        p_out[i] = y;
     }
-    else
+
+    *p_y = y;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Process block of samples through four cascaded CR stages
+*
+* @note     All four stage states and alpha are kept in registers for
+*           the whole block. Independent stage recursions are interleaved
+*           sample by sample, so pipeline latency of each stage is hidden.
+*
+* @note     Input and output buffer can be the same (in-place).
+*
+* @param[in]    p_y     - Pointer to first of four stage output states
+* @param[in]    p_x     - Pointer to first of four stage input states
+* @param[in]    alpha   - CR alpha
+* @param[in]    p_in    - Input samples
+* @param[out]   p_out   - Output samples
+* @param[in]    size    - Number of samples
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void filter_cr_block_stage_4(float32_t * const p_y, float32_t * const p_x, const float32_t alpha, const float32_t * const p_in, float32_t * const p_out, const uint32_t size)
+{
+    float32_t y0 = p_y[0];
+    float32_t y1 = p_y[1];
+    float32_t y2 = p_y[2];
+    float32_t y3 = p_y[3];
+    float32_t x0 = p_x[0];
+    float32_t x1 = p_x[1];
+    float32_t x2 = p_x[2];
+    float32_t x3 = p_x[3];
+
+    for ( uint32_t i = 0U; i < size; i++ )
     {
-        status = eFILTER_ERROR;
+        const float32_t in = p_in[i];
+
+        y0 = ( alpha * (( y0 + in ) - x0 ));
+        x0 = in;
+        y1 = ( alpha * (( y1 + y0 ) - x1 ));
+        x1 = y0;
+        y2 = ( alpha * (( y2 + y1 ) - x2 ));
+        x2 = y1;
+        y3 = ( alpha * (( y3 + y2 ) - x3 ));
+        x3 = y2;
+
+        p_out[i] = y3;
     }
 
-    return status;
+    p_y[0] = y0;
+    p_y[1] = y1;
+    p_y[2] = y2;
+    p_y[3] = y3;
+    p_x[0] = x0;
+    p_x[1] = x1;
+    p_x[2] = x2;
+    p_x[3] = x3;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Handle boolean filter
+*       Process block of samples through single CR stage
 *
-* @note This function must be called in equidistant time period defined by 1/fs!
+* @note     Input and output buffer can be the same (in-place).
 *
-* @param[in]    filter_inst - Boolean filter instance
-* @param[in]    in          - Input value
-* @param[out]   p_out       - Output (filtered) value
-* @return       status      - Status of operation
+* @param[in]    p_y     - Pointer to stage output state
+* @param[in]    p_x     - Pointer to stage input state
+* @param[in]    alpha   - CR alpha
+* @param[in]    p_in    - Input samples
+* @param[out]   p_out   - Output samples
+* @param[in]    size    - Number of samples
+* @return       void
 */
 ////////////////////////////////////////////////////////////////////////////////
-filter_status_t filter_bool_hndl(p_filter_bool_t filter_inst, const bool in, bool * const p_out)
+static void filter_cr_block_stage_1(float32_t * const p_y, float32_t * const p_x, const float32_t alpha, const float32_t * const p_in, float32_t * const p_out, const uint32_t size)
 {
-    filter_status_t status      = eFILTER_OK;
-    float32_t       filt_in     = 0.0f;
-    float32_t       filt_out    = 0.0f;
+    float32_t y = *p_y;
+    float32_t x = *p_x;
 
-    if  (   ( NULL != filter_inst )
-        &&  ( NULL != p_out ))
+    for ( uint32_t i = 0U; i < size; i++ )
     {
-        // Convert input to floating
-        filt_in = (float32_t) in;
-
-        // Apply filter
-        (void) filter_rc_hndl( filter_inst->lpf, filt_in, &filt_out );
+        const float32_t in = p_in[i];
 
-        // Apply comparator
-        if  (   ( false == filter_inst->y )
-            &&  ( filt_out >= ( 1.0f - filter_inst->comp_lvl )))
-        {
-            filter_inst->y  = true;
-        }
-        else if (   ( true == filter_inst->y )
-                &&  ( filt_out <= filter_inst->comp_lvl ))
-        {
-            filter_inst->y  = false;
-        }
-        else
-        {
-            // No actions...
-        }
+        y = ( alpha * (( y + in ) - x ));
+        x = in;
 
-        // Return output
-        *p_out = filter_inst->y;
+        p_out[i] = y;
     }
-    else
+
+    *p_y = y;
+    *p_x = x;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Check cutoff frequencies of filter bank channels
+*
+* @param[in]    p_fc        - Cutoff frequencies
+* @param[in]    fs          - Sample frequency
+* @param[in]    num_of_ch   - Number of channels
+* @return       is_valid    - True if all cutoff frequencies are within (0, fs/2)
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool filter_bank_fc_is_valid(const float32_t * const p_fc, const float32_t fs, const uint32_t num_of_ch)
+{
+    bool is_valid = ( fs > 0.0f );
+
+    for ( uint32_t ch = 0U; ch < num_of_ch; ch++ )
     {
-        status = eFILTER_ERROR;
+        // Check Nyquist/Shannon sampling theorem
+        is_valid &= (( p_fc[ch] > 0.0f ) && ( p_fc[ch] < ( fs / 2.0f )));
     }
 
-    return status;
+    return is_valid;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Reset Boolean filter buffers
+*       Calculate RC alpha for array of cutoff frequencies
 *
-* @param[in]    filter_inst - Boolean filter instance
-* @param[in]    rst_value   - Reset value
+* @note     Alpha is calculated as: alpha = 2*pi*fc / ( 2*pi*fc + fs ), which
+*           is equivalent to "filter_rc_calculate_alpha()" but requires only
+*           single division that is vectorized across channels.
+*
+* @note     Alphas are changed only if all cutoff frequencies are valid!
+*
+* @param[in]    p_fc        - Cutoff frequencies
+* @param[in]    fs          - Sample frequency
+* @param[out]   p_alpha     - RC alphas
+* @param[in]    num_of_ch   - Number of channels
 * @return       status      - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-filter_status_t filter_bool_reset(p_filter_bool_t filter_inst)
+static filter_status_t filter_rc_calculate_alpha_vec(const float32_t * const p_fc, const float32_t fs, float32_t * const p_alpha, const uint32_t num_of_ch)
 {
-    filter_status_t status = eFILTER_OK;
+    filter_status_t status  = eFILTER_OK;
+    uint32_t        ch      = 0U;
 
-    if ( NULL != filter_inst )
+    if ( true == filter_bank_fc_is_valid( p_fc, fs, num_of_ch ))
     {
-        // Is instance init?
-        if ( true == filter_inst->is_init )
-        {
-            // Reset LPF
-            (void) filter_rc_reset( filter_inst->lpf, 0.0f );
-            filter_inst->y = false;
-        }
-        else
+        #if defined( __AVX512F__ )
+            const __m512 v_twopi = _mm512_set1_ps( FILTER_TWOPI );
+            const __m512 v_fs    = _mm512_set1_ps( fs );
+
+            for ( ; ( ch + 16U ) <= num_of_ch; ch += 16U )
+            {
+                const __m512 v_w = _mm512_mul_ps( v_twopi, _mm512_loadu_ps( &p_fc[ch] ));
+                _mm512_storeu_ps( &p_alpha[ch], _mm512_div_ps( v_w, _mm512_add_ps( v_w, v_fs )));
+            }
+        #elif defined( __AVX2__ )
+            const __m256 v_twopi = _mm256_set1_ps( FILTER_TWOPI );
+            const __m256 v_fs    = _mm256_set1_ps( fs );
+
+            for ( ; ( ch + 8U ) <= num_of_ch; ch += 8U )
+            {
+                const __m256 v_w = _mm256_mul_ps( v_twopi, _mm256_loadu_ps( &p_fc[ch] ));
+                _mm256_storeu_ps( &p_alpha[ch], _mm256_div_ps( v_w, _mm256_add_ps( v_w, v_fs )));
+            }
+        #endif
+
+        // Remaining channels
+        for ( ; ch < num_of_ch; ch++ )
         {
-            status = eFILTER_ERROR;
+            const float32_t w = ( FILTER_TWOPI * p_fc[ch] );
+            p_alpha[ch] = ( w / ( w + fs ));
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Calculate CR alpha for array of cutoff frequencies
+*
+* @note     Alpha is calculated as: alpha = fs / ( 2*pi*fc + fs ), which
+*           is equivalent to "filter_cr_calculate_alpha()" but requires only
+*           single division that is vectorized across channels.
+*
+* @note     Alphas are changed only if all cutoff frequencies are valid!
+*
+* @param[in]    p_fc        - Cutoff frequencies
+* @param[in]    fs          - Sample frequency
+* @param[out]   p_alpha     - CR alphas
+* @param[in]    num_of_ch   - Number of channels
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static filter_status_t filter_cr_calculate_alpha_vec(const float32_t * const p_fc, const float32_t fs, float32_t * const p_alpha, const uint32_t num_of_ch)
+{
+    filter_status_t status  = eFILTER_OK;
+    uint32_t        ch      = 0U;
+
+    if ( true == filter_bank_fc_is_valid( p_fc, fs, num_of_ch ))
+    {
+        #if defined( __AVX512F__ )
+            const __m512 v_twopi = _mm512_set1_ps( FILTER_TWOPI );
+            const __m512 v_fs    = _mm512_set1_ps( fs );
+
+            for ( ; ( ch + 16U ) <= num_of_ch; ch += 16U )
+            {
+                const __m512 v_w = _mm512_mul_ps( v_twopi, _mm512_loadu_ps( &p_fc[ch] ));
+                _mm512_storeu_ps( &p_alpha[ch], _mm512_div_ps( v_fs, _mm512_add_ps( v_w, v_fs )));
+            }
+        #elif defined( __AVX2__ )
+            const __m256 v_twopi = _mm256_set1_ps( FILTER_TWOPI );
+            const __m256 v_fs    = _mm256_set1_ps( fs );
+
+            for ( ; ( ch + 8U ) <= num_of_ch; ch += 8U )
+            {
+                const __m256 v_w = _mm256_mul_ps( v_twopi, _mm256_loadu_ps( &p_fc[ch] ));
+                _mm256_storeu_ps( &p_alpha[ch], _mm256_div_ps( v_fs, _mm256_add_ps( v_w, v_fs )));
+            }
+        #endif
+
+        // Remaining channels
+        for ( ; ch < num_of_ch; ch++ )
+        {
+            p_alpha[ch] = ( fs / (( FILTER_TWOPI * p_fc[ch] ) + fs ));
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       RC filter generic interface: handle
+*
+* @param[in]    p_inst  - RC filter instance
+* @param[in]    in      - Input value
+* @param[out]   p_out   - Output (filtered) value
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static filter_status_t filter_rc_if_hndl(void * const p_inst, const float32_t in, float32_t * const p_out)
+{
+    return filter_rc_hndl((p_filter_rc_t) p_inst, in, p_out );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       RC filter generic interface: handle block of samples
+*
+* @param[in]    p_inst  - RC filter instance
+* @param[in]    p_in    - Input samples
+* @param[out]   p_out   - Output (filtered) samples
+* @param[in]    size    - Number of samples
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static filter_status_t filter_rc_if_block(void * const p_inst, const float32_t * const p_in, float32_t * const p_out, const uint32_t size)
+{
+    return filter_rc_hndl_block((p_filter_rc_t) p_inst, p_in, p_out, size );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       RC filter generic interface: reset
+*
+* @param[in]    p_inst  - RC filter instance
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static filter_status_t filter_rc_if_reset(void * const p_inst)
+{
+    return filter_rc_reset((p_filter_rc_t) p_inst, 0.0f );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       RC filter generic interface: state size
+*
+* @param[in]    p_inst  - RC filter instance
+* @return       size    - Size of filter data in bytes
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t filter_rc_if_state_size(const void * const p_inst)
+{
+    const filter_rc_t * const p_rc = (const filter_rc_t*) p_inst;
+
+    return (uint32_t) ( sizeof( filter_rc_t ) + ( p_rc->order * sizeof( float32_t )));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       RC filter generic interface: sampling frequency
+*
+* @param[in]    p_inst  - RC filter instance
+* @return       fs      - Filter sampling frequency
+*/
+////////////////////////////////////////////////////////////////////////////////
+static float32_t filter_rc_if_fs_get(const void * const p_inst)
+{
+    return ((const filter_rc_t*) p_inst)->fs;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       CR filter generic interface: handle
+*
+* @param[in]    p_inst  - CR filter instance
+* @param[in]    in      - Input value
+* @param[out]   p_out   - Output (filtered) value
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static filter_status_t filter_cr_if_hndl(void * const p_inst, const float32_t in, float32_t * const p_out)
+{
+    return filter_cr_hndl((p_filter_cr_t) p_inst, in, p_out );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       CR filter generic interface: handle block of samples
+*
+* @param[in]    p_inst  - CR filter instance
+* @param[in]    p_in    - Input samples
+* @param[out]   p_out   - Output (filtered) samples
+* @param[in]    size    - Number of samples
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static filter_status_t filter_cr_if_block(void * const p_inst, const float32_t * const p_in, float32_t * const p_out, const uint32_t size)
+{
+    return filter_cr_hndl_block((p_filter_cr_t) p_inst, p_in, p_out, size );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       CR filter generic interface: reset
+*
+* @param[in]    p_inst  - CR filter instance
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static filter_status_t filter_cr_if_reset(void * const p_inst)
+{
+    return filter_cr_reset((p_filter_cr_t) p_inst );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       CR filter generic interface: state size
+*
+* @param[in]    p_inst  - CR filter instance
+* @return       size    - Size of filter data in bytes
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t filter_cr_if_state_size(const void * const p_inst)
+{
+    const filter_cr_t * const p_cr = (const filter_cr_t*) p_inst;
+
+    return (uint32_t) ( sizeof( filter_cr_t ) + ( 2U * p_cr->order * sizeof( float32_t )));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       CR filter generic interface: sampling frequency
+*
+* @param[in]    p_inst  - CR filter instance
+* @return       fs      - Filter sampling frequency
+*/
+////////////////////////////////////////////////////////////////////////////////
+static float32_t filter_cr_if_fs_get(const void * const p_inst)
+{
+    return ((const filter_cr_t*) p_inst)->fs;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       FIR filter generic interface: handle
+*
+* @note     "filter_fir_hndl()" accumulates into output, therefore output
+*           is cleared first.
+*
+* @param[in]    p_inst  - FIR filter instance
+* @param[in]    in      - Input value
+* @param[out]   p_out   - Output (filtered) value
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static filter_status_t filter_fir_if_hndl(void * const p_inst, const float32_t in, float32_t * const p_out)
+{
+    *p_out = 0.0f;
+
+    return filter_fir_hndl((p_filter_fir_t) p_inst, in, p_out );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       FIR filter generic interface: handle block of samples
+*
+* @note     Output is cleared before each sample as for single sample
+*           handle. Input is read first, so in-place processing is
+*           supported.
+*
+* @param[in]    p_inst  - FIR filter instance
+* @param[in]    p_in    - Input samples
+* @param[out]   p_out   - Output (filtered) samples
+* @param[in]    size    - Number of samples
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static filter_status_t filter_fir_if_block(void * const p_inst, const float32_t * const p_in, float32_t * const p_out, const uint32_t size)
+{
+    filter_status_t status = eFILTER_OK;
+
+    for ( uint32_t i = 0U; i < size; i++ )
+    {
+        const float32_t in = p_in[i];
+
+        p_out[i] = 0.0f;
+        status |= filter_fir_hndl((p_filter_fir_t) p_inst, in, &p_out[i] );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       FIR filter generic interface: reset
+*
+* @param[in]    p_inst  - FIR filter instance
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static filter_status_t filter_fir_if_reset(void * const p_inst)
+{
+    return filter_fir_reset((p_filter_fir_t) p_inst, 0.0f );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       FIR filter generic interface: state size
+*
+* @param[in]    p_inst  - FIR filter instance
+* @return       size    - Size of filter data in bytes
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t filter_fir_if_state_size(const void * const p_inst)
+{
+    const filter_fir_t * const p_fir = (const filter_fir_t*) p_inst;
+
+    return (uint32_t) ( sizeof( filter_fir_t ) + ( p_fir->order * sizeof( float32_t )));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       IIR filter generic interface: handle
+*
+* @note     "filter_iir_hndl()" accumulates into output, therefore output
+*           is cleared first.
+*
+* @param[in]    p_inst  - IIR filter instance
+* @param[in]    in      - Input value
+* @param[out]   p_out   - Output (filtered) value
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static filter_status_t filter_iir_if_hndl(void * const p_inst, const float32_t in, float32_t * const p_out)
+{
+    *p_out = 0.0f;
+
+    return filter_iir_hndl((p_filter_iir_t) p_inst, in, p_out );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       IIR filter generic interface: handle block of samples
+*
+* @note     Output is cleared before each sample as for single sample
+*           handle. Input is read first, so in-place processing is
+*           supported.
+*
+* @param[in]    p_inst  - IIR filter instance
+* @param[in]    p_in    - Input samples
+* @param[out]   p_out   - Output (filtered) samples
+* @param[in]    size    - Number of samples
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static filter_status_t filter_iir_if_block(void * const p_inst, const float32_t * const p_in, float32_t * const p_out, const uint32_t size)
+{
+    filter_status_t status = eFILTER_OK;
+
+    for ( uint32_t i = 0U; i < size; i++ )
+    {
+        const float32_t in = p_in[i];
+
+        p_out[i] = 0.0f;
+        status |= filter_iir_hndl((p_filter_iir_t) p_inst, in, &p_out[i] );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       IIR filter generic interface: reset
+*
+* @param[in]    p_inst  - IIR filter instance
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static filter_status_t filter_iir_if_reset(void * const p_inst)
+{
+    return filter_iir_reset((p_filter_iir_t) p_inst );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       IIR filter generic interface: state size
+*
+* @param[in]    p_inst  - IIR filter instance
+* @return       size    - Size of filter data in bytes
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t filter_iir_if_state_size(const void * const p_inst)
+{
+    const filter_iir_t * const p_iir = (const filter_iir_t*) p_inst;
+
+    return (uint32_t) ( sizeof( filter_iir_t ) + ( 2U * ( p_iir->coeff.num_of_pole + p_iir->coeff.num_of_zero ) * sizeof( float32_t )));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       SOS filter generic interface: handle
+*
+* @param[in]    p_inst  - SOS filter instance
+* @param[in]    in      - Input sample
+* @param[out]   p_out   - Output (filtered) sample
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static filter_status_t filter_sos_if_hndl(void * const p_inst, const float32_t in, float32_t * const p_out)
+{
+    return filter_sos_hndl((p_filter_sos_t) p_inst, in, p_out );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       SOS filter generic interface: handle block of samples
+*
+* @param[in]    p_inst  - SOS filter instance
+* @param[in]    p_in    - Input samples
+* @param[out]   p_out   - Output (filtered) samples
+* @param[in]    size    - Number of samples
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static filter_status_t filter_sos_if_block(void * const p_inst, const float32_t * const p_in, float32_t * const p_out, const uint32_t size)
+{
+    return filter_sos_hndl_block((p_filter_sos_t) p_inst, p_in, p_out, size );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       SOS filter generic interface: reset
+*
+* @param[in]    p_inst  - SOS filter instance
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static filter_status_t filter_sos_if_reset(void * const p_inst)
+{
+    return filter_sos_reset((p_filter_sos_t) p_inst );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       SOS filter generic interface: state size
+*
+* @param[in]    p_inst  - SOS filter instance
+* @return       size    - Size of filter data in bytes
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t filter_sos_if_state_size(const void * const p_inst)
+{
+    const filter_sos_t * const p_sos = (const filter_sos_t*) p_inst;
+
+    return (uint32_t) ( sizeof( filter_sos_t ) + ( p_sos->num_of_sect * sizeof( filter_sos_sect_t )));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get order of SOS section polynomial
+*
+* @param[in]    p_c     - Polynomial c0 + c1*z^-1 + c2*z^-2
+* @return       order   - Highest power with non-zero coefficient
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint8_t filter_sos_poly_order(const float32_t * const p_c)
+{
+    uint8_t order = 0U;
+
+    if ( 0.0f != p_c[2] )
+    {
+        order = 2U;
+    }
+    else if ( 0.0f != p_c[1] )
+    {
+        order = 1U;
+    }
+    else
+    {
+        // Constant
+    }
+
+    return order;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Handle single SOS section (direct form II)
+*
+* @note     Only terms up to section order are evaluated.
+*
+* @param[in,out]    p_sect  - Section
+* @param[in]        x       - Section input
+* @return           y       - Section output
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline float32_t filter_sos_sect_hndl(filter_sos_sect_t * const p_sect, const float32_t x)
+{
+    float32_t w = x;
+    float32_t y = 0.0f;
+
+    if ( p_sect->num_of_pole > 0U )
+    {
+        w -= ( p_sect->a[0] * p_sect->w[0] );
+
+        if ( p_sect->num_of_pole > 1U )
+        {
+            w -= ( p_sect->a[1] * p_sect->w[1] );
+        }
+    }
+
+    y = w;
+
+    if ( p_sect->num_of_zero > 0U )
+    {
+        y += ( p_sect->b[0] * p_sect->w[0] );
+
+        if ( p_sect->num_of_zero > 1U )
+        {
+            y += ( p_sect->b[1] * p_sect->w[1] );
+        }
+    }
+
+    p_sect->w[1] = p_sect->w[0];
+    p_sect->w[0] = w;
+
+    return y;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Boolean filter generic interface: handle
+*
+* @note     Input above 0.5 is treated as true, output is 0.0 or 1.0.
+*
+* @param[in]    p_inst  - Boolean filter instance
+* @param[in]    in      - Input value
+* @param[out]   p_out   - Output (filtered) value
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static filter_status_t filter_bool_if_hndl(void * const p_inst, const float32_t in, float32_t * const p_out)
+{
+    filter_status_t status  = eFILTER_OK;
+    bool            out     = false;
+
+    status = filter_bool_hndl((p_filter_bool_t) p_inst, ( in > 0.5f ), &out );
+    *p_out = (( true == out ) ? 1.0f : 0.0f );
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Boolean filter generic interface: handle block of samples
+*
+* @note     Input above 0.5 is treated as true, output is 0.0 or 1.0.
+*
+* @param[in]    p_inst  - Boolean filter instance
+* @param[in]    p_in    - Input samples
+* @param[out]   p_out   - Output (filtered) samples
+* @param[in]    size    - Number of samples
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static filter_status_t filter_bool_if_block(void * const p_inst, const float32_t * const p_in, float32_t * const p_out, const uint32_t size)
+{
+    filter_status_t status  = eFILTER_OK;
+    bool            out     = false;
+
+    for ( uint32_t i = 0U; i < size; i++ )
+    {
+        status |= filter_bool_hndl((p_filter_bool_t) p_inst, ( p_in[i] > 0.5f ), &out );
+        p_out[i] = (( true == out ) ? 1.0f : 0.0f );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Boolean filter generic interface: reset
+*
+* @param[in]    p_inst  - Boolean filter instance
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static filter_status_t filter_bool_if_reset(void * const p_inst)
+{
+    return filter_bool_reset((p_filter_bool_t) p_inst );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Boolean filter generic interface: state size
+*
+* @param[in]    p_inst  - Boolean filter instance
+* @return       size    - Size of filter data in bytes
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t filter_bool_if_state_size(const void * const p_inst)
+{
+    const filter_bool_t * const p_bool = (const filter_bool_t*) p_inst;
+
+    return (uint32_t) ( sizeof( filter_bool_t ) + filter_rc_if_state_size( p_bool->lpf ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Boolean filter generic interface: sampling frequency
+*
+* @param[in]    p_inst  - Boolean filter instance
+* @return       fs      - Filter sampling frequency
+*/
+////////////////////////////////////////////////////////////////////////////////
+static float32_t filter_bool_if_fs_get(const void * const p_inst)
+{
+    return filter_rc_if_fs_get(((const filter_bool_t*) p_inst)->lpf );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Band filter generic interface: handle
+*
+* @param[in]    p_inst  - Band filter instance
+* @param[in]    in      - Input value
+* @param[out]   p_out   - Output (filtered) value
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static filter_status_t filter_band_if_hndl(void * const p_inst, const float32_t in, float32_t * const p_out)
+{
+    return filter_band_hndl((p_filter_band_t) p_inst, in, p_out );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Band filter generic interface: handle block of samples
+*
+* @param[in]    p_inst  - Band filter instance
+* @param[in]    p_in    - Input samples
+* @param[out]   p_out   - Output (filtered) samples
+* @param[in]    size    - Number of samples
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static filter_status_t filter_band_if_block(void * const p_inst, const float32_t * const p_in, float32_t * const p_out, const uint32_t size)
+{
+    return filter_band_hndl_block((p_filter_band_t) p_inst, p_in, p_out, size );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Band filter generic interface: reset
+*
+* @param[in]    p_inst  - Band filter instance
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static filter_status_t filter_band_if_reset(void * const p_inst)
+{
+    return filter_band_reset((p_filter_band_t) p_inst );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Band filter generic interface: state size
+*
+* @param[in]    p_inst  - Band filter instance
+* @return       size    - Size of filter data in bytes
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t filter_band_if_state_size(const void * const p_inst)
+{
+    const filter_band_t * const p_band = (const filter_band_t*) p_inst;
+
+    return (uint32_t) ( sizeof( filter_band_t ) + ((( 2U * p_band->order_cr ) + p_band->order_rc ) * sizeof( float32_t )));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Band filter generic interface: sampling frequency
+*
+* @param[in]    p_inst  - Band filter instance
+* @return       fs      - Filter sampling frequency
+*/
+////////////////////////////////////////////////////////////////////////////////
+static float32_t filter_band_if_fs_get(const void * const p_inst)
+{
+    return ((const filter_band_t*) p_inst)->fs;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       One-euro filter generic interface: handle
+*
+* @param[in]    p_inst  - One-euro filter instance
+* @param[in]    in      - Input value
+* @param[out]   p_out   - Output (filtered) value
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static filter_status_t filter_euro_if_hndl(void * const p_inst, const float32_t in, float32_t * const p_out)
+{
+    return filter_euro_hndl((p_filter_euro_t) p_inst, in, p_out );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       One-euro filter generic interface: handle block of samples
+*
+* @param[in]    p_inst  - One-euro filter instance
+* @param[in]    p_in    - Input samples
+* @param[out]   p_out   - Output (filtered) samples
+* @param[in]    size    - Number of samples
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static filter_status_t filter_euro_if_block(void * const p_inst, const float32_t * const p_in, float32_t * const p_out, const uint32_t size)
+{
+    filter_status_t status = eFILTER_OK;
+
+    for ( uint32_t i = 0U; i < size; i++ )
+    {
+        status |= filter_euro_hndl((p_filter_euro_t) p_inst, p_in[i], &p_out[i] );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       One-euro filter generic interface: reset
+*
+* @param[in]    p_inst  - One-euro filter instance
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static filter_status_t filter_euro_if_reset(void * const p_inst)
+{
+    return filter_euro_reset((p_filter_euro_t) p_inst, 0.0f );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       One-euro filter generic interface: state size
+*
+* @param[in]    p_inst  - One-euro filter instance
+* @return       size    - Size of filter data in bytes
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t filter_euro_if_state_size(const void * const p_inst)
+{
+    (void) p_inst;
+
+    return (uint32_t) sizeof( filter_euro_t );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       One-euro filter generic interface: sampling frequency
+*
+* @param[in]    p_inst  - One-euro filter instance
+* @return       fs      - Filter sampling frequency
+*/
+////////////////////////////////////////////////////////////////////////////////
+static float32_t filter_euro_if_fs_get(const void * const p_inst)
+{
+    return ((const filter_euro_t*) p_inst)->fs;
+}
+
+/**
+ *     Generic interfaces of built-in filters
+ */
+static const filter_iface_t g_filter_rc_iface   = { .pf_hndl = filter_rc_if_hndl,    .pf_block = filter_rc_if_block,    .pf_reset = filter_rc_if_reset,    .pf_state_size = filter_rc_if_state_size,    .pf_fs_get = filter_rc_if_fs_get   };
+static const filter_iface_t g_filter_cr_iface   = { .pf_hndl = filter_cr_if_hndl,    .pf_block = filter_cr_if_block,    .pf_reset = filter_cr_if_reset,    .pf_state_size = filter_cr_if_state_size,    .pf_fs_get = filter_cr_if_fs_get   };
+static const filter_iface_t g_filter_fir_iface  = { .pf_hndl = filter_fir_if_hndl,   .pf_block = filter_fir_if_block,   .pf_reset = filter_fir_if_reset,   .pf_state_size = filter_fir_if_state_size,   .pf_fs_get = NULL                  };
+static const filter_iface_t g_filter_iir_iface  = { .pf_hndl = filter_iir_if_hndl,   .pf_block = filter_iir_if_block,   .pf_reset = filter_iir_if_reset,   .pf_state_size = filter_iir_if_state_size,   .pf_fs_get = NULL                  };
+static const filter_iface_t g_filter_sos_iface  = { .pf_hndl = filter_sos_if_hndl,   .pf_block = filter_sos_if_block,   .pf_reset = filter_sos_if_reset,   .pf_state_size = filter_sos_if_state_size,   .pf_fs_get = NULL                  };
+static const filter_iface_t g_filter_bool_iface = { .pf_hndl = filter_bool_if_hndl,  .pf_block = filter_bool_if_block,  .pf_reset = filter_bool_if_reset,  .pf_state_size = filter_bool_if_state_size,  .pf_fs_get = filter_bool_if_fs_get };
+static const filter_iface_t g_filter_band_iface = { .pf_hndl = filter_band_if_hndl,  .pf_block = filter_band_if_block,  .pf_reset = filter_band_if_reset,  .pf_state_size = filter_band_if_state_size,  .pf_fs_get = filter_band_if_fs_get };
+static const filter_iface_t g_filter_euro_iface = { .pf_hndl = filter_euro_if_hndl,  .pf_block = filter_euro_if_block,  .pf_reset = filter_euro_if_reset,  .pf_state_size = filter_euro_if_state_size,  .pf_fs_get = filter_euro_if_fs_get };
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Create generic filter from interface and instance
+*
+* @param[in]    p_filter_inst   - Pointer to generic filter instance
+* @param[in]    p_iface         - Filter interface
+* @param[in]    p_inst          - Filter instance
+* @param[in]    is_inst_init    - Filter instance init state
+* @return       status          - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static filter_status_t filter_from_iface(p_filter_t * p_filter_inst, const filter_iface_t * const p_iface, void * const p_inst, const bool is_inst_init)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != p_filter_inst )
+        &&  ( NULL != p_inst )
+        &&  ( true == is_inst_init ))
+    {
+        // Allocate space
+        *p_filter_inst = malloc( sizeof( filter_t ));
+
+        // Check if allocation succeed
+        if ( NULL != *p_filter_inst )
+        {
+            (*p_filter_inst)->p_iface   = p_iface;
+            (*p_filter_inst)->p_inst    = p_inst;
+            (*p_filter_inst)->is_init   = true;
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Check if two adjacent pipeline stages can be fused
+*
+* @note     Supported fusion is 1st order CR filter followed by IIR filter
+*           of up to 2nd order (biquad).
+*
+* @param[in]    p_first     - First stage
+* @param[in]    p_second    - Second stage
+* @return       can_fuse    - Stages can be fused
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool filter_pipe_can_fuse(const filter_t * const p_first, const filter_t * const p_second)
+{
+    bool can_fuse = false;
+
+    if  (   ( &g_filter_cr_iface == p_first->p_iface )
+        &&  ( &g_filter_iir_iface == p_second->p_iface ))
+    {
+        const filter_cr_t  * const p_cr  = (const filter_cr_t*) p_first->p_inst;
+        const filter_iir_t * const p_iir = (const filter_iir_t*) p_second->p_inst;
+
+        if  (   ( 1U == p_cr->order )
+            &&  ( p_iir->coeff.num_of_pole <= FILTER_PIPE_FUSE_IIR_MAX )
+            &&  ( p_iir->coeff.num_of_zero <= FILTER_PIPE_FUSE_IIR_MAX )
+            &&  ( 0.0f != p_iir->coeff.p_pole[0] ))
+        {
+            can_fuse = true;
+        }
+    }
+
+    return can_fuse;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Fused CR and biquad IIR filter block kernel
+*
+* @brief    Applies 1st order CR filter and IIR filter (up to 2nd order) in
+*           single loop. All states are loaded into locals once per block
+*           and stored back at the end, so IIR ring buffers are accessed
+*           only at block boundaries. Calculation order is same as in
+*           "filter_cr_hndl()" and "filter_iir_hndl()".
+*
+* @param[in]    p_cr    - CR filter
+* @param[in]    p_iir   - IIR filter
+* @param[in]    p_in    - Input samples
+* @param[out]   p_out   - Output samples
+* @param[in]    size    - Number of samples
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void filter_pipe_cr_iir_fused(filter_cr_t * const p_cr, filter_iir_t * const p_iir, const float32_t * const p_in, float32_t * const p_out, const uint32_t size)
+{
+    const uint32_t  num_of_zero = p_iir->coeff.num_of_zero;
+    const uint32_t  num_of_pole = p_iir->coeff.num_of_pole;
+    const float32_t alpha       = p_cr->alpha;
+    const float32_t b0          = p_iir->coeff.p_zero[0];
+    const float32_t b1          = (( num_of_zero > 1U ) ? p_iir->coeff.p_zero[1] : 0.0f );
+    const float32_t b2          = (( num_of_zero > 2U ) ? p_iir->coeff.p_zero[2] : 0.0f );
+    const float32_t a0          = p_iir->coeff.p_pole[0];
+    const float32_t a1          = (( num_of_pole > 1U ) ? p_iir->coeff.p_pole[1] : 0.0f );
+    const float32_t a2          = (( num_of_pole > 2U ) ? p_iir->coeff.p_pole[2] : 0.0f );
+    float32_t       cr_y        = p_cr->p_y[0];
+    float32_t       cr_x        = p_cr->p_x[0];
+    float32_t       x[ FILTER_PIPE_FUSE_IIR_MAX ]   = { 0.0f };
+    float32_t       y[ FILTER_PIPE_FUSE_IIR_MAX ]   = { 0.0f };
+
+    // Load IIR states, newest first ("x" is shifted before use, "y" after)
+    for ( uint32_t i = 1U; i < num_of_zero; i++ )
+    {
+        (void) ring_buffer_get_by_index( p_iir->p_x, &x[ i - 1U ], -(int32_t) i );
+    }
+    for ( uint32_t i = 1U; i < num_of_pole; i++ )
+    {
+        (void) ring_buffer_get_by_index( p_iir->p_y, &y[i], -(int32_t) i );
+    }
+
+    for ( uint32_t n = 0U; n < size; n++ )
+    {
+        const float32_t in  = p_in[n];
+        float32_t       acc = 0.0f;
+
+        // CR
+        cr_y = (( alpha * cr_y ) + ( alpha * ( in - cr_x )));
+        cr_x = in;
+
+        // IIR
+        x[2] = x[1];
+        x[1] = x[0];
+        x[0] = cr_y;
+
+        acc += ( b0 * x[0] );
+        acc += ( b1 * x[1] );
+        acc += ( b2 * x[2] );
+        acc -= ( a1 * y[1] );
+        acc -= ( a2 * y[2] );
+        acc = ( acc / a0 );
+
+        y[2] = y[1];
+        y[1] = acc;
+
+        p_out[n] = acc;
+    }
+
+    // Store CR states
+    p_cr->p_y[0] = cr_y;
+    p_cr->p_x[0] = cr_x;
+
+    // Store IIR states oldest first, only values read by "filter_iir_hndl()"
+    for ( uint32_t i = (( size < num_of_zero ) ? size : num_of_zero ); i > 0U; i-- )
+    {
+        (void) ring_buffer_add( p_iir->p_x, &x[ i - 1U ] );
+    }
+    for ( uint32_t i = (( size < ( num_of_pole - 1U )) ? size : ( num_of_pole - 1U )); i > 0U; i-- )
+    {
+        (void) ring_buffer_add( p_iir->p_y, &y[i] );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get transfer function size and cost of LTI filter stage
+*
+* @note     Operation count is number of multiplications, additions and
+*           divisions per sample as implemented by stage handler.
+*
+* @param[in]    p_stage     - Generic filter
+* @param[out]   p_num_deg   - Degree of numerator
+* @param[out]   p_den_deg   - Degree of denominator
+* @param[out]   p_ops       - Number of operations per sample
+* @param[out]   p_states    - Number of state variables
+* @return       status      - Status of operation, error if stage is not LTI
+*/
+////////////////////////////////////////////////////////////////////////////////
+static filter_status_t filter_fuse_stage_info(const filter_t * const p_stage, uint32_t * const p_num_deg, uint32_t * const p_den_deg, uint32_t * const p_ops, uint32_t * const p_states)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if ( &g_filter_rc_iface == p_stage->p_iface )
+    {
+        const filter_rc_t * const p_rc = (const filter_rc_t*) p_stage->p_inst;
+
+        *p_num_deg  = 0U;
+        *p_den_deg  = p_rc->order;
+        *p_ops      = ( 3U * p_rc->order );
+        *p_states   = p_rc->order;
+    }
+    else if ( &g_filter_cr_iface == p_stage->p_iface )
+    {
+        const filter_cr_t * const p_cr = (const filter_cr_t*) p_stage->p_inst;
+
+        *p_num_deg  = p_cr->order;
+        *p_den_deg  = p_cr->order;
+        *p_ops      = ( 4U * p_cr->order );
+        *p_states   = ( 2U * p_cr->order );
+    }
+    else if ( &g_filter_band_iface == p_stage->p_iface )
+    {
+        const filter_band_t * const p_band = (const filter_band_t*) p_stage->p_inst;
+
+        *p_num_deg  = p_band->order_cr;
+        *p_den_deg  = ( p_band->order_cr + p_band->order_rc );
+        *p_ops      = (( 4U * p_band->order_cr ) + ( 3U * p_band->order_rc ));
+        *p_states   = (( 2U * p_band->order_cr ) + p_band->order_rc );
+    }
+    else if ( &g_filter_fir_iface == p_stage->p_iface )
+    {
+        const filter_fir_t * const p_fir = (const filter_fir_t*) p_stage->p_inst;
+
+        *p_num_deg  = ( p_fir->order - 1U );
+        *p_den_deg  = 0U;
+        *p_ops      = ( 2U * p_fir->order );
+        *p_states   = p_fir->order;
+    }
+    else if ( &g_filter_iir_iface == p_stage->p_iface )
+    {
+        const filter_iir_t * const p_iir = (const filter_iir_t*) p_stage->p_inst;
+
+        *p_num_deg  = ( p_iir->coeff.num_of_zero - 1U );
+        *p_den_deg  = ( p_iir->coeff.num_of_pole - 1U );
+        *p_ops      = (( 2U * p_iir->coeff.num_of_zero ) + ( 2U * p_iir->coeff.num_of_pole ) - 1U );
+        *p_states   = ( p_iir->coeff.num_of_zero + p_iir->coeff.num_of_pole );
+    }
+    else if ( &g_filter_sos_iface == p_stage->p_iface )
+    {
+        const filter_sos_t * const p_sos = (const filter_sos_t*) p_stage->p_inst;
+
+        *p_num_deg  = 0U;
+        *p_den_deg  = 0U;
+        *p_ops      = 1U;
+        *p_states   = 0U;
+
+        for ( uint32_t s = 0U; s < p_sos->num_of_sect; s++ )
+        {
+            *p_num_deg  += p_sos->p_sect[s].num_of_zero;
+            *p_den_deg  += p_sos->p_sect[s].num_of_pole;
+            *p_ops      += ( 2U * ( p_sos->p_sect[s].num_of_zero + p_sos->p_sect[s].num_of_pole ));
+            *p_states   += FILTER_MAX_OF( p_sos->p_sect[s].num_of_zero, p_sos->p_sect[s].num_of_pole );
+        }
+    }
+    else
+    {
+        // Boolean, one-euro and custom stages are not LTI
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get cost of SOS filter sections
+*
+* @note     Gain multiplication is counted once, each section coefficient
+*           is one multiplication and one addition.
+*
+* @param[in]    p_sect      - Section coefficients
+* @param[in]    num_of_sect - Number of sections
+* @param[out]   p_ops       - Number of operations per sample
+* @param[out]   p_states    - Number of state variables
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void filter_sos_coeff_cost(const filter_sos_coeff_t * const p_sect, const uint32_t num_of_sect, uint32_t * const p_ops, uint32_t * const p_states)
+{
+    *p_ops      = 1U;
+    *p_states   = 0U;
+
+    for ( uint32_t s = 0U; s < num_of_sect; s++ )
+    {
+        const uint32_t nz = filter_sos_poly_order( p_sect[s].b );
+        const uint32_t np = filter_sos_poly_order( p_sect[s].a );
+
+        *p_ops      += ( 2U * ( nz + np ));
+        *p_states   += FILTER_MAX_OF( nz, np );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Multiply complex numbers
+*
+* @param[in]    a   - First factor
+* @param[in]    b   - Second factor
+* @return       c   - Product
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline filter_fuse_cplx_t filter_fuse_cplx_mul(const filter_fuse_cplx_t a, const filter_fuse_cplx_t b)
+{
+    const filter_fuse_cplx_t c = { (( a.re * b.re ) - ( a.im * b.im )), (( a.re * b.im ) + ( a.im * b.re )) };
+
+    return c;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Divide complex numbers
+*
+* @param[in]    a   - Dividend
+* @param[in]    b   - Divisor
+* @return       c   - Quotient
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline filter_fuse_cplx_t filter_fuse_cplx_div(const filter_fuse_cplx_t a, const filter_fuse_cplx_t b)
+{
+    const double                den = (( b.re * b.re ) + ( b.im * b.im ));
+    const filter_fuse_cplx_t    c   = { ((( a.re * b.re ) + ( a.im * b.im )) / den ), ((( a.im * b.re ) - ( a.re * b.im )) / den ) };
+
+    return c;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Distance between complex numbers
+*
+* @param[in]    a       - First number
+* @param[in]    b       - Second number
+* @return       dist    - Distance
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline double filter_fuse_cplx_dist(const filter_fuse_cplx_t a, const filter_fuse_cplx_t b)
+{
+    return hypot(( a.re - b.re ), ( a.im - b.im ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Evaluate polynomial in z^-1 on unit circle
+*
+* @param[in]    p_poly  - Polynomial p[0] + p[1]*z^-1 + ...
+* @param[in]    len     - Number of coefficients
+* @param[in]    w       - Normalized angular frequency
+* @return       val     - Value at z = e^(jw)
+*/
+////////////////////////////////////////////////////////////////////////////////
+static filter_fuse_cplx_t filter_fuse_poly_resp(const double * const p_poly, const uint32_t len, const double w)
+{
+    filter_fuse_cplx_t val = { 0.0, 0.0 };
+
+    for ( uint32_t i = 0U; i < len; i++ )
+    {
+        val.re += ( p_poly[i] * cos( w * (double) i ));
+        val.im -= ( p_poly[i] * sin( w * (double) i ));
+    }
+
+    return val;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Find roots of monic polynomial
+*
+* @brief    Polynomial z^n + q[1]*z^(n-1) + ... + q[n] is solved in closed
+*           form up to 2nd order and with Durand-Kerner iteration above.
+*
+* @param[in]    p_q     - Polynomial coefficients, q[0] = 1
+* @param[in]    deg     - Polynomial degree
+* @param[out]   p_root  - Roots
+* @return       valid   - All roots are finite
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool filter_fuse_roots(const double * const p_q, const uint32_t deg, filter_fuse_cplx_t * const p_root)
+{
+    bool valid = true;
+
+    if ( 1U == deg )
+    {
+        p_root[0].re = -p_q[1];
+        p_root[0].im = 0.0;
+    }
+    else if ( 2U == deg )
+    {
+        const double disc = (( p_q[1] * p_q[1] ) - ( 4.0 * p_q[2] ));
+
+        if ( disc >= 0.0 )
+        {
+            // Form without cancellation
+            const double s = ( -0.5 * ( p_q[1] + copysign( sqrt( disc ), p_q[1] )));
+
+            p_root[0].re = s;
+            p_root[0].im = 0.0;
+            p_root[1].re = (( 0.0 != s ) ? ( p_q[2] / s ) : 0.0 );
+            p_root[1].im = 0.0;
+        }
+        else
+        {
+            p_root[0].re = ( -0.5 * p_q[1] );
+            p_root[0].im = ( 0.5 * sqrt( -disc ));
+            p_root[1].re = p_root[0].re;
+            p_root[1].im = -p_root[0].im;
+        }
+    }
+    else
+    {
+        const filter_fuse_cplx_t    seed    = { 0.4, 0.9 };
+        filter_fuse_cplx_t          x       = seed;
+        double                      step    = 1.0;
+
+        // Initial guesses on spiral
+        for ( uint32_t k = 0U; k < deg; k++ )
+        {
+            p_root[k]   = x;
+            x           = filter_fuse_cplx_mul( x, seed );
+        }
+
+        for ( uint32_t it = 0U; ( it < FILTER_FUSE_ROOT_ITER_MAX ) && ( step > FILTER_FUSE_ROOT_STEP_MIN ); it++ )
+        {
+            step = 0.0;
+
+            for ( uint32_t k = 0U; k < deg; k++ )
+            {
+                filter_fuse_cplx_t num = { 1.0, 0.0 };
+                filter_fuse_cplx_t den = { 1.0, 0.0 };
+                filter_fuse_cplx_t d;
+
+                // Value of polynomial (Horner)
+                for ( uint32_t i = 1U; i <= deg; i++ )
+                {
+                    num     = filter_fuse_cplx_mul( num, p_root[k] );
+                    num.re += p_q[i];
+                }
+
+                // Distance to other roots
+                for ( uint32_t j = 0U; j < deg; j++ )
+                {
+                    if ( j != k )
+                    {
+                        const filter_fuse_cplx_t diff = { ( p_root[k].re - p_root[j].re ), ( p_root[k].im - p_root[j].im ) };
+
+                        den = filter_fuse_cplx_mul( den, diff );
+                    }
+                }
+
+                // Coincident guesses
+                if  (   ( 0.0 == den.re )
+                    &&  ( 0.0 == den.im ))
+                {
+                    den.re = FILTER_FUSE_ROOT_STEP_MIN;
+                }
+
+                d = filter_fuse_cplx_div( num, den );
+
+                p_root[k].re -= d.re;
+                p_root[k].im -= d.im;
+
+                step = fmax( step, ( hypot( d.re, d.im ) / ( 1.0 + hypot( p_root[k].re, p_root[k].im ))));
+            }
+        }
+
+        for ( uint32_t k = 0U; k < deg; k++ )
+        {
+            if  (   ( 0 == isfinite( p_root[k].re ))
+                ||  ( 0 == isfinite( p_root[k].im )))
+            {
+                valid = false;
+            }
+        }
+    }
+
+    return valid;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Add polynomial factor of stage to fused zeros, poles and gain
+*
+* @note     Trailing zero coefficients are roots in origin, which are
+*           factors ( 1 - 0*z^-1 ) = 1 and are dropped. Leading zero
+*           coefficient (pure delay) can not be factored.
+*
+* @param[in,out]    p_zpk   - Fused zeros, poles and gain
+* @param[in]        p_poly  - Polynomial p[0] + p[1]*z^-1 + ...
+* @param[in]        len     - Number of coefficients
+* @param[in]        is_pole - Polynomial is denominator
+* @return           void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void filter_fuse_zpk_add(filter_fuse_zpk_t * const p_zpk, const double * const p_poly, const uint32_t len, const bool is_pole)
+{
+    uint32_t deg = ( len - 1U );
+
+    // Reference response of cascade
+    for ( uint32_t k = 0U; k < FILTER_FUSE_NUM_OF_FREQ; k++ )
+    {
+        const double                w   = (( M_PI * (double) k ) / (double) ( FILTER_FUSE_NUM_OF_FREQ - 1U ));
+        const filter_fuse_cplx_t    h   = filter_fuse_poly_resp( p_poly, len, w );
+
+        p_zpk->h_ref[k] = (( true == is_pole ) ? filter_fuse_cplx_div( p_zpk->h_ref[k], h ) : filter_fuse_cplx_mul( p_zpk->h_ref[k], h ));
+    }
+
+    while   (   ( deg > 0U )
+            &&  ( 0.0 == p_poly[deg] ))
+    {
+        deg--;
+    }
+
+    if ( 0.0 == p_poly[0] )
+    {
+        p_zpk->is_valid = false;
+    }
+    else
+    {
+        filter_fuse_cplx_t * const p_root = (( true == is_pole ) ? &p_zpk->p_pole[ p_zpk->num_of_pole ] : &p_zpk->p_zero[ p_zpk->num_of_zero ] );
+
+        p_zpk->gain = (( true == is_pole ) ? ( p_zpk->gain / p_poly[0] ) : ( p_zpk->gain * p_poly[0] ));
+
+        if ( deg > 0U )
+        {
+            for ( uint32_t i = 0U; i <= deg; i++ )
+            {
+                p_zpk->p_q[i] = ( p_poly[i] / p_poly[0] );
+            }
+
+            if ( false == filter_fuse_roots( p_zpk->p_q, deg, p_root ))
+            {
+                p_zpk->is_valid = false;
+            }
+
+            if ( true == is_pole )
+            {
+                p_zpk->num_of_pole += deg;
+            }
+            else
+            {
+                p_zpk->num_of_zero += deg;
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Add zeros, poles and gain of LTI filter stage to fusion
+*
+* @note     Stage must be accepted by "filter_fuse_stage_info()" before!
+*
+* @param[in]        p_stage - Generic filter
+* @param[in,out]    p_zpk   - Fused zeros, poles and gain
+* @return           void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void filter_fuse_stage_zpk(const filter_t * const p_stage, filter_fuse_zpk_t * const p_zpk)
+{
+    double * const  p_poly      = p_zpk->p_poly;
+    uint32_t        order_rc    = 0U;
+    uint32_t        order_cr    = 0U;
+    double          alpha_rc    = 0.0;
+    double          alpha_cr    = 0.0;
+
+    if ( &g_filter_rc_iface == p_stage->p_iface )
+    {
+        order_rc = ((const filter_rc_t*) p_stage->p_inst )->order;
+        alpha_rc = ((const filter_rc_t*) p_stage->p_inst )->alpha;
+    }
+    else if ( &g_filter_cr_iface == p_stage->p_iface )
+    {
+        order_cr = ((const filter_cr_t*) p_stage->p_inst )->order;
+        alpha_cr = ((const filter_cr_t*) p_stage->p_inst )->alpha;
+    }
+    else if ( &g_filter_band_iface == p_stage->p_iface )
+    {
+        order_cr = ((const filter_band_t*) p_stage->p_inst )->order_cr;
+        alpha_cr = ((const filter_band_t*) p_stage->p_inst )->alpha_cr;
+        order_rc = ((const filter_band_t*) p_stage->p_inst )->order_rc;
+        alpha_rc = ((const filter_band_t*) p_stage->p_inst )->alpha_rc;
+    }
+    else if ( &g_filter_fir_iface == p_stage->p_iface )
+    {
+        const filter_fir_t * const p_fir = (const filter_fir_t*) p_stage->p_inst;
+
+        for ( uint32_t i = 0U; i < p_fir->order; i++ )
+        {
+            p_poly[i] = p_fir->p_a[i];
+        }
+
+        filter_fuse_zpk_add( p_zpk, p_poly, p_fir->order, false );
+    }
+    else if ( &g_filter_iir_iface == p_stage->p_iface )
+    {
+        const filter_iir_t * const p_iir = (const filter_iir_t*) p_stage->p_inst;
+
+        for ( uint32_t i = 0U; i < p_iir->coeff.num_of_zero; i++ )
+        {
+            p_poly[i] = p_iir->coeff.p_zero[i];
+        }
+
+        filter_fuse_zpk_add( p_zpk, p_poly, p_iir->coeff.num_of_zero, false );
+
+        for ( uint32_t i = 0U; i < p_iir->coeff.num_of_pole; i++ )
+        {
+            p_poly[i] = p_iir->coeff.p_pole[i];
+        }
+
+        filter_fuse_zpk_add( p_zpk, p_poly, p_iir->coeff.num_of_pole, true );
+    }
+    else
+    {
+        const filter_sos_t * const p_sos = (const filter_sos_t*) p_stage->p_inst;
+
+        p_poly[0] = p_sos->gain;
+        filter_fuse_zpk_add( p_zpk, p_poly, 1U, false );
+
+        for ( uint32_t s = 0U; s < p_sos->num_of_sect; s++ )
+        {
+            const filter_sos_sect_t * const p_sect = &p_sos->p_sect[s];
+
+            p_poly[0] = 1.0;
+            p_poly[1] = p_sect->b[0];
+            p_poly[2] = p_sect->b[1];
+            filter_fuse_zpk_add( p_zpk, p_poly, ( p_sect->num_of_zero + 1U ), false );
+
+            p_poly[1] = p_sect->a[0];
+            p_poly[2] = p_sect->a[1];
+            filter_fuse_zpk_add( p_zpk, p_poly, ( p_sect->num_of_pole + 1U ), true );
+        }
+    }
+
+    // CR: H(z) = a * ( 1 - z^-1 ) / ( 1 - a * z^-1 )
+    for ( uint32_t n = 0U; n < order_cr; n++ )
+    {
+        const double num[2] = { alpha_cr, -alpha_cr };
+        const double den[2] = { 1.0, -alpha_cr };
+
+        filter_fuse_zpk_add( p_zpk, num, 2U, false );
+        filter_fuse_zpk_add( p_zpk, den, 2U, true );
+    }
+
+    // RC: H(z) = a / ( 1 - ( 1 - a ) * z^-1 )
+    for ( uint32_t n = 0U; n < order_rc; n++ )
+    {
+        const double num[1] = { alpha_rc };
+        const double den[2] = { 1.0, ( alpha_rc - 1.0 ) };
+
+        filter_fuse_zpk_add( p_zpk, num, 1U, false );
+        filter_fuse_zpk_add( p_zpk, den, 2U, true );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Cancel coincident zeros and poles
+*
+* @param[in,out]    p_zpk   - Fused zeros, poles and gain
+* @return           void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void filter_fuse_zpk_cancel(filter_fuse_zpk_t * const p_zpk)
+{
+    for ( uint32_t i = p_zpk->num_of_pole; i > 0U; i-- )
+    {
+        const filter_fuse_cplx_t    pole    = p_zpk->p_pole[ i - 1U ];
+        const double                tol     = ( FILTER_FUSE_ROOT_TOL * fmax( 1.0, hypot( pole.re, pole.im )));
+        bool                        found   = false;
+
+        for ( uint32_t j = 0U; ( j < p_zpk->num_of_zero ) && ( false == found ); j++ )
+        {
+            if ( filter_fuse_cplx_dist( pole, p_zpk->p_zero[j] ) <= tol )
+            {
+                // Remove both, last one takes their place
+                p_zpk->num_of_zero--;
+                p_zpk->num_of_pole--;
+                p_zpk->p_zero[j]        = p_zpk->p_zero[ p_zpk->num_of_zero ];
+                p_zpk->p_pole[ i - 1U ] = p_zpk->p_pole[ p_zpk->num_of_pole ];
+
+                found = true;
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Group roots into real 1st and 2nd order factors
+*
+* @note     Complex roots must come in conjugate pairs.
+*
+* @param[in]    p_root          - Roots
+* @param[in]    num_of_root     - Number of roots
+* @param[out]   p_taken         - Scratch, one flag per root
+* @param[out]   p_unit          - Factors
+* @param[out]   p_num_of_unit   - Number of factors
+* @return       valid           - All complex roots paired
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool filter_fuse_units(const filter_fuse_cplx_t * const p_root, const uint32_t num_of_root, bool * const p_taken, filter_fuse_unit_t * const p_unit, uint32_t * const p_num_of_unit)
+{
+    bool        valid       = true;
+    uint32_t    num_of_unit = 0U;
+
+    for ( uint32_t i = 0U; i < num_of_root; i++ )
+    {
+        p_taken[i] = false;
+    }
+
+    for ( uint32_t i = 0U; i < num_of_root; i++ )
+    {
+        const double tol = ( FILTER_FUSE_ROOT_TOL * fmax( 1.0, hypot( p_root[i].re, p_root[i].im )));
+
+        // Real root: ( 1 - r*z^-1 )
+        if ( fabs( p_root[i].im ) <= tol )
+        {
+            p_unit[num_of_unit].root.re = p_root[i].re;
+            p_unit[num_of_unit].root.im = 0.0;
+            p_unit[num_of_unit].c[0]    = -p_root[i].re;
+            p_unit[num_of_unit].c[1]    = 0.0;
+            p_unit[num_of_unit].deg     = 1U;
+            p_unit[num_of_unit].is_used = false;
+            num_of_unit++;
+        }
+
+        // Complex pair: ( 1 - 2*re*z^-1 + |r|^2*z^-2 ), taken at root with positive imaginary part
+        else if ( p_root[i].im > 0.0 )
+        {
+            const filter_fuse_cplx_t    conj        = { p_root[i].re, -p_root[i].im };
+            uint32_t                    best        = num_of_root;
+            double                      best_dist   = tol;
+
+            for ( uint32_t j = 0U; j < num_of_root; j++ )
+            {
+                if  (   ( false == p_taken[j] )
+                    &&  ( p_root[j].im < -tol )
+                    &&  ( filter_fuse_cplx_dist( conj, p_root[j] ) <= best_dist ))
+                {
+                    best        = j;
+                    best_dist   = filter_fuse_cplx_dist( conj, p_root[j] );
+                }
+            }
+
+            if ( best < num_of_root )
+            {
+                const double re = ( 0.5 * ( p_root[i].re + p_root[best].re ));
+                const double im = ( 0.5 * ( p_root[i].im - p_root[best].im ));
+
+                p_taken[best] = true;
+
+                p_unit[num_of_unit].root.re = re;
+                p_unit[num_of_unit].root.im = im;
+                p_unit[num_of_unit].c[0]    = ( -2.0 * re );
+                p_unit[num_of_unit].c[1]    = (( re * re ) + ( im * im ));
+                p_unit[num_of_unit].deg     = 2U;
+                p_unit[num_of_unit].is_used = false;
+                num_of_unit++;
+            }
+            else
+            {
+                valid = false;
+            }
+        }
+        else
+        {
+            // Negative imaginary part, must be taken by its conjugate
+        }
+    }
+
+    // Conjugates without pair
+    for ( uint32_t i = 0U; i < num_of_root; i++ )
+    {
+        if  (   ( p_root[i].im < -( FILTER_FUSE_ROOT_TOL * fmax( 1.0, hypot( p_root[i].re, p_root[i].im ))))
+            &&  ( false == p_taken[i] ))
+        {
+            valid = false;
+        }
+    }
+
+    *p_num_of_unit = num_of_unit;
+
+    return valid;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Find nearest unused factor of given degree
+*
+* @param[in]    p_unit      - Factors
+* @param[in]    num_of_unit - Number of factors
+* @param[in]    deg         - Factor degree
+* @param[in]    root        - Root to measure distance from
+* @return       idx         - Index of nearest factor, "num_of_unit" if none
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t filter_fuse_unit_nearest(const filter_fuse_unit_t * const p_unit, const uint32_t num_of_unit, const uint8_t deg, const filter_fuse_cplx_t root)
+{
+    uint32_t    idx         = num_of_unit;
+    double      dist_min    = INFINITY;
+
+    for ( uint32_t i = 0U; i < num_of_unit; i++ )
+    {
+        if  (   ( false == p_unit[i].is_used )
+            &&  ( deg == p_unit[i].deg )
+            &&  ( filter_fuse_cplx_dist( root, p_unit[i].root ) < dist_min ))
+        {
+            idx         = i;
+            dist_min    = filter_fuse_cplx_dist( root, p_unit[i].root );
+        }
+    }
+
+    return idx;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Multiply factor into section polynomial
+*
+* @note     Resulting order must not exceed 2!
+*
+* @param[in,out]    p_c     - Section polynomial 1 + c[0]*z^-1 + c[1]*z^-2
+* @param[in,out]    p_order - Section polynomial order
+* @param[in,out]    p_unit  - Factor, marked as used
+* @return           void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void filter_fuse_unit_mul(double * const p_c, uint8_t * const p_order, filter_fuse_unit_t * const p_unit)
+{
+    if ( 0U == *p_order )
+    {
+        p_c[0] = p_unit->c[0];
+        p_c[1] = p_unit->c[1];
+    }
+    else
+    {
+        // ( 1 + c0*z^-1 ) * ( 1 + u0*z^-1 )
+        p_c[1] = ( p_c[0] * p_unit->c[0] );
+        p_c[0] = ( p_c[0] + p_unit->c[0] );
+    }
+
+    *p_order        = (uint8_t) ( *p_order + p_unit->deg );
+    p_unit->is_used = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Build sections from zero and pole factors
+*
+* @brief    Each pole factor gets its own section (complex pair 2nd order,
+*           real pole 1st order) and sections closest to unit circle first
+*           take nearest zeros up to their order. Remaining zeros go where
+*           they add least states or form zero only sections. Sections are
+*           ordered by pole radius, poles closest to unit circle come last.
+*
+* @param[in,out]    p_zu        - Zero factors
+* @param[in]        num_of_zu   - Number of zero factors
+* @param[in,out]    p_pu        - Pole factors
+* @param[in]        num_of_pu   - Number of pole factors
+* @param[out]       p_sect      - Sections, space for all factors
+* @return           num_of_sect - Number of sections
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t filter_fuse_sect_build(filter_fuse_unit_t * const p_zu, const uint32_t num_of_zu, filter_fuse_unit_t * const p_pu, const uint32_t num_of_pu, filter_fuse_sect_t * const p_sect)
+{
+    uint32_t num_of_sect = 0U;
+
+    // Section per pole factor, from largest pole radius down
+    for ( uint32_t i = 0U; i < num_of_pu; i++ )
+    {
+        const double    r = hypot( p_pu[i].root.re, p_pu[i].root.im );
+        uint32_t        k = num_of_sect;
+
+        while   (   ( k > 0U )
+                &&  ( hypot( p_sect[ k - 1U ].pole.re, p_sect[ k - 1U ].pole.im ) < r ))
+        {
+            p_sect[k] = p_sect[ k - 1U ];
+            k--;
+        }
+
+        p_sect[k].pole          = p_pu[i].root;
+        p_sect[k].num_of_zero   = 0U;
+        p_sect[k].num_of_pole   = 0U;
+        p_sect[k].b[0]          = 0.0;
+        p_sect[k].b[1]          = 0.0;
+        filter_fuse_unit_mul( p_sect[k].a, &p_sect[k].num_of_pole, &p_pu[i] );
+        num_of_sect++;
+    }
+
+    // Nearest zeros of same order
+    for ( uint32_t s = 0U; s < num_of_sect; s++ )
+    {
+        filter_fuse_sect_t * const  p_s     = &p_sect[s];
+        const uint32_t              cplx    = filter_fuse_unit_nearest( p_zu, num_of_zu, 2U, p_s->pole );
+        uint32_t                    real    = filter_fuse_unit_nearest( p_zu, num_of_zu, 1U, p_s->pole );
+
+        if  (   ( 2U == p_s->num_of_pole )
+            &&  ( cplx < num_of_zu )
+            &&  (   ( real >= num_of_zu )
+                ||  ( filter_fuse_cplx_dist( p_zu[cplx].root, p_s->pole ) <= filter_fuse_cplx_dist( p_zu[real].root, p_s->pole ))))
+        {
+            filter_fuse_unit_mul( p_s->b, &p_s->num_of_zero, &p_zu[cplx] );
+        }
+        else
+        {
+            while   (   ( real < num_of_zu )
+                    &&  ( p_s->num_of_zero < p_s->num_of_pole ))
+            {
+                filter_fuse_unit_mul( p_s->b, &p_s->num_of_zero, &p_zu[real] );
+
+                real = filter_fuse_unit_nearest( p_zu, num_of_zu, 1U, p_s->pole );
+            }
+        }
+    }
+
+    // Remaining zeros where they add least states
+    for ( uint32_t z = 0U; z < num_of_zu; z++ )
+    {
+        if ( false == p_zu[z].is_used )
+        {
+            uint32_t best       = num_of_sect;
+            uint32_t best_cost  = UINT32_MAX;
+
+            for ( uint32_t s = 0U; s < num_of_sect; s++ )
+            {
+                const uint32_t nz = p_sect[s].num_of_zero;
+                const uint32_t np = p_sect[s].num_of_pole;
+
+                if (( nz + p_zu[z].deg ) <= 2U )
+                {
+                    const uint32_t cost = ( FILTER_MAX_OF(( nz + p_zu[z].deg ), np ) - FILTER_MAX_OF( nz, np ));
+
+                    if ( cost < best_cost )
+                    {
+                        best        = s;
+                        best_cost   = cost;
+                    }
+                }
+            }
+
+            // New zero only section
+            if ( best == num_of_sect )
+            {
+                p_sect[best].pole.re        = 0.0;
+                p_sect[best].pole.im        = 0.0;
+                p_sect[best].num_of_zero    = 0U;
+                p_sect[best].num_of_pole    = 0U;
+                p_sect[best].a[0]           = 0.0;
+                p_sect[best].a[1]           = 0.0;
+                num_of_sect++;
+            }
+
+            filter_fuse_unit_mul( p_sect[best].b, &p_sect[best].num_of_zero, &p_zu[z] );
+        }
+    }
+
+    // Order by pole radius, ascending
+    for ( uint32_t i = 1U; i < num_of_sect; i++ )
+    {
+        const filter_fuse_sect_t    sect    = p_sect[i];
+        const double                r       = hypot( sect.pole.re, sect.pole.im );
+        uint32_t                    k       = i;
+
+        while   (   ( k > 0U )
+                &&  ( hypot( p_sect[ k - 1U ].pole.re, p_sect[ k - 1U ].pole.im ) > r ))
+        {
+            p_sect[k] = p_sect[ k - 1U ];
+            k--;
+        }
+
+        p_sect[k] = sect;
+    }
+
+    return num_of_sect;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Check response of fused sections against response of stages
+*
+* @param[in]    p_zpk       - Fused zeros, poles, gain and reference response
+* @param[in]    p_sect      - Fused section coefficients
+* @param[in]    num_of_sect - Number of sections
+* @return       valid       - Deviation within FILTER_FUSE_RESP_TOL
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool filter_fuse_resp_check(const filter_fuse_zpk_t * const p_zpk, const filter_sos_coeff_t * const p_sect, const uint32_t num_of_sect)
+{
+    double err_max = 0.0;
+    double ref_max = 0.0;
+
+    for ( uint32_t k = 0U; k < FILTER_FUSE_NUM_OF_FREQ; k++ )
+    {
+        const double        w   = (( M_PI * (double) k ) / (double) ( FILTER_FUSE_NUM_OF_FREQ - 1U ));
+        filter_fuse_cplx_t  h   = { 1.0, 0.0 };
+        double              err = 0.0;
+
+        for ( uint32_t s = 0U; s < num_of_sect; s++ )
+        {
+            const double b[3] = { p_sect[s].b[0], p_sect[s].b[1], p_sect[s].b[2] };
+            const double a[3] = { p_sect[s].a[0], p_sect[s].a[1], p_sect[s].a[2] };
+
+            h = filter_fuse_cplx_mul( h, filter_fuse_poly_resp( b, 3U, w ));
+            h = filter_fuse_cplx_div( h, filter_fuse_poly_resp( a, 3U, w ));
+        }
+
+        err = filter_fuse_cplx_dist( h, p_zpk->h_ref[k] );
+
+        // NaN propagates into result
+        if ( !( err <= err_max ))
+        {
+            err_max = err;
+        }
+
+        ref_max = fmax( ref_max, hypot( p_zpk->h_ref[k].re, p_zpk->h_ref[k].im ));
+    }
+
+    return ( err_max <= ( FILTER_FUSE_RESP_TOL * ref_max ));
+}
+
+#if ( 1 == FILTER_CFG_ATOMIC_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Initialize parameter update lock
+*
+* @param[in]    p_lock  - Parameter update lock
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void filter_seqlock_init(filter_seqlock_t * const p_lock)
+{
+    atomic_init( &p_lock->seq, 0U );
+    p_lock->applied = 0U;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Start parameter update (control thread)
+*
+* @note     Concurrent writers are serialized by waiting for even sequence.
+*           Sample path is never blocked.
+*
+* @param[in]    p_lock  - Parameter update lock
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void filter_seqlock_write_begin(filter_seqlock_t * const p_lock)
+{
+    uint32_t seq = atomic_load_explicit( &p_lock->seq, memory_order_relaxed );
+
+    do
+    {
+        // Only even sequence (no update in progress) can be taken
+        seq &= ~1U;
+
+    } while ( false == atomic_compare_exchange_weak_explicit( &p_lock->seq, &seq, ( seq + 1U ), memory_order_acquire, memory_order_relaxed ));
+
+    // Parameter stores must not move before sequence change
+    atomic_thread_fence( memory_order_release );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       End parameter update (control thread)
+*
+* @param[in]    p_lock  - Parameter update lock
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void filter_seqlock_write_end(filter_seqlock_t * const p_lock)
+{
+    (void) atomic_fetch_add_explicit( &p_lock->seq, 1U, memory_order_release );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Start reading parameters
+*
+* @param[in]    p_lock  - Parameter update lock
+* @param[out]   p_seq   - Sequence at start of read
+* @return       valid   - False if update is in progress
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline bool filter_seqlock_read_begin(filter_seqlock_t * const p_lock, uint32_t * const p_seq)
+{
+    *p_seq = atomic_load_explicit( &p_lock->seq, memory_order_acquire );
+
+    return ( 0U == ( *p_seq & 1U ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       End reading parameters
+*
+* @param[in]    p_lock  - Parameter update lock
+* @param[in]    seq     - Sequence at start of read
+* @return       valid   - True if parameters were not changed during read
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline bool filter_seqlock_read_end(filter_seqlock_t * const p_lock, const uint32_t seq)
+{
+    // Parameter loads must not move after sequence check
+    atomic_thread_fence( memory_order_acquire );
+
+    return ( seq == atomic_load_explicit( &p_lock->seq, memory_order_relaxed ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Check if new parameters were set (sample path)
+*
+* @note     Single relaxed load, cheap enough to be called every sample.
+*
+* @param[in]    p_lock  - Parameter update lock
+* @return       pending - New parameters not yet applied
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline bool filter_seqlock_is_pending(filter_seqlock_t * const p_lock)
+{
+    return ( p_lock->applied != atomic_load_explicit( &p_lock->seq, memory_order_relaxed ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Start publishing parameters set in sample path
+*
+* @brief    Parameters changed by sample path setters (plain, fast,
+*           deferred) are copied to concurrent setter parameters, so that
+*           "_atomic" getters return them. Lock is only tried, sample path
+*           never waits.
+*
+* @note     Publishing is skipped if concurrent setter update is pending
+*           or in progress. That update is applied on next handle call
+*           and overrides sample path parameters, so concurrent setter
+*           parameters are already the ones to be returned.
+*
+* @param[in]    p_lock  - Parameter update lock
+* @param[out]   p_seq   - Sequence at start of publish
+* @return       taken   - True if parameters shall be published
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool filter_seqlock_publish_begin(filter_seqlock_t * const p_lock, uint32_t * const p_seq)
+{
+    bool taken = false;
+
+    *p_seq = atomic_load_explicit( &p_lock->seq, memory_order_relaxed );
+
+    if ( p_lock->applied == *p_seq )
+    {
+        taken = atomic_compare_exchange_strong_explicit( &p_lock->seq, p_seq, ( *p_seq + 1U ), memory_order_acquire, memory_order_relaxed );
+
+        // Parameter stores must not move before sequence change
+        atomic_thread_fence( memory_order_release );
+    }
+
+    return taken;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       End publishing parameters set in sample path
+*
+* @param[in]    p_lock  - Parameter update lock
+* @param[in]    seq     - Sequence at start of publish
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void filter_seqlock_publish_end(filter_seqlock_t * const p_lock, const uint32_t seq)
+{
+    filter_seqlock_write_end( p_lock );
+
+    // Published parameters are already in use
+    p_lock->applied = ( seq + 2U );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Apply concurrently set and deferred RC filter parameters
+*
+* @note     If update is in progress old parameters are kept and new ones
+*           are applied on next call.
+*
+* @note     Deferred cutoff is converted to alpha here, so only last of
+*           many deferred sets costs a calculation.
+*
+* @param[in]    p_rc    - RC filter
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void filter_rc_param_apply(filter_rc_t * const p_rc)
+{
+    uint32_t seq = 0U;
+
+    if  (   ( true == atomic_load_explicit( &p_rc->fc_dirty, memory_order_relaxed ))
+        &&  ( true == atomic_exchange_explicit( &p_rc->fc_dirty, false, memory_order_acquire )))
+    {
+        p_rc->fc = atomic_load_explicit( &p_rc->fc_pend, memory_order_relaxed );
+
+        // Cutoff validated by setter
+        (void) filter_rc_calculate_alpha( p_rc->fc, p_rc->fs, &p_rc->alpha );
+        filter_rc_param_publish( p_rc );
+    }
+
+    if ( true == filter_seqlock_is_pending( &p_rc->lock ))
+    {
+        if ( true == filter_seqlock_read_begin( &p_rc->lock, &seq ))
+        {
+            const float32_t alpha   = p_rc->alpha_new;
+            const float32_t fc      = p_rc->fc_new;
+
+            if ( true == filter_seqlock_read_end( &p_rc->lock, seq ))
+            {
+                p_rc->alpha         = alpha;
+                p_rc->fc            = fc;
+                p_rc->lock.applied  = seq;
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Apply concurrently set and deferred CR filter parameters
+*
+* @note     If update is in progress old parameters are kept and new ones
+*           are applied on next call.
+*
+* @note     Deferred cutoff is converted to alpha here, so only last of
+*           many deferred sets costs a calculation.
+*
+* @param[in]    p_cr    - CR filter
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void filter_cr_param_apply(filter_cr_t * const p_cr)
+{
+    uint32_t seq = 0U;
+
+    if  (   ( true == atomic_load_explicit( &p_cr->fc_dirty, memory_order_relaxed ))
+        &&  ( true == atomic_exchange_explicit( &p_cr->fc_dirty, false, memory_order_acquire )))
+    {
+        p_cr->fc = atomic_load_explicit( &p_cr->fc_pend, memory_order_relaxed );
+
+        // Cutoff validated by setter
+        (void) filter_cr_calculate_alpha( p_cr->fc, p_cr->fs, &p_cr->alpha );
+        filter_cr_param_publish( p_cr );
+    }
+
+    if ( true == filter_seqlock_is_pending( &p_cr->lock ))
+    {
+        if ( true == filter_seqlock_read_begin( &p_cr->lock, &seq ))
+        {
+            const float32_t alpha   = p_cr->alpha_new;
+            const float32_t fc      = p_cr->fc_new;
+
+            if ( true == filter_seqlock_read_end( &p_cr->lock, seq ))
+            {
+                p_cr->alpha         = alpha;
+                p_cr->fc            = fc;
+                p_cr->lock.applied  = seq;
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Apply concurrently set FIR filter coefficients
+*
+* @note     Coefficients are first copied to stage buffer and only once
+*           copy is confirmed consistent moved to coefficients in use.
+*
+* @param[in]    p_fir   - FIR filter
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void filter_fir_param_apply(filter_fir_t * const p_fir)
+{
+    uint32_t seq = 0U;
+
+    if ( true == filter_seqlock_is_pending( &p_fir->lock ))
+    {
+        if ( true == filter_seqlock_read_begin( &p_fir->lock, &seq ))
+        {
+            memcpy( p_fir->p_a_stage, p_fir->p_a_new, ( p_fir->order * sizeof( float32_t )));
+
+            if ( true == filter_seqlock_read_end( &p_fir->lock, seq ))
+            {
+                memcpy( p_fir->p_a, p_fir->p_a_stage, ( p_fir->order * sizeof( float32_t )));
+                p_fir->lock.applied = seq;
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Apply concurrently set IIR filter coefficients
+*
+* @note     Coefficients are first copied to stage buffer and only once
+*           copy is confirmed consistent moved to coefficients in use.
+*
+* @param[in]    p_iir   - IIR filter
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void filter_iir_param_apply(filter_iir_t * const p_iir)
+{
+    const uint32_t  num_of_pole = p_iir->coeff.num_of_pole;
+    const uint32_t  num_of_zero = p_iir->coeff.num_of_zero;
+    uint32_t        seq         = 0U;
+
+    if ( true == filter_seqlock_is_pending( &p_iir->lock ))
+    {
+        if ( true == filter_seqlock_read_begin( &p_iir->lock, &seq ))
+        {
+            memcpy( p_iir->p_coeff_stage, p_iir->p_coeff_new, (( num_of_pole + num_of_zero ) * sizeof( float32_t )));
+
+            if ( true == filter_seqlock_read_end( &p_iir->lock, seq ))
+            {
+                memcpy( p_iir->coeff.p_pole, p_iir->p_coeff_stage, ( num_of_pole * sizeof( float32_t )));
+                memcpy( p_iir->coeff.p_zero, &p_iir->p_coeff_stage[num_of_pole], ( num_of_zero * sizeof( float32_t )));
+                p_iir->lock.applied = seq;
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Apply concurrently set RC filter bank parameters
+*
+* @note     Parameters are first copied to stage buffer and only once
+*           copy is confirmed consistent moved to parameters in use.
+*
+* @param[in]    p_bank  - RC filter bank
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void filter_rc_bank_param_apply(filter_rc_bank_t * const p_bank)
+{
+    const uint32_t  num_of_ch   = p_bank->num_of_ch;
+    uint32_t        seq         = 0U;
+
+    if ( true == filter_seqlock_is_pending( &p_bank->lock ))
+    {
+        if ( true == filter_seqlock_read_begin( &p_bank->lock, &seq ))
+        {
+            memcpy( p_bank->p_par_stage, p_bank->p_par_new, ( 2U * num_of_ch * sizeof( float32_t )));
+
+            if ( true == filter_seqlock_read_end( &p_bank->lock, seq ))
+            {
+                memcpy( p_bank->p_alpha, p_bank->p_par_stage, ( num_of_ch * sizeof( float32_t )));
+                memcpy( p_bank->p_fc, &p_bank->p_par_stage[num_of_ch], ( num_of_ch * sizeof( float32_t )));
+                p_bank->lock.applied = seq;
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Apply concurrently set CR filter bank parameters
+*
+* @note     Parameters are first copied to stage buffer and only once
+*           copy is confirmed consistent moved to parameters in use.
+*
+* @param[in]    p_bank  - CR filter bank
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void filter_cr_bank_param_apply(filter_cr_bank_t * const p_bank)
+{
+    const uint32_t  num_of_ch   = p_bank->num_of_ch;
+    uint32_t        seq         = 0U;
+
+    if ( true == filter_seqlock_is_pending( &p_bank->lock ))
+    {
+        if ( true == filter_seqlock_read_begin( &p_bank->lock, &seq ))
+        {
+            memcpy( p_bank->p_par_stage, p_bank->p_par_new, ( 2U * num_of_ch * sizeof( float32_t )));
+
+            if ( true == filter_seqlock_read_end( &p_bank->lock, seq ))
+            {
+                memcpy( p_bank->p_alpha, p_bank->p_par_stage, ( num_of_ch * sizeof( float32_t )));
+                memcpy( p_bank->p_fc, &p_bank->p_par_stage[num_of_ch], ( num_of_ch * sizeof( float32_t )));
+                p_bank->lock.applied = seq;
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Apply concurrently set band filter parameters
+*
+* @note     If update is in progress old parameters are kept and new ones
+*           are applied on next call.
+*
+* @param[in]    p_band  - Band filter
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void filter_band_param_apply(filter_band_t * const p_band)
+{
+    uint32_t seq = 0U;
+
+    if ( true == filter_seqlock_is_pending( &p_band->lock ))
+    {
+        if ( true == filter_seqlock_read_begin( &p_band->lock, &seq ))
+        {
+            const float32_t alpha_cr    = p_band->alpha_cr_new;
+            const float32_t alpha_rc    = p_band->alpha_rc_new;
+            const float32_t fc_cr       = p_band->fc_cr_new;
+            const float32_t fc_rc       = p_band->fc_rc_new;
+
+            if ( true == filter_seqlock_read_end( &p_band->lock, seq ))
+            {
+                p_band->alpha_cr        = alpha_cr;
+                p_band->alpha_rc        = alpha_rc;
+                p_band->fc_cr           = fc_cr;
+                p_band->fc_rc           = fc_rc;
+                p_band->lock.applied    = seq;
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Apply concurrently set integer boolean filter parameters
+*
+* @note     If update is in progress old parameters are kept and new ones
+*           are applied on next call.
+*
+* @param[in]    p_filter    - Integer boolean filter
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void filter_bool_cnt_param_apply(filter_bool_cnt_t * const p_filter)
+{
+    uint32_t seq = 0U;
+
+    if ( true == filter_seqlock_is_pending( &p_filter->lock ))
+    {
+        if ( true == filter_seqlock_read_begin( &p_filter->lock, &seq ))
+        {
+            const float32_t fc      = p_filter->fc_new;
+            const int32_t   alpha   = p_filter->alpha_new;
+            const int32_t   lvl_on  = p_filter->lvl_on_new;
+            const int32_t   lvl_off = p_filter->lvl_off_new;
+
+            if ( true == filter_seqlock_read_end( &p_filter->lock, seq ))
+            {
+                p_filter->fc            = fc;
+                p_filter->alpha         = alpha;
+                p_filter->lvl_on        = lvl_on;
+                p_filter->lvl_off       = lvl_off;
+                p_filter->lock.applied  = seq;
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Publish RC filter parameters set in sample path
+*
+* @param[in]    p_rc    - RC filter
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void filter_rc_param_publish(filter_rc_t * const p_rc)
+{
+    uint32_t seq = 0U;
+
+    if ( true == filter_seqlock_publish_begin( &p_rc->lock, &seq ))
+    {
+        p_rc->alpha_new = p_rc->alpha;
+        p_rc->fc_new    = p_rc->fc;
+
+        filter_seqlock_publish_end( &p_rc->lock, seq );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Publish CR filter parameters set in sample path
+*
+* @param[in]    p_cr    - CR filter
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void filter_cr_param_publish(filter_cr_t * const p_cr)
+{
+    uint32_t seq = 0U;
+
+    if ( true == filter_seqlock_publish_begin( &p_cr->lock, &seq ))
+    {
+        p_cr->alpha_new = p_cr->alpha;
+        p_cr->fc_new    = p_cr->fc;
+
+        filter_seqlock_publish_end( &p_cr->lock, seq );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Publish FIR filter coefficients set in sample path
+*
+* @param[in]    p_fir   - FIR filter
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void filter_fir_param_publish(filter_fir_t * const p_fir)
+{
+    uint32_t seq = 0U;
+
+    if ( true == filter_seqlock_publish_begin( &p_fir->lock, &seq ))
+    {
+        memcpy( p_fir->p_a_new, p_fir->p_a, ( p_fir->order * sizeof( float32_t )));
+
+        filter_seqlock_publish_end( &p_fir->lock, seq );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Publish IIR filter coefficients set in sample path
+*
+* @param[in]    p_iir   - IIR filter
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void filter_iir_param_publish(filter_iir_t * const p_iir)
+{
+    const uint32_t  num_of_pole = p_iir->coeff.num_of_pole;
+    const uint32_t  num_of_zero = p_iir->coeff.num_of_zero;
+    uint32_t        seq         = 0U;
+
+    if ( true == filter_seqlock_publish_begin( &p_iir->lock, &seq ))
+    {
+        memcpy( p_iir->p_coeff_new, p_iir->coeff.p_pole, ( num_of_pole * sizeof( float32_t )));
+        memcpy( &p_iir->p_coeff_new[num_of_pole], p_iir->coeff.p_zero, ( num_of_zero * sizeof( float32_t )));
+
+        filter_seqlock_publish_end( &p_iir->lock, seq );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Publish RC filter bank parameters set in sample path
+*
+* @note     Keeps concurrent setter parameters equal to ones in use, so
+*           that single channel concurrent set does not revert other
+*           channels set in sample path.
+*
+* @param[in]    p_bank  - RC filter bank
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void filter_rc_bank_param_publish(filter_rc_bank_t * const p_bank)
+{
+    const uint32_t  num_of_ch   = p_bank->num_of_ch;
+    uint32_t        seq         = 0U;
+
+    if ( true == filter_seqlock_publish_begin( &p_bank->lock, &seq ))
+    {
+        memcpy( p_bank->p_par_new, p_bank->p_alpha, ( num_of_ch * sizeof( float32_t )));
+        memcpy( &p_bank->p_par_new[num_of_ch], p_bank->p_fc, ( num_of_ch * sizeof( float32_t )));
+
+        filter_seqlock_publish_end( &p_bank->lock, seq );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Publish CR filter bank parameters set in sample path
+*
+* @note     See "filter_rc_bank_param_publish()".
+*
+* @param[in]    p_bank  - CR filter bank
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void filter_cr_bank_param_publish(filter_cr_bank_t * const p_bank)
+{
+    const uint32_t  num_of_ch   = p_bank->num_of_ch;
+    uint32_t        seq         = 0U;
+
+    if ( true == filter_seqlock_publish_begin( &p_bank->lock, &seq ))
+    {
+        memcpy( p_bank->p_par_new, p_bank->p_alpha, ( num_of_ch * sizeof( float32_t )));
+        memcpy( &p_bank->p_par_new[num_of_ch], p_bank->p_fc, ( num_of_ch * sizeof( float32_t )));
+
+        filter_seqlock_publish_end( &p_bank->lock, seq );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Publish band filter parameters set in sample path
+*
+* @param[in]    p_band  - Band filter
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void filter_band_param_publish(filter_band_t * const p_band)
+{
+    uint32_t seq = 0U;
+
+    if ( true == filter_seqlock_publish_begin( &p_band->lock, &seq ))
+    {
+        p_band->alpha_cr_new    = p_band->alpha_cr;
+        p_band->alpha_rc_new    = p_band->alpha_rc;
+        p_band->fc_cr_new       = p_band->fc_cr;
+        p_band->fc_rc_new       = p_band->fc_rc;
+
+        filter_seqlock_publish_end( &p_band->lock, seq );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Publish integer boolean filter parameters set in sample path
+*
+* @param[in]    p_filter    - Integer boolean filter
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void filter_bool_cnt_param_publish(filter_bool_cnt_t * const p_filter)
+{
+    uint32_t seq = 0U;
+
+    if ( true == filter_seqlock_publish_begin( &p_filter->lock, &seq ))
+    {
+        p_filter->fc_new        = p_filter->fc;
+        p_filter->alpha_new     = p_filter->alpha;
+        p_filter->lvl_on_new    = p_filter->lvl_on;
+        p_filter->lvl_off_new   = p_filter->lvl_off;
+
+        filter_seqlock_publish_end( &p_filter->lock, seq );
+    }
+}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FILTER_API
+* @{ <!-- BEGIN GROUP -->
+*
+*   Following functions are part of API calls.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*   Initialize RC filter
+*
+* @note Order of RC filter is represented as number of cascaded RC
+*        analog equivalent circuits!
+*
+* @note Fs and order cannot be change later!
+*
+* @param[in]    p_filter_inst   - Pointer to RC filter instance
+* @param[in]    fc              - Filter cutoff frequency
+* @param[in]    fs              - Sample frequency
+* @param[in]    order           - Order of filter (number of cascaded filter)
+* @param[in]    init_value      - Initial value
+* @return       status          - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_rc_init(p_filter_rc_t * p_filter_inst, const float32_t fc, const float32_t fs, const uint8_t order, const float32_t init_value)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if (( NULL != p_filter_inst ) && ( order > 0UL ))
+    {
+        // Allocate space
+        *p_filter_inst          = malloc( sizeof( filter_rc_t ));
+        (*p_filter_inst)->p_y   = malloc( order  * sizeof( float32_t ));
+
+        // Check if allocation succeed
+        if  (   ( NULL != *p_filter_inst )
+            &&  ( NULL != (*p_filter_inst)->p_y ))
+        {
+            // Calculate coefficient
+            status = filter_rc_calculate_alpha( fc, fs, &(*p_filter_inst)->alpha );
+
+            if ( eFILTER_OK == status )
+            {
+                // Store order & fc
+                (*p_filter_inst)->order = order;
+                (*p_filter_inst)->fc = fc;
+                (*p_filter_inst)->fs = fs;
+                (*p_filter_inst)->w_scale = ( FILTER_TWOPI / fs );
+
+                #if ( 1 == FILTER_CFG_ATOMIC_EN )
+                    // Concurrent setter starts from init parameters
+                    (*p_filter_inst)->alpha_new = (*p_filter_inst)->alpha;
+                    (*p_filter_inst)->fc_new = fc;
+                    filter_seqlock_init( &(*p_filter_inst)->lock );
+                    atomic_init( &(*p_filter_inst)->fc_pend, fc );
+                    atomic_init( &(*p_filter_inst)->fc_dirty, false );
+                #endif
+
+                // Initial value
+                for ( uint32_t i = 0; i < order; i++)
+                {
+                    (*p_filter_inst)->p_y[i] = init_value;
+                }
+
+                // Init success
+                (*p_filter_inst)->is_init = true;
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get initialization status of RC filter
+*
+* @param[in]    filter_inst - RC filter instance
+* @param[out]   p_is_init   - RC filter init state
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_rc_is_init(p_filter_rc_t filter_inst, bool * const p_is_init)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_is_init ))
+    {
+        *p_is_init = filter_inst->is_init;
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Handle RC filter
+*
+* @note This function must be called in equidistant time period defined by 1/fs!
+*
+* @param[in]    filter_inst - RC filter instance
+* @param[in]    in          - Input value
+* @param[out]   p_out       - Output (filtered) value
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_rc_hndl(p_filter_rc_t filter_inst, const float32_t in, float32_t * const p_out)
+{
+    filter_status_t status = eFILTER_OK;
+
+    // Check for instance and success init
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_out ))
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            // Apply concurrently set parameters
+            filter_rc_param_apply( filter_inst );
+
+            for ( uint32_t n = 0; n < filter_inst->order; n++)
+            {
+                if ( 0 == n )
+                {
+                    filter_inst->p_y[0] = ( filter_inst->p_y[0] + ( filter_inst->alpha * ( in - filter_inst->p_y[0] )));
+                }
+                else
+                {
+                    filter_inst->p_y[n] = ( filter_inst->p_y[n] + ( filter_inst->alpha * ( filter_inst->p_y[n-1] - filter_inst->p_y[n] )));
+                }
+            }
+
+            *p_out = filter_inst->p_y[ filter_inst->order - 1U ];
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Handle RC filter for block of samples
+*
+* @note This function must be called with samples taken in equidistant time
+*       period defined by 1/fs!
+*
+* @note Block is processed in groups of up to four cascaded stages, keeping
+*       stage states and alpha in registers for the whole block. Result
+*       equals to calling "filter_rc_hndl()" for each sample within
+*       floating point rounding.
+*
+* @note Input and output buffer can be the same (in-place processing).
+*
+* @param[in]    filter_inst - RC filter instance
+* @param[in]    p_in        - Input samples
+* @param[out]   p_out       - Output (filtered) samples
+* @param[in]    size        - Number of samples
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_rc_hndl_block(p_filter_rc_t filter_inst, const float32_t * const p_in, float32_t * const p_out, const uint32_t size)
+{
+    filter_status_t     status  = eFILTER_OK;
+    const float32_t *   p_x     = p_in;
+    uint32_t            n       = 0U;
+
+    // Check for instance and success init
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_in )
+        &&  ( NULL != p_out ))
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            // Apply concurrently set parameters
+            filter_rc_param_apply( filter_inst );
+
+            // Groups of four stages
+            for ( ; ( n + 4U ) <= filter_inst->order; n += 4U )
+            {
+                filter_rc_block_stage_4( &filter_inst->p_y[n], filter_inst->alpha, p_x, p_out, size );
+
+                // Next stages are applied in-place
+                p_x = p_out;
+            }
+
+            // Remaining stages
+            for ( ; n < filter_inst->order; n++ )
+            {
+                filter_rc_block_stage_1( &filter_inst->p_y[n], filter_inst->alpha, p_x, p_out, size );
+                p_x = p_out;
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Handle RC filter for block of samples with per sample cutoff frequency
+*
+* @brief    Intended for adaptive smoothing where cutoff frequency is changed
+*           every sample. Alpha is calculated without division and without
+*           validation, see "filter_rc_fc_set_fast()" for details.
+*
+* @note This function must be called with samples taken in equidistant time
+*       period defined by 1/fs!
+*
+* @note Last used cutoff frequency, clamped to range [0, fs/2], remains set
+*       after the call.
+*
+* @note Input and output buffer can be the same (in-place processing).
+*
+* @param[in]    filter_inst - RC filter instance
+* @param[in]    p_in        - Input samples
+* @param[in]    p_fc        - Cutoff frequency for each sample
+* @param[out]   p_out       - Output (filtered) samples
+* @param[in]    size        - Number of samples
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_rc_hndl_block_fc(p_filter_rc_t filter_inst, const float32_t * const p_in, const float32_t * const p_fc, float32_t * const p_out, const uint32_t size)
+{
+    filter_status_t status = eFILTER_OK;
+
+    // Check for instance and success init
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_in )
+        &&  ( NULL != p_fc )
+        &&  ( NULL != p_out ))
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            float32_t * const   p_y     = filter_inst->p_y;
+            float32_t           alpha   = filter_inst->alpha;
+
+            for ( uint32_t i = 0U; i < size; i++ )
+            {
+                const float32_t w = filter_fast_w( p_fc[i], filter_inst->w_scale );
+                float32_t       x = p_in[i];
+
+                // alpha = w / ( 1 + w )
+                alpha = ( w * filter_fast_recip( 1.0f + w ));
+
+                for ( uint32_t n = 0U; n < filter_inst->order; n++ )
+                {
+                    p_y[n] = ( p_y[n] + ( alpha * ( x - p_y[n] )));
+                    x = p_y[n];
+                }
+
+                p_out[i] = x;
+            }
+
+            // Store last cutoff
+            if ( size > 0U )
+            {
+                filter_inst->alpha  = alpha;
+                filter_inst->fc     = filter_fast_fc_lim( p_fc[ size - 1U ], filter_inst->fs );
+                filter_rc_param_publish( filter_inst );
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Handle RC filter with irregular time step
+*
+* @brief    Intended for event driven signals, where samples are not taken
+*           in equidistant time period. Alpha is calculated for each step
+*           as exact discretization of analog RC filter for input held
+*           constant during time step:
+*
+*               alpha = 1 - e^(-2*pi*fc*dt)
+*
+*           using fast exponent approximation (relative error below 1e-5).
+*
+* @note     Sample frequency of the instance is not used. For dt = 1/fs alpha
+*           is slightly different than one used by "filter_rc_hndl()", as
+*           discretization methods differ. Both converge for fc << fs.
+*
+* @param[in]    filter_inst - RC filter instance
+* @param[in]    in          - Input value
+* @param[in]    dt          - Time elapsed from previous sample in seconds
+* @param[out]   p_out       - Output (filtered) value
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_rc_hndl_dt(p_filter_rc_t filter_inst, const float32_t in, const float32_t dt, float32_t * const p_out)
+{
+    filter_status_t status = eFILTER_OK;
+
+    // Check for instance and success init
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_out )
+        &&  ( dt >= 0.0f ))
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            // Apply concurrently set parameters
+            filter_rc_param_apply( filter_inst );
+
+            const float32_t alpha   = filter_rc_dt_alpha( FILTER_TWOPI * filter_inst->fc * dt );
+            float32_t       x       = in;
+
+            for ( uint32_t n = 0U; n < filter_inst->order; n++ )
+            {
+                filter_inst->p_y[n] = ( filter_inst->p_y[n] + ( alpha * ( x - filter_inst->p_y[n] )));
+                x = filter_inst->p_y[n];
+            }
+
+            *p_out = x;
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Reset RC filter buffers
+*
+* @param[in]    filter_inst - RC filter instance
+* @param[in]    rst_value   - Reset value
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_rc_reset(p_filter_rc_t filter_inst, const float32_t rst_value)
+{
+    filter_status_t status  = eFILTER_OK;
+
+    if ( NULL != filter_inst )
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            // Initial value
+            for ( uint32_t i = 0; i < filter_inst->order; i++)
+            {
+                filter_inst->p_y[i] = rst_value;
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set cutoff frequency of RC filter on-the-fly
+*
+* @param[in]    filter_inst - RC filter instance
+* @param[in]    fc          - Cutoff frequency
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_rc_fc_set(p_filter_rc_t filter_inst, const float32_t fc)
+{
+    filter_status_t status     = eFILTER_OK;
+    float32_t         alpha    = 0.0f;
+
+    if ( NULL != filter_inst )
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            // Calculate new alpha
+            status = filter_rc_calculate_alpha( fc, filter_inst->fs, &alpha );
+
+            // Store data for newly set cutoff
+            if ( eFILTER_OK == status )
+            {
+                filter_inst->alpha = alpha;
+                filter_inst->fc = fc;
+                filter_rc_param_publish( filter_inst );
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set cutoff frequency of RC filter on-the-fly, fast variant
+*
+* @brief    Intended for frequent (e.g. every sample) cutoff modulation.
+*           Alpha is calculated as:
+*
+*               alpha = w / ( 1 + w ), where w = 2*pi*fc/fs
+*
+*           with reciprocal approximation instead of division. Relative
+*           error of alpha compared to "filter_rc_fc_set()" is below 1e-5
+*           over complete cutoff range.
+*
+* @note     Cutoff frequency is not validated, values outside range [0, fs/2]
+*           are clamped to that range and clamped value is stored, thus
+*           read back by "fc_get" function!
+*
+* @param[in]    filter_inst - RC filter instance
+* @param[in]    fc          - Cutoff frequency
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_rc_fc_set_fast(p_filter_rc_t filter_inst, const float32_t fc)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if ( NULL != filter_inst )
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            const float32_t fc_lim  = filter_fast_fc_lim( fc, filter_inst->fs );
+            const float32_t w       = filter_fast_w( fc_lim, filter_inst->w_scale );
+
+            filter_inst->alpha = ( w * filter_fast_recip( 1.0f + w ));
+            filter_inst->fc = fc_lim;
+            filter_rc_param_publish( filter_inst );
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+#if ( 1 == FILTER_CFG_ATOMIC_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set cutoff frequency of RC filter, deferred
+*
+* @brief    Only records cutoff frequency and marks it dirty. Alpha is
+*           calculated once at start of next handle call, so burst of
+*           cutoff changes in between samples costs single calculation.
+*
+* @note     Can be called from other thread than sample path, only last
+*           value set before handle call is applied.
+*
+* @param[in]    filter_inst - RC filter instance
+* @param[in]    fc          - Cutoff frequency
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_rc_fc_set_deferred(p_filter_rc_t filter_inst, const float32_t fc)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if ( NULL != filter_inst )
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            // Check Nyquist/Shannon sampling theorem
+            if ( ( fc > 0.0f ) && ( fc < ( filter_inst->fs / 2.0f )) )
+            {
+                atomic_store_explicit( &filter_inst->fc_pend, fc, memory_order_relaxed );
+                atomic_store_explicit( &filter_inst->fc_dirty, true, memory_order_release );
+            }
+            else
+            {
+                status = eFILTER_ERROR;
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get RC filter cutoff frequency
+*
+* @param[in]    filter_inst - RC filter instance
+* @param[out]   p_fc        - Filter cutoff frequency in Hz
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_rc_fc_get(p_filter_rc_t filter_inst, float32_t * const p_fc)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_fc ))
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            *p_fc = filter_inst->fc;
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+#if ( 1 == FILTER_CFG_ATOMIC_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set cutoff frequency of RC filter from concurrent (control) thread
+*
+* @brief    New parameters are published with sequence lock and taken by
+*           sample path at start of next "filter_rc_hndl()" call. Sample
+*           path never waits, if it hits update in progress it keeps old
+*           parameters for one more call.
+*
+* @note     "filter_rc_fc_set()" and "filter_rc_fc_set_fast()" can be used
+*           along, but must be called from sample path thread only! Update
+*           from this function pending at their call takes precedence.
+*
+* @param[in]    filter_inst - RC filter instance
+* @param[in]    fc          - Cutoff frequency
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_rc_fc_set_atomic(p_filter_rc_t filter_inst, const float32_t fc)
+{
+    filter_status_t status  = eFILTER_OK;
+    float32_t       alpha   = 0.0f;
+
+    if ( NULL != filter_inst )
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            // Calculate new alpha
+            status = filter_rc_calculate_alpha( fc, filter_inst->fs, &alpha );
+
+            // Publish data for newly set cutoff
+            if ( eFILTER_OK == status )
+            {
+                filter_seqlock_write_begin( &filter_inst->lock );
+
+                filter_inst->alpha_new  = alpha;
+                filter_inst->fc_new     = fc;
+
+                filter_seqlock_write_end( &filter_inst->lock );
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get RC filter cutoff frequency from concurrent (control) thread
+*
+* @note     Returns cutoff last set by "filter_rc_fc_set_atomic()", even if
+*           sample path did not apply it yet, or by sample path setters
+*           (plain, fast, block and deferred, latter once applied).
+*
+* @param[in]    filter_inst - RC filter instance
+* @param[out]   p_fc        - Filter cutoff frequency in Hz
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_rc_fc_get_atomic(p_filter_rc_t filter_inst, float32_t * const p_fc)
+{
+    filter_status_t status  = eFILTER_OK;
+    uint32_t        seq     = 0U;
+    bool            valid   = false;
+
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_fc ))
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            // Retry until consistent snapshot is taken
+            do
+            {
+                valid   = filter_seqlock_read_begin( &filter_inst->lock, &seq );
+                *p_fc   = filter_inst->fc_new;
+
+            } while (( false == valid ) || ( false == filter_seqlock_read_end( &filter_inst->lock, seq )));
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get RC filter sampling frequency
+*
+* @param[in]    filter_inst - RC filter instance
+* @param[out]   p_fs        - Filter sampling frequency in Hz
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_rc_fs_get(p_filter_rc_t filter_inst, float32_t * const p_fs)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_fs ))
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            *p_fs = filter_inst->fs;
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*   Initialize CR filter
+*
+* @note    Order of CR filter is represented as number of cascaded CR
+*        analog equivalent circuits!
+*
+* @note Fs and order cannot be change later!
+*
+* @param[in]    p_filter_inst   - Pointer to CR filter instance
+* @param[in]    fc              - Filter cutoff frequency
+* @param[in]    fs              - Sample frequency
+* @param[in]    order           - Order of filter (number of cascaded filter)
+* @return       status          - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_cr_init(p_filter_cr_t * p_filter_inst, const float32_t fc, const float32_t fs, const uint8_t order)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if (( NULL != p_filter_inst ) && ( order > 0UL ))
+    {
+        // Allocate space
+        *p_filter_inst          = malloc( sizeof( filter_cr_t ));
+        (*p_filter_inst)->p_y   = malloc( order  * sizeof( float32_t ));
+        (*p_filter_inst)->p_x   = malloc( order  * sizeof( float32_t ));
+
+        // Check if allocation succeed
+        if  (   ( NULL != *p_filter_inst )
+            &&  ( NULL != (*p_filter_inst)->p_y )
+            &&  ( NULL != (*p_filter_inst)->p_x ))
+        {
+            // Calculate coefficient
+            status = filter_cr_calculate_alpha( fc, fs, &(*p_filter_inst)->alpha );
+
+            if ( eFILTER_OK == status )
+            {
+                // Store order & fc
+                (*p_filter_inst)->order = order;
+                (*p_filter_inst)->fc = fc;
+                (*p_filter_inst)->fs = fs;
+                (*p_filter_inst)->w_scale = ( FILTER_TWOPI / fs );
+
+                #if ( 1 == FILTER_CFG_ATOMIC_EN )
+                    // Concurrent setter starts from init parameters
+                    (*p_filter_inst)->alpha_new = (*p_filter_inst)->alpha;
+                    (*p_filter_inst)->fc_new = fc;
+                    filter_seqlock_init( &(*p_filter_inst)->lock );
+                    atomic_init( &(*p_filter_inst)->fc_pend, fc );
+                    atomic_init( &(*p_filter_inst)->fc_dirty, false );
+                #endif
+
+                // Initial value
+                for ( uint32_t i = 0; i < order; i++)
+                {
+                    (*p_filter_inst)->p_y[i] = 0.0f;
+                    (*p_filter_inst)->p_x[i] = 0.0f;
+                }
+
+                // Init success
+                (*p_filter_inst)->is_init = true;
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get initialization status of CR filter
+*
+* @param[in]    filter_inst - CR filter instance
+* @param[out]   p_is_init   - CR filter init state
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_cr_is_init(p_filter_cr_t filter_inst, bool * const p_is_init)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_is_init ))
+    {
+        *p_is_init = filter_inst->is_init;
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Handle CR filter
+*
+* @note This function must be called in equidistant time period defined by 1/fs!
+*
+* @param[in]    filter_inst - CR filter instance
+* @param[in]    in          - Input value
+* @param[out]   p_out       - Output (filtered) value
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_cr_hndl(p_filter_cr_t filter_inst, const float32_t in, float32_t * const p_out)
+{
+    filter_status_t status = eFILTER_OK;
+
+    // Check for instance and success init
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_out ))
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            // Apply concurrently set parameters
+            filter_cr_param_apply( filter_inst );
+
+            for ( uint32_t n = 0U; n < filter_inst->order; n++)
+            {
+                if ( 0U == n )
+                {
+                    filter_inst->p_y[0] = (( filter_inst->alpha * filter_inst->p_y[0] ) + ( filter_inst->alpha * ( in - filter_inst->p_x[0] )));
+                    filter_inst->p_x[0] = in;
+                }
+                else
+                {
+                    filter_inst->p_y[n] = (( filter_inst->alpha * filter_inst->p_y[n] ) + ( filter_inst->alpha * ( filter_inst->p_y[n-1] - filter_inst->p_x[n] )));
+                    filter_inst->p_x[n] = filter_inst->p_y[n-1];
+                }
+            }
+
+            *p_out = filter_inst->p_y[ filter_inst->order - 1U ];
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Handle CR filter for block of samples
+*
+* @note This function must be called with samples taken in equidistant time
+*       period defined by 1/fs!
+*
+* @note Block is processed in groups of up to four cascaded stages, keeping
+*       stage states and alpha in registers for the whole block. Result
+*       equals to calling "filter_cr_hndl()" for each sample within
+*       floating point rounding.
+*
+* @note Input and output buffer can be the same (in-place processing).
+*
+* @param[in]    filter_inst - CR filter instance
+* @param[in]    p_in        - Input samples
+* @param[out]   p_out       - Output (filtered) samples
+* @param[in]    size        - Number of samples
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_cr_hndl_block(p_filter_cr_t filter_inst, const float32_t * const p_in, float32_t * const p_out, const uint32_t size)
+{
+    filter_status_t     status  = eFILTER_OK;
+    const float32_t *   p_x     = p_in;
+    uint32_t            n       = 0U;
+
+    // Check for instance and success init
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_in )
+        &&  ( NULL != p_out ))
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            // Apply concurrently set parameters
+            filter_cr_param_apply( filter_inst );
+
+            // Groups of four stages
+            for ( ; ( n + 4U ) <= filter_inst->order; n += 4U )
+            {
+                filter_cr_block_stage_4( &filter_inst->p_y[n], &filter_inst->p_x[n], filter_inst->alpha, p_x, p_out, size );
+
+                // Next stages are applied in-place
+                p_x = p_out;
+            }
+
+            // Remaining stages
+            for ( ; n < filter_inst->order; n++ )
+            {
+                filter_cr_block_stage_1( &filter_inst->p_y[n], &filter_inst->p_x[n], filter_inst->alpha, p_x, p_out, size );
+                p_x = p_out;
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Handle CR filter for block of samples with per sample cutoff frequency
+*
+* @brief    Intended for adaptive smoothing where cutoff frequency is changed
+*           every sample. Alpha is calculated without division and without
+*           validation, see "filter_cr_fc_set_fast()" for details.
+*
+* @note This function must be called with samples taken in equidistant time
+*       period defined by 1/fs!
+*
+* @note Last used cutoff frequency, clamped to range [0, fs/2], remains set
+*       after the call.
+*
+* @note Input and output buffer can be the same (in-place processing).
+*
+* @param[in]    filter_inst - CR filter instance
+* @param[in]    p_in        - Input samples
+* @param[in]    p_fc        - Cutoff frequency for each sample
+* @param[out]   p_out       - Output (filtered) samples
+* @param[in]    size        - Number of samples
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_cr_hndl_block_fc(p_filter_cr_t filter_inst, const float32_t * const p_in, const float32_t * const p_fc, float32_t * const p_out, const uint32_t size)
+{
+    filter_status_t status = eFILTER_OK;
+
+    // Check for instance and success init
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_in )
+        &&  ( NULL != p_fc )
+        &&  ( NULL != p_out ))
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            float32_t * const   p_y     = filter_inst->p_y;
+            float32_t * const   p_x     = filter_inst->p_x;
+            float32_t           alpha   = filter_inst->alpha;
+
+            for ( uint32_t i = 0U; i < size; i++ )
+            {
+                const float32_t w = filter_fast_w( p_fc[i], filter_inst->w_scale );
+                float32_t       x = p_in[i];
+
+                // alpha = 1 / ( 1 + w )
+                alpha = filter_fast_recip( 1.0f + w );
+
+                for ( uint32_t n = 0U; n < filter_inst->order; n++ )
+                {
+                    const float32_t x_1 = p_x[n];
+
+                    p_x[n] = x;
+                    p_y[n] = (( alpha * p_y[n] ) + ( alpha * ( x - x_1 )));
+                    x = p_y[n];
+                }
+
+                p_out[i] = x;
+            }
+
+            // Store last cutoff
+            if ( size > 0U )
+            {
+                filter_inst->alpha  = alpha;
+                filter_inst->fc     = filter_fast_fc_lim( p_fc[ size - 1U ], filter_inst->fs );
+                filter_cr_param_publish( filter_inst );
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Handle CR filter with irregular time step
+*
+* @brief    Intended for event driven signals, where samples are not taken
+*           in equidistant time period. Alpha is calculated for each step
+*           as exact discretization of analog CR filter for input changing
+*           in steps at sample instants:
+*
+*               alpha = e^(-2*pi*fc*dt)
+*
+*           using fast exponent approximation (relative error below 1e-5).
+*
+* @note     Sample frequency of the instance is not used. For dt = 1/fs alpha
+*           is slightly different than one used by "filter_cr_hndl()", as
+*           discretization methods differ. Both converge for fc << fs.
+*
+* @param[in]    filter_inst - CR filter instance
+* @param[in]    in          - Input value
+* @param[in]    dt          - Time elapsed from previous sample in seconds
+* @param[out]   p_out       - Output (filtered) value
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_cr_hndl_dt(p_filter_cr_t filter_inst, const float32_t in, const float32_t dt, float32_t * const p_out)
+{
+    filter_status_t status = eFILTER_OK;
+
+    // Check for instance and success init
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_out )
+        &&  ( dt >= 0.0f ))
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            // Apply concurrently set parameters
+            filter_cr_param_apply( filter_inst );
+
+            const float32_t alpha   = filter_fast_exp_neg( FILTER_TWOPI * filter_inst->fc * dt );
+            float32_t       x       = in;
+
+            for ( uint32_t n = 0U; n < filter_inst->order; n++ )
+            {
+                const float32_t x_1 = filter_inst->p_x[n];
+
+                filter_inst->p_x[n] = x;
+                filter_inst->p_y[n] = ( alpha * (( filter_inst->p_y[n] + x ) - x_1 ));
+                x = filter_inst->p_y[n];
+            }
+
+            *p_out = x;
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Reset CR filter buffers
+*
+* @param[in]    filter_inst - CR filter instance
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_cr_reset(p_filter_cr_t filter_inst)
+{
+    filter_status_t status  = eFILTER_OK;
+
+    if ( NULL != filter_inst )
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            // Initial value
+            for ( uint32_t i = 0U; i < filter_inst->order; i++ )
+            {
+                filter_inst->p_y[i] = 0.0f;
+                filter_inst->p_x[i] = 0.0f;
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set cutoff frequency of CR filter on-the-fly
+*
+* @param[in]    filter_inst - CR filter instance
+* @param[in]    fc          - Cutoff frequency
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_cr_fc_set(p_filter_cr_t filter_inst, const float32_t fc)
+{
+    filter_status_t status  = eFILTER_OK;
+    float32_t       alpha   = 0.0f;
+
+    if ( NULL != filter_inst )
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            // Calculate new alpha
+            status = filter_cr_calculate_alpha( fc, filter_inst->fs, &alpha );
+
+            // Store data for newly set cutoff
+            if ( eFILTER_OK == status )
+            {
+                filter_inst->alpha = alpha;
+                filter_inst->fc = fc;
+                filter_cr_param_publish( filter_inst );
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set cutoff frequency of CR filter on-the-fly, fast variant
+*
+* @brief    Intended for frequent (e.g. every sample) cutoff modulation.
+*           Alpha is calculated as:
+*
+*               alpha = 1 / ( 1 + w ), where w = 2*pi*fc/fs
+*
+*           with reciprocal approximation instead of division. Relative
+*           error of alpha compared to "filter_cr_fc_set()" is below 1e-5
+*           over complete cutoff range.
+*
+* @note     Cutoff frequency is not validated, values outside range [0, fs/2]
+*           are clamped to that range and clamped value is stored, thus
+*           read back by "fc_get" function!
+*
+* @param[in]    filter_inst - CR filter instance
+* @param[in]    fc          - Cutoff frequency
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_cr_fc_set_fast(p_filter_cr_t filter_inst, const float32_t fc)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if ( NULL != filter_inst )
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            const float32_t fc_lim  = filter_fast_fc_lim( fc, filter_inst->fs );
+            const float32_t w       = filter_fast_w( fc_lim, filter_inst->w_scale );
+
+            filter_inst->alpha = filter_fast_recip( 1.0f + w );
+            filter_inst->fc = fc_lim;
+            filter_cr_param_publish( filter_inst );
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+#if ( 1 == FILTER_CFG_ATOMIC_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set cutoff frequency of CR filter, deferred
+*
+* @brief    Only records cutoff frequency and marks it dirty. Alpha is
+*           calculated once at start of next handle call, so burst of
+*           cutoff changes in between samples costs single calculation.
+*
+* @note     Can be called from other thread than sample path, only last
+*           value set before handle call is applied.
+*
+* @param[in]    filter_inst - CR filter instance
+* @param[in]    fc          - Cutoff frequency
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_cr_fc_set_deferred(p_filter_cr_t filter_inst, const float32_t fc)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if ( NULL != filter_inst )
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            // Check Nyquist/Shannon sampling theorem
+            if ( ( fc > 0.0f ) && ( fc < ( filter_inst->fs / 2.0f )) )
+            {
+                atomic_store_explicit( &filter_inst->fc_pend, fc, memory_order_relaxed );
+                atomic_store_explicit( &filter_inst->fc_dirty, true, memory_order_release );
+            }
+            else
+            {
+                status = eFILTER_ERROR;
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get CR filter cutoff frequency
+*
+* @param[in]    filter_inst - CR filter instance
+* @param[out]   p_fc        - Filter cutoff frequency in Hz
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_cr_fc_get(p_filter_cr_t filter_inst, float32_t * const p_fc)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_fc ))
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            *p_fc = filter_inst->fc;
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+#if ( 1 == FILTER_CFG_ATOMIC_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set cutoff frequency of CR filter from concurrent (control) thread
+*
+* @brief    New parameters are published with sequence lock and taken by
+*           sample path at start of next "filter_cr_hndl()" call. Sample
+*           path never waits, if it hits update in progress it keeps old
+*           parameters for one more call.
+*
+* @note     "filter_cr_fc_set()" and "filter_cr_fc_set_fast()" can be used
+*           along, but must be called from sample path thread only! Update
+*           from this function pending at their call takes precedence.
+*
+* @param[in]    filter_inst - CR filter instance
+* @param[in]    fc          - Cutoff frequency
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_cr_fc_set_atomic(p_filter_cr_t filter_inst, const float32_t fc)
+{
+    filter_status_t status  = eFILTER_OK;
+    float32_t       alpha   = 0.0f;
+
+    if ( NULL != filter_inst )
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            // Calculate new alpha
+            status = filter_cr_calculate_alpha( fc, filter_inst->fs, &alpha );
+
+            // Publish data for newly set cutoff
+            if ( eFILTER_OK == status )
+            {
+                filter_seqlock_write_begin( &filter_inst->lock );
+
+                filter_inst->alpha_new  = alpha;
+                filter_inst->fc_new     = fc;
+
+                filter_seqlock_write_end( &filter_inst->lock );
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get CR filter cutoff frequency from concurrent (control) thread
+*
+* @note     Returns cutoff last set by "filter_cr_fc_set_atomic()", even if
+*           sample path did not apply it yet, or by sample path setters
+*           (plain, fast, block and deferred, latter once applied).
+*
+* @param[in]    filter_inst - CR filter instance
+* @param[out]   p_fc        - Filter cutoff frequency in Hz
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_cr_fc_get_atomic(p_filter_cr_t filter_inst, float32_t * const p_fc)
+{
+    filter_status_t status  = eFILTER_OK;
+    uint32_t        seq     = 0U;
+    bool            valid   = false;
+
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_fc ))
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            // Retry until consistent snapshot is taken
+            do
+            {
+                valid   = filter_seqlock_read_begin( &filter_inst->lock, &seq );
+                *p_fc   = filter_inst->fc_new;
+
+            } while (( false == valid ) || ( false == filter_seqlock_read_end( &filter_inst->lock, seq )));
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get CR filter sampling frequency
+*
+* @param[in]    filter_inst - CR filter instance
+* @param[out]   p_fs        - Filter sampling frequency in Hz
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_cr_fs_get(p_filter_cr_t filter_inst, float32_t * const p_fs)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_fs ))
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            *p_fs = filter_inst->fs;
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*   Initialize RC filter bank
+*
+* @brief    Filter bank holds multiple independent RC filters (channels) of
+*           same order and sample frequency. Alphas and cascade states
+*           of all channels are stored in contiguous arrays, so that single
+*           call updates all channels and channels are processed with SIMD
+*           instructions where available (AVX2/AVX-512).
+*
+* @note     All channels start with same cutoff frequency. Use
+*           "filter_rc_bank_fc_set()" for per channel cutoff frequency.
+*
+* @note Fs, order and number of channels cannot be change later!
+*
+* @param[in]    p_bank_inst - Pointer to RC filter bank instance
+* @param[in]    num_of_ch   - Number of channels
+* @param[in]    fc          - Filter cutoff frequency
+* @param[in]    fs          - Sample frequency
+* @param[in]    order       - Order of filter (number of cascaded filter)
+* @param[in]    init_value  - Initial value
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_rc_bank_init(p_filter_rc_bank_t * p_bank_inst, const uint32_t num_of_ch, const float32_t fc, const float32_t fs, const uint8_t order, const float32_t init_value)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != p_bank_inst )
+        &&  ( num_of_ch > 0UL )
+        &&  ( order > 0UL ))
+    {
+        // Allocate space
+        *p_bank_inst = malloc( sizeof( filter_rc_bank_t ));
+
+        if ( NULL != *p_bank_inst )
+        {
+            (*p_bank_inst)->p_y         = malloc( order * num_of_ch * sizeof( float32_t ));
+            (*p_bank_inst)->p_alpha     = malloc( num_of_ch * sizeof( float32_t ));
+            (*p_bank_inst)->p_fc        = malloc( num_of_ch * sizeof( float32_t ));
+            (*p_bank_inst)->is_init     = false;
+
+            #if ( 1 == FILTER_CFG_ATOMIC_EN )
+                (*p_bank_inst)->p_par_new   = malloc( 4U * num_of_ch * sizeof( float32_t ));
+            #endif
+        }
+
+        // Check if allocation succeed
+        if  (   ( NULL != *p_bank_inst )
+            &&  ( NULL != (*p_bank_inst)->p_y )
+            &&  ( NULL != (*p_bank_inst)->p_alpha )
+            #if ( 1 == FILTER_CFG_ATOMIC_EN )
+            &&  ( NULL != (*p_bank_inst)->p_par_new )
+            #endif
+            &&  ( NULL != (*p_bank_inst)->p_fc ))
+        {
+            // Same cutoff for all channels
+            for ( uint32_t ch = 0U; ch < num_of_ch; ch++ )
+            {
+                (*p_bank_inst)->p_fc[ch] = fc;
+            }
+
+            // Calculate coefficients
+            status = filter_rc_calculate_alpha_vec( (*p_bank_inst)->p_fc, fs, (*p_bank_inst)->p_alpha, num_of_ch );
+
+            if ( eFILTER_OK == status )
+            {
+                // Store configuration
+                (*p_bank_inst)->num_of_ch   = num_of_ch;
+                (*p_bank_inst)->order       = order;
+                (*p_bank_inst)->fs          = fs;
+
+                #if ( 1 == FILTER_CFG_ATOMIC_EN )
+                    // Concurrent setter starts from init parameters
+                    (*p_bank_inst)->p_par_stage = &(*p_bank_inst)->p_par_new[ 2U * num_of_ch ];
+                    memcpy( (*p_bank_inst)->p_par_new, (*p_bank_inst)->p_alpha, ( num_of_ch * sizeof( float32_t )));
+                    memcpy( &(*p_bank_inst)->p_par_new[num_of_ch], (*p_bank_inst)->p_fc, ( num_of_ch * sizeof( float32_t )));
+                    filter_seqlock_init( &(*p_bank_inst)->lock );
+                #endif
+
+                // Initial value
+                for ( uint32_t i = 0U; i < ( order * num_of_ch ); i++ )
+                {
+                    (*p_bank_inst)->p_y[i] = init_value;
+                }
+
+                // Init success
+                (*p_bank_inst)->is_init = true;
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get initialization status of RC filter bank
+*
+* @param[in]    bank_inst   - RC filter bank instance
+* @param[out]   p_is_init   - RC filter bank init state
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_rc_bank_is_init(p_filter_rc_bank_t bank_inst, bool * const p_is_init)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != bank_inst )
+        &&  ( NULL != p_is_init ))
+    {
+        *p_is_init = bank_inst->is_init;
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Handle RC filter bank
+*
+* @note This function must be called in equidistant time period defined by 1/fs!
+*
+* @note Each channel is updated exactly as by "filter_rc_hndl()".
+*
+* @param[in]    bank_inst   - RC filter bank instance
+* @param[in]    p_in        - Input values, one per channel
+* @param[out]   p_out       - Output (filtered) values, one per channel
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_rc_bank_hndl(p_filter_rc_bank_t bank_inst, const float32_t * const p_in, float32_t * const p_out)
+{
+    filter_status_t status  = eFILTER_OK;
+    uint32_t        ch      = 0U;
+
+    // Check for instance and success init
+    if  (   ( NULL != bank_inst )
+        &&  ( NULL != p_in )
+        &&  ( NULL != p_out ))
+    {
+        // Is instance init?
+        if ( true == bank_inst->is_init )
+        {
+            const uint32_t num_of_ch = bank_inst->num_of_ch;
+
+            // Take parameters set by concurrent setter
+            filter_rc_bank_param_apply( bank_inst );
+
+            #if defined( __AVX512F__ )
+                for ( ; ( ch + 16U ) <= num_of_ch; ch += 16U )
+                {
+                    const __m512 v_alpha = _mm512_loadu_ps( &bank_inst->p_alpha[ch] );
+                    __m512       v_x     = _mm512_loadu_ps( &p_in[ch] );
+
+                    for ( uint32_t n = 0U; n < bank_inst->order; n++ )
+                    {
+                        float32_t * const p_y = &bank_inst->p_y[( n * num_of_ch ) + ch];
+                        const __m512      v_y = _mm512_loadu_ps( p_y );
+
+                        v_x = _mm512_add_ps( v_y, _mm512_mul_ps( v_alpha, _mm512_sub_ps( v_x, v_y )));
+                        _mm512_storeu_ps( p_y, v_x );
+                    }
+
+                    _mm512_storeu_ps( &p_out[ch], v_x );
+                }
+            #elif defined( __AVX2__ )
+                for ( ; ( ch + 8U ) <= num_of_ch; ch += 8U )
+                {
+                    const __m256 v_alpha = _mm256_loadu_ps( &bank_inst->p_alpha[ch] );
+                    __m256       v_x     = _mm256_loadu_ps( &p_in[ch] );
+
+                    for ( uint32_t n = 0U; n < bank_inst->order; n++ )
+                    {
+                        float32_t * const p_y = &bank_inst->p_y[( n * num_of_ch ) + ch];
+                        const __m256      v_y = _mm256_loadu_ps( p_y );
+
+                        v_x = _mm256_add_ps( v_y, _mm256_mul_ps( v_alpha, _mm256_sub_ps( v_x, v_y )));
+                        _mm256_storeu_ps( p_y, v_x );
+                    }
+
+                    _mm256_storeu_ps( &p_out[ch], v_x );
+                }
+            #endif
+
+            // Remaining channels
+            for ( ; ch < num_of_ch; ch++ )
+            {
+                const float32_t alpha   = bank_inst->p_alpha[ch];
+                float32_t       x       = p_in[ch];
+
+                for ( uint32_t n = 0U; n < bank_inst->order; n++ )
+                {
+                    float32_t * const p_y = &bank_inst->p_y[( n * num_of_ch ) + ch];
+
+                    x = ( *p_y + ( alpha * ( x - *p_y )));
+                    *p_y = x;
+                }
+
+                p_out[ch] = x;
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Reset RC filter bank buffers
+*
+* @param[in]    bank_inst   - RC filter bank instance
+* @param[in]    rst_value   - Reset value
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_rc_bank_reset(p_filter_rc_bank_t bank_inst, const float32_t rst_value)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if ( NULL != bank_inst )
+    {
+        // Is instance init?
+        if ( true == bank_inst->is_init )
+        {
+            for ( uint32_t i = 0U; i < ( bank_inst->order * bank_inst->num_of_ch ); i++ )
+            {
+                bank_inst->p_y[i] = rst_value;
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set cutoff frequency of all RC filter bank channels on-the-fly
+*
+* @note     Cutoff frequencies are changed only if all of them are valid!
+*
+* @param[in]    bank_inst   - RC filter bank instance
+* @param[in]    p_fc        - Cutoff frequencies, one per channel
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_rc_bank_fc_set(p_filter_rc_bank_t bank_inst, const float32_t * const p_fc)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != bank_inst )
+        &&  ( NULL != p_fc ))
+    {
+        // Is instance init?
+        if ( true == bank_inst->is_init )
+        {
+            // Calculate new alphas
+            status = filter_rc_calculate_alpha_vec( p_fc, bank_inst->fs, bank_inst->p_alpha, bank_inst->num_of_ch );
+
+            // Store data for newly set cutoff
+            if ( eFILTER_OK == status )
+            {
+                memcpy( bank_inst->p_fc, p_fc, ( bank_inst->num_of_ch * sizeof( float32_t )));
+                filter_rc_bank_param_publish( bank_inst );
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set cutoff frequency of single RC filter bank channel on-the-fly
+*
+* @param[in]    bank_inst   - RC filter bank instance
+* @param[in]    ch          - Channel index
+* @param[in]    fc          - Cutoff frequency
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_rc_bank_ch_fc_set(p_filter_rc_bank_t bank_inst, const uint32_t ch, const float32_t fc)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if ( NULL != bank_inst )
+    {
+        // Is instance init?
+        if  (   ( true == bank_inst->is_init )
+            &&  ( ch < bank_inst->num_of_ch ))
+        {
+            // Calculate new alpha
+            status = filter_rc_calculate_alpha_vec( &fc, bank_inst->fs, &bank_inst->p_alpha[ch], 1U );
+
+            // Store data for newly set cutoff
+            if ( eFILTER_OK == status )
+            {
+                bank_inst->p_fc[ch] = fc;
+                filter_rc_bank_param_publish( bank_inst );
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get RC filter bank cutoff frequencies
+*
+* @param[in]    bank_inst   - RC filter bank instance
+* @param[out]   p_fc        - Filter cutoff frequencies in Hz, one per channel
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_rc_bank_fc_get(p_filter_rc_bank_t bank_inst, float32_t * const p_fc)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != bank_inst )
+        &&  ( NULL != p_fc ))
+    {
+        // Is instance init?
+        if ( true == bank_inst->is_init )
+        {
+            memcpy( p_fc, bank_inst->p_fc, ( bank_inst->num_of_ch * sizeof( float32_t )));
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+#if ( 1 == FILTER_CFG_ATOMIC_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set cutoff frequency of all RC filter bank channels from concurrent
+*       (control) thread
+*
+* @brief    New parameters are published with sequence lock and taken by
+*           sample path at start of next "filter_rc_bank_hndl()" call.
+*           Sample path never waits.
+*
+* @note     Cutoff frequencies are changed only if all of them are valid!
+*
+* @note     "filter_rc_bank_fc_set()" and "filter_rc_bank_ch_fc_set()" can
+*           be used along, but must be called from sample path thread only!
+*           Update from this function pending at their call takes precedence.
+*
+* @param[in]    bank_inst   - RC filter bank instance
+* @param[in]    p_fc        - Cutoff frequencies, one per channel
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_rc_bank_fc_set_atomic(p_filter_rc_bank_t bank_inst, const float32_t * const p_fc)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != bank_inst )
+        &&  ( NULL != p_fc ))
+    {
+        // Is instance init?
+        if  (   ( true == bank_inst->is_init )
+            &&  ( true == filter_bank_fc_is_valid( p_fc, bank_inst->fs, bank_inst->num_of_ch )))
+        {
+            filter_seqlock_write_begin( &bank_inst->lock );
+
+            (void) filter_rc_calculate_alpha_vec( p_fc, bank_inst->fs, bank_inst->p_par_new, bank_inst->num_of_ch );
+            memcpy( &bank_inst->p_par_new[ bank_inst->num_of_ch ], p_fc, ( bank_inst->num_of_ch * sizeof( float32_t )));
+
+            filter_seqlock_write_end( &bank_inst->lock );
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set cutoff frequency of single RC filter bank channel from
+*       concurrent (control) thread
+*
+* @note     See "filter_rc_bank_fc_set_atomic()".
+*
+* @param[in]    bank_inst   - RC filter bank instance
+* @param[in]    ch          - Channel index
+* @param[in]    fc          - Cutoff frequency
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_rc_bank_ch_fc_set_atomic(p_filter_rc_bank_t bank_inst, const uint32_t ch, const float32_t fc)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if ( NULL != bank_inst )
+    {
+        // Is instance init?
+        if  (   ( true == bank_inst->is_init )
+            &&  ( ch < bank_inst->num_of_ch )
+            &&  ( true == filter_bank_fc_is_valid( &fc, bank_inst->fs, 1U )))
+        {
+            filter_seqlock_write_begin( &bank_inst->lock );
+
+            (void) filter_rc_calculate_alpha_vec( &fc, bank_inst->fs, &bank_inst->p_par_new[ch], 1U );
+            bank_inst->p_par_new[ bank_inst->num_of_ch + ch ] = fc;
+
+            filter_seqlock_write_end( &bank_inst->lock );
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get RC filter bank cutoff frequencies from concurrent (control) thread
+*
+* @note     Returns cutoffs last set by "_atomic" setters, even if sample
+*           path did not apply them yet, or by sample path setters.
+*
+* @param[in]    bank_inst   - RC filter bank instance
+* @param[out]   p_fc        - Filter cutoff frequencies in Hz, one per channel
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_rc_bank_fc_get_atomic(p_filter_rc_bank_t bank_inst, float32_t * const p_fc)
+{
+    filter_status_t status  = eFILTER_OK;
+    uint32_t        seq     = 0U;
+    bool            valid   = false;
+
+    if  (   ( NULL != bank_inst )
+        &&  ( NULL != p_fc ))
+    {
+        // Is instance init?
+        if ( true == bank_inst->is_init )
+        {
+            // Retry until consistent snapshot is taken
+            do
+            {
+                valid = filter_seqlock_read_begin( &bank_inst->lock, &seq );
+                memcpy( p_fc, &bank_inst->p_par_new[ bank_inst->num_of_ch ], ( bank_inst->num_of_ch * sizeof( float32_t )));
+
+            } while (( false == valid ) || ( false == filter_seqlock_read_end( &bank_inst->lock, seq )));
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get RC filter bank sampling frequency
+*
+* @param[in]    bank_inst   - RC filter bank instance
+* @param[out]   p_fs        - Filter sampling frequency in Hz
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_rc_bank_fs_get(p_filter_rc_bank_t bank_inst, float32_t * const p_fs)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != bank_inst )
+        &&  ( NULL != p_fs ))
+    {
+        // Is instance init?
+        if ( true == bank_inst->is_init )
+        {
+            *p_fs = bank_inst->fs;
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*   Initialize CR filter bank
+*
+* @brief    Filter bank holds multiple independent CR filters (channels) of
+*           same order and sample frequency. Alphas and cascade states
+*           of all channels are stored in contiguous arrays, so that single
+*           call updates all channels and channels are processed with SIMD
+*           instructions where available (AVX2/AVX-512).
+*
+* @note     All channels start with same cutoff frequency. Use
+*           "filter_cr_bank_fc_set()" for per channel cutoff frequency.
+*
+* @note Fs, order and number of channels cannot be change later!
+*
+* @param[in]    p_bank_inst - Pointer to CR filter bank instance
+* @param[in]    num_of_ch   - Number of channels
+* @param[in]    fc          - Filter cutoff frequency
+* @param[in]    fs          - Sample frequency
+* @param[in]    order       - Order of filter (number of cascaded filter)
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_cr_bank_init(p_filter_cr_bank_t * p_bank_inst, const uint32_t num_of_ch, const float32_t fc, const float32_t fs, const uint8_t order)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != p_bank_inst )
+        &&  ( num_of_ch > 0UL )
+        &&  ( order > 0UL ))
+    {
+        // Allocate space
+        *p_bank_inst = malloc( sizeof( filter_cr_bank_t ));
+
+        if ( NULL != *p_bank_inst )
+        {
+            (*p_bank_inst)->p_y         = malloc( order * num_of_ch * sizeof( float32_t ));
+            (*p_bank_inst)->p_x         = malloc( order * num_of_ch * sizeof( float32_t ));
+            (*p_bank_inst)->p_alpha     = malloc( num_of_ch * sizeof( float32_t ));
+            (*p_bank_inst)->p_fc        = malloc( num_of_ch * sizeof( float32_t ));
+            (*p_bank_inst)->is_init     = false;
+
+            #if ( 1 == FILTER_CFG_ATOMIC_EN )
+                (*p_bank_inst)->p_par_new   = malloc( 4U * num_of_ch * sizeof( float32_t ));
+            #endif
+        }
+
+        // Check if allocation succeed
+        if  (   ( NULL != *p_bank_inst )
+            &&  ( NULL != (*p_bank_inst)->p_y )
+            &&  ( NULL != (*p_bank_inst)->p_x )
+            &&  ( NULL != (*p_bank_inst)->p_alpha )
+            #if ( 1 == FILTER_CFG_ATOMIC_EN )
+            &&  ( NULL != (*p_bank_inst)->p_par_new )
+            #endif
+            &&  ( NULL != (*p_bank_inst)->p_fc ))
+        {
+            // Same cutoff for all channels
+            for ( uint32_t ch = 0U; ch < num_of_ch; ch++ )
+            {
+                (*p_bank_inst)->p_fc[ch] = fc;
+            }
+
+            // Calculate coefficients
+            status = filter_cr_calculate_alpha_vec( (*p_bank_inst)->p_fc, fs, (*p_bank_inst)->p_alpha, num_of_ch );
+
+            if ( eFILTER_OK == status )
+            {
+                // Store configuration
+                (*p_bank_inst)->num_of_ch   = num_of_ch;
+                (*p_bank_inst)->order       = order;
+                (*p_bank_inst)->fs          = fs;
+
+                #if ( 1 == FILTER_CFG_ATOMIC_EN )
+                    // Concurrent setter starts from init parameters
+                    (*p_bank_inst)->p_par_stage = &(*p_bank_inst)->p_par_new[ 2U * num_of_ch ];
+                    memcpy( (*p_bank_inst)->p_par_new, (*p_bank_inst)->p_alpha, ( num_of_ch * sizeof( float32_t )));
+                    memcpy( &(*p_bank_inst)->p_par_new[num_of_ch], (*p_bank_inst)->p_fc, ( num_of_ch * sizeof( float32_t )));
+                    filter_seqlock_init( &(*p_bank_inst)->lock );
+                #endif
+
+                // Initial value
+                for ( uint32_t i = 0U; i < ( order * num_of_ch ); i++ )
+                {
+                    (*p_bank_inst)->p_y[i] = 0.0f;
+                    (*p_bank_inst)->p_x[i] = 0.0f;
+                }
+
+                // Init success
+                (*p_bank_inst)->is_init = true;
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get initialization status of CR filter bank
+*
+* @param[in]    bank_inst   - CR filter bank instance
+* @param[out]   p_is_init   - CR filter bank init state
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_cr_bank_is_init(p_filter_cr_bank_t bank_inst, bool * const p_is_init)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != bank_inst )
+        &&  ( NULL != p_is_init ))
+    {
+        *p_is_init = bank_inst->is_init;
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Handle CR filter bank
+*
+* @note This function must be called in equidistant time period defined by 1/fs!
+*
+* @note Each channel is updated exactly as by "filter_cr_hndl()".
+*
+* @param[in]    bank_inst   - CR filter bank instance
+* @param[in]    p_in        - Input values, one per channel
+* @param[out]   p_out       - Output (filtered) values, one per channel
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_cr_bank_hndl(p_filter_cr_bank_t bank_inst, const float32_t * const p_in, float32_t * const p_out)
+{
+    filter_status_t status  = eFILTER_OK;
+    uint32_t        ch      = 0U;
+
+    // Check for instance and success init
+    if  (   ( NULL != bank_inst )
+        &&  ( NULL != p_in )
+        &&  ( NULL != p_out ))
+    {
+        // Is instance init?
+        if ( true == bank_inst->is_init )
+        {
+            const uint32_t num_of_ch = bank_inst->num_of_ch;
+
+            // Take parameters set by concurrent setter
+            filter_cr_bank_param_apply( bank_inst );
+
+            #if defined( __AVX512F__ )
+                for ( ; ( ch + 16U ) <= num_of_ch; ch += 16U )
+                {
+                    const __m512 v_alpha = _mm512_loadu_ps( &bank_inst->p_alpha[ch] );
+                    __m512       v_x     = _mm512_loadu_ps( &p_in[ch] );
+
+                    for ( uint32_t n = 0U; n < bank_inst->order; n++ )
+                    {
+                        float32_t * const p_y   = &bank_inst->p_y[( n * num_of_ch ) + ch];
+                        float32_t * const p_x   = &bank_inst->p_x[( n * num_of_ch ) + ch];
+                        const __m512      v_y   = _mm512_loadu_ps( p_y );
+                        const __m512      v_x_1 = _mm512_loadu_ps( p_x );
+
+                        _mm512_storeu_ps( p_x, v_x );
+                        v_x = _mm512_add_ps( _mm512_mul_ps( v_alpha, v_y ), _mm512_mul_ps( v_alpha, _mm512_sub_ps( v_x, v_x_1 )));
+                        _mm512_storeu_ps( p_y, v_x );
+                    }
+
+                    _mm512_storeu_ps( &p_out[ch], v_x );
+                }
+            #elif defined( __AVX2__ )
+                for ( ; ( ch + 8U ) <= num_of_ch; ch += 8U )
+                {
+                    const __m256 v_alpha = _mm256_loadu_ps( &bank_inst->p_alpha[ch] );
+                    __m256       v_x     = _mm256_loadu_ps( &p_in[ch] );
+
+                    for ( uint32_t n = 0U; n < bank_inst->order; n++ )
+                    {
+                        float32_t * const p_y   = &bank_inst->p_y[( n * num_of_ch ) + ch];
+                        float32_t * const p_x   = &bank_inst->p_x[( n * num_of_ch ) + ch];
+                        const __m256      v_y   = _mm256_loadu_ps( p_y );
+                        const __m256      v_x_1 = _mm256_loadu_ps( p_x );
+
+                        _mm256_storeu_ps( p_x, v_x );
+                        v_x = _mm256_add_ps( _mm256_mul_ps( v_alpha, v_y ), _mm256_mul_ps( v_alpha, _mm256_sub_ps( v_x, v_x_1 )));
+                        _mm256_storeu_ps( p_y, v_x );
+                    }
+
+                    _mm256_storeu_ps( &p_out[ch], v_x );
+                }
+            #endif
+
+            // Remaining channels
+            for ( ; ch < num_of_ch; ch++ )
+            {
+                const float32_t alpha   = bank_inst->p_alpha[ch];
+                float32_t       x       = p_in[ch];
+
+                for ( uint32_t n = 0U; n < bank_inst->order; n++ )
+                {
+                    float32_t * const p_y = &bank_inst->p_y[( n * num_of_ch ) + ch];
+                    float32_t * const p_x = &bank_inst->p_x[( n * num_of_ch ) + ch];
+                    const float32_t   x_1 = *p_x;
+
+                    *p_x = x;
+                    x = (( alpha * *p_y ) + ( alpha * ( x - x_1 )));
+                    *p_y = x;
+                }
+
+                p_out[ch] = x;
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Reset CR filter bank buffers
+*
+* @param[in]    bank_inst   - CR filter bank instance
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_cr_bank_reset(p_filter_cr_bank_t bank_inst)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if ( NULL != bank_inst )
+    {
+        // Is instance init?
+        if ( true == bank_inst->is_init )
+        {
+            for ( uint32_t i = 0U; i < ( bank_inst->order * bank_inst->num_of_ch ); i++ )
+            {
+                bank_inst->p_y[i] = 0.0f;
+                bank_inst->p_x[i] = 0.0f;
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set cutoff frequency of all CR filter bank channels on-the-fly
+*
+* @note     Cutoff frequencies are changed only if all of them are valid!
+*
+* @param[in]    bank_inst   - CR filter bank instance
+* @param[in]    p_fc        - Cutoff frequencies, one per channel
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_cr_bank_fc_set(p_filter_cr_bank_t bank_inst, const float32_t * const p_fc)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != bank_inst )
+        &&  ( NULL != p_fc ))
+    {
+        // Is instance init?
+        if ( true == bank_inst->is_init )
+        {
+            // Calculate new alphas
+            status = filter_cr_calculate_alpha_vec( p_fc, bank_inst->fs, bank_inst->p_alpha, bank_inst->num_of_ch );
+
+            // Store data for newly set cutoff
+            if ( eFILTER_OK == status )
+            {
+                memcpy( bank_inst->p_fc, p_fc, ( bank_inst->num_of_ch * sizeof( float32_t )));
+                filter_cr_bank_param_publish( bank_inst );
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set cutoff frequency of single CR filter bank channel on-the-fly
+*
+* @param[in]    bank_inst   - CR filter bank instance
+* @param[in]    ch          - Channel index
+* @param[in]    fc          - Cutoff frequency
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_cr_bank_ch_fc_set(p_filter_cr_bank_t bank_inst, const uint32_t ch, const float32_t fc)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if ( NULL != bank_inst )
+    {
+        // Is instance init?
+        if  (   ( true == bank_inst->is_init )
+            &&  ( ch < bank_inst->num_of_ch ))
+        {
+            // Calculate new alpha
+            status = filter_cr_calculate_alpha_vec( &fc, bank_inst->fs, &bank_inst->p_alpha[ch], 1U );
+
+            // Store data for newly set cutoff
+            if ( eFILTER_OK == status )
+            {
+                bank_inst->p_fc[ch] = fc;
+                filter_cr_bank_param_publish( bank_inst );
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get CR filter bank cutoff frequencies
+*
+* @param[in]    bank_inst   - CR filter bank instance
+* @param[out]   p_fc        - Filter cutoff frequencies in Hz, one per channel
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_cr_bank_fc_get(p_filter_cr_bank_t bank_inst, float32_t * const p_fc)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != bank_inst )
+        &&  ( NULL != p_fc ))
+    {
+        // Is instance init?
+        if ( true == bank_inst->is_init )
+        {
+            memcpy( p_fc, bank_inst->p_fc, ( bank_inst->num_of_ch * sizeof( float32_t )));
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+#if ( 1 == FILTER_CFG_ATOMIC_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set cutoff frequency of all CR filter bank channels from concurrent
+*       (control) thread
+*
+* @brief    New parameters are published with sequence lock and taken by
+*           sample path at start of next "filter_cr_bank_hndl()" call.
+*           Sample path never waits.
+*
+* @note     Cutoff frequencies are changed only if all of them are valid!
+*
+* @note     "filter_cr_bank_fc_set()" and "filter_cr_bank_ch_fc_set()" can
+*           be used along, but must be called from sample path thread only!
+*           Update from this function pending at their call takes precedence.
+*
+* @param[in]    bank_inst   - CR filter bank instance
+* @param[in]    p_fc        - Cutoff frequencies, one per channel
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_cr_bank_fc_set_atomic(p_filter_cr_bank_t bank_inst, const float32_t * const p_fc)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != bank_inst )
+        &&  ( NULL != p_fc ))
+    {
+        // Is instance init?
+        if  (   ( true == bank_inst->is_init )
+            &&  ( true == filter_bank_fc_is_valid( p_fc, bank_inst->fs, bank_inst->num_of_ch )))
+        {
+            filter_seqlock_write_begin( &bank_inst->lock );
+
+            (void) filter_cr_calculate_alpha_vec( p_fc, bank_inst->fs, bank_inst->p_par_new, bank_inst->num_of_ch );
+            memcpy( &bank_inst->p_par_new[ bank_inst->num_of_ch ], p_fc, ( bank_inst->num_of_ch * sizeof( float32_t )));
+
+            filter_seqlock_write_end( &bank_inst->lock );
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set cutoff frequency of single CR filter bank channel from
+*       concurrent (control) thread
+*
+* @note     See "filter_cr_bank_fc_set_atomic()".
+*
+* @param[in]    bank_inst   - CR filter bank instance
+* @param[in]    ch          - Channel index
+* @param[in]    fc          - Cutoff frequency
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_cr_bank_ch_fc_set_atomic(p_filter_cr_bank_t bank_inst, const uint32_t ch, const float32_t fc)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if ( NULL != bank_inst )
+    {
+        // Is instance init?
+        if  (   ( true == bank_inst->is_init )
+            &&  ( ch < bank_inst->num_of_ch )
+            &&  ( true == filter_bank_fc_is_valid( &fc, bank_inst->fs, 1U )))
+        {
+            filter_seqlock_write_begin( &bank_inst->lock );
+
+            (void) filter_cr_calculate_alpha_vec( &fc, bank_inst->fs, &bank_inst->p_par_new[ch], 1U );
+            bank_inst->p_par_new[ bank_inst->num_of_ch + ch ] = fc;
+
+            filter_seqlock_write_end( &bank_inst->lock );
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get CR filter bank cutoff frequencies from concurrent (control) thread
+*
+* @note     Returns cutoffs last set by "_atomic" setters, even if sample
+*           path did not apply them yet, or by sample path setters.
+*
+* @param[in]    bank_inst   - CR filter bank instance
+* @param[out]   p_fc        - Filter cutoff frequencies in Hz, one per channel
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_cr_bank_fc_get_atomic(p_filter_cr_bank_t bank_inst, float32_t * const p_fc)
+{
+    filter_status_t status  = eFILTER_OK;
+    uint32_t        seq     = 0U;
+    bool            valid   = false;
+
+    if  (   ( NULL != bank_inst )
+        &&  ( NULL != p_fc ))
+    {
+        // Is instance init?
+        if ( true == bank_inst->is_init )
+        {
+            // Retry until consistent snapshot is taken
+            do
+            {
+                valid = filter_seqlock_read_begin( &bank_inst->lock, &seq );
+                memcpy( p_fc, &bank_inst->p_par_new[ bank_inst->num_of_ch ], ( bank_inst->num_of_ch * sizeof( float32_t )));
+
+            } while (( false == valid ) || ( false == filter_seqlock_read_end( &bank_inst->lock, seq )));
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get CR filter bank sampling frequency
+*
+* @param[in]    bank_inst   - CR filter bank instance
+* @param[out]   p_fs        - Filter sampling frequency in Hz
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_cr_bank_fs_get(p_filter_cr_bank_t bank_inst, float32_t * const p_fs)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != bank_inst )
+        &&  ( NULL != p_fs ))
+    {
+        // Is instance init?
+        if ( true == bank_inst->is_init )
+        {
+            *p_fs = bank_inst->fs;
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*   Initialize band (CR + RC) filter
+*
+* @brief    Band filter is CR (high-pass) filter directly followed by
+*           RC (low-pass) filter, processed in single pass. Typical use is
+*           DC removal followed by smoothing. Result is identical to
+*           calling "filter_cr_hndl()" followed by "filter_rc_hndl()"
+*           with CR and RC filters initialized with same parameters.
+*
+* @note     Order of each part is represented as number of cascaded CR/RC
+*           analog equivalent circuits!
+*
+* @note     Fs and orders cannot be change later!
+*
+* @param[in]    p_filter_inst   - Pointer to band filter instance
+* @param[in]    fc_cr           - CR (high-pass) cutoff frequency
+* @param[in]    fc_rc           - RC (low-pass) cutoff frequency
+* @param[in]    fs              - Sample frequency
+* @param[in]    order_cr        - Number of cascaded CR filters
+* @param[in]    order_rc        - Number of cascaded RC filters
+* @return       status          - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_band_init(p_filter_band_t * p_filter_inst, const float32_t fc_cr, const float32_t fc_rc, const float32_t fs, const uint8_t order_cr, const uint8_t order_rc)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != p_filter_inst )
+        &&  ( order_cr > 0UL )
+        &&  ( order_rc > 0UL ))
+    {
+        // Allocate space
+        *p_filter_inst = malloc( sizeof( filter_band_t ));
+
+        if ( NULL != *p_filter_inst )
+        {
+            // Single block for all stages
+            (*p_filter_inst)->p_y_cr    = malloc(( 2U * order_cr + order_rc ) * sizeof( float32_t ));
+            (*p_filter_inst)->is_init   = false;
+        }
+
+        // Check if allocation succeed
+        if  (   ( NULL != *p_filter_inst )
+            &&  ( NULL != (*p_filter_inst)->p_y_cr ))
+        {
+            // Calculate coefficients
+            status  = filter_cr_calculate_alpha( fc_cr, fs, &(*p_filter_inst)->alpha_cr );
+            status |= filter_rc_calculate_alpha( fc_rc, fs, &(*p_filter_inst)->alpha_rc );
+
+            if ( eFILTER_OK == status )
+            {
+                (*p_filter_inst)->p_x_cr    = &(*p_filter_inst)->p_y_cr[ order_cr ];
+                (*p_filter_inst)->p_y_rc    = &(*p_filter_inst)->p_y_cr[ 2U * order_cr ];
+
+                // Store configuration
+                (*p_filter_inst)->fc_cr     = fc_cr;
+                (*p_filter_inst)->fc_rc     = fc_rc;
+                (*p_filter_inst)->fs        = fs;
+                (*p_filter_inst)->order_cr  = order_cr;
+                (*p_filter_inst)->order_rc  = order_rc;
+
+                #if ( 1 == FILTER_CFG_ATOMIC_EN )
+                    // Concurrent setter starts from init parameters
+                    (*p_filter_inst)->alpha_cr_new  = (*p_filter_inst)->alpha_cr;
+                    (*p_filter_inst)->alpha_rc_new  = (*p_filter_inst)->alpha_rc;
+                    (*p_filter_inst)->fc_cr_new     = fc_cr;
+                    (*p_filter_inst)->fc_rc_new     = fc_rc;
+                    filter_seqlock_init( &(*p_filter_inst)->lock );
+                #endif
+
+                // Initial value
+                for ( uint32_t i = 0U; i < ( 2U * order_cr + order_rc ); i++ )
+                {
+                    (*p_filter_inst)->p_y_cr[i] = 0.0f;
+                }
+
+                // Init success
+                (*p_filter_inst)->is_init = true;
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get initialization status of band filter
+*
+* @param[in]    filter_inst - Band filter instance
+* @param[out]   p_is_init   - Band filter init state
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_band_is_init(p_filter_band_t filter_inst, bool * const p_is_init)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_is_init ))
+    {
+        *p_is_init = filter_inst->is_init;
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Handle band filter
+*
+* @note This function must be called in equidistant time period defined by 1/fs!
+*
+* @param[in]    filter_inst - Band filter instance
+* @param[in]    in          - Input value
+* @param[out]   p_out       - Output (filtered) value
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_band_hndl(p_filter_band_t filter_inst, const float32_t in, float32_t * const p_out)
+{
+    filter_status_t status = eFILTER_OK;
+
+    // Check for instance and success init
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_out ))
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            // Take parameters set by concurrent setter
+            filter_band_param_apply( filter_inst );
+
+            *p_out = filter_band_step( filter_inst, in );
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Handle band filter for block of samples
+*
+* @note This function must be called with samples taken in equidistant time
+*       period defined by 1/fs!
+*
+* @note CR and RC parts are applied in single pass over the block. For 1st
+*       order CR and RC (most common case) all states are kept in registers
+*       for the whole block.
+*
+* @note Input and output buffer can be the same (in-place processing).
+*
+* @param[in]    filter_inst - Band filter instance
+* @param[in]    p_in        - Input samples
+* @param[out]   p_out       - Output (filtered) samples
+* @param[in]    size        - Number of samples
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_band_hndl_block(p_filter_band_t filter_inst, const float32_t * const p_in, float32_t * const p_out, const uint32_t size)
+{
+    filter_status_t status = eFILTER_OK;
+
+    // Check for instance and success init
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_in )
+        &&  ( NULL != p_out ))
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            // Take parameters set by concurrent setter
+            filter_band_param_apply( filter_inst );
+
+            if  (   ( 1U == filter_inst->order_cr )
+                &&  ( 1U == filter_inst->order_rc ))
+            {
+                const float32_t alpha_cr    = filter_inst->alpha_cr;
+                const float32_t alpha_rc    = filter_inst->alpha_rc;
+                float32_t       y_cr        = filter_inst->p_y_cr[0];
+                float32_t       x_cr        = filter_inst->p_x_cr[0];
+                float32_t       y_rc        = filter_inst->p_y_rc[0];
+
+                for ( uint32_t i = 0U; i < size; i++ )
+                {
+                    const float32_t in = p_in[i];
+
+                    y_cr = (( alpha_cr * y_cr ) + ( alpha_cr * ( in - x_cr )));
+                    x_cr = in;
+                    y_rc = ( y_rc + ( alpha_rc * ( y_cr - y_rc )));
+
+                    p_out[i] = y_rc;
+                }
+
+                filter_inst->p_y_cr[0] = y_cr;
+                filter_inst->p_x_cr[0] = x_cr;
+                filter_inst->p_y_rc[0] = y_rc;
+            }
+            else
+            {
+                for ( uint32_t i = 0U; i < size; i++ )
+                {
+                    p_out[i] = filter_band_step( filter_inst, p_in[i] );
+                }
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Reset band filter buffers
+*
+* @param[in]    filter_inst - Band filter instance
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_band_reset(p_filter_band_t filter_inst)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if ( NULL != filter_inst )
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            for ( uint32_t i = 0U; i < ( 2U * filter_inst->order_cr + filter_inst->order_rc ); i++ )
+            {
+                filter_inst->p_y_cr[i] = 0.0f;
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set cutoff frequencies of band filter on-the-fly
+*
+* @note     Cutoff frequencies are changed only if both of them are valid!
+*
+* @param[in]    filter_inst - Band filter instance
+* @param[in]    fc_cr       - CR (high-pass) cutoff frequency
+* @param[in]    fc_rc       - RC (low-pass) cutoff frequency
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_band_fc_set(p_filter_band_t filter_inst, const float32_t fc_cr, const float32_t fc_rc)
+{
+    filter_status_t status      = eFILTER_OK;
+    float32_t       alpha_cr    = 0.0f;
+    float32_t       alpha_rc    = 0.0f;
+
+    if ( NULL != filter_inst )
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            // Calculate new alphas
+            status  = filter_cr_calculate_alpha( fc_cr, filter_inst->fs, &alpha_cr );
+            status |= filter_rc_calculate_alpha( fc_rc, filter_inst->fs, &alpha_rc );
+
+            // Store data for newly set cutoff
+            if ( eFILTER_OK == status )
+            {
+                filter_inst->alpha_cr   = alpha_cr;
+                filter_inst->alpha_rc   = alpha_rc;
+                filter_inst->fc_cr      = fc_cr;
+                filter_inst->fc_rc      = fc_rc;
+                filter_band_param_publish( filter_inst );
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get band filter cutoff frequencies
+*
+* @param[in]    filter_inst - Band filter instance
+* @param[out]   p_fc_cr     - CR (high-pass) cutoff frequency in Hz
+* @param[out]   p_fc_rc     - RC (low-pass) cutoff frequency in Hz
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_band_fc_get(p_filter_band_t filter_inst, float32_t * const p_fc_cr, float32_t * const p_fc_rc)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_fc_cr )
+        &&  ( NULL != p_fc_rc ))
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            *p_fc_cr = filter_inst->fc_cr;
+            *p_fc_rc = filter_inst->fc_rc;
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+#if ( 1 == FILTER_CFG_ATOMIC_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set cutoff frequencies of band filter from concurrent (control) thread
+*
+* @brief    New parameters are published with sequence lock and taken by
+*           sample path at start of next "filter_band_hndl()" or
+*           "filter_band_hndl_block()" call. Sample path never waits.
+*
+* @note     Cutoff frequencies are changed only if both of them are valid!
+*
+* @note     "filter_band_fc_set()" can be used along, but must be called from
+*           sample path thread only! Update from this function pending at
+*           its call takes precedence.
+*
+* @param[in]    filter_inst - Band filter instance
+* @param[in]    fc_cr       - CR (high-pass) cutoff frequency
+* @param[in]    fc_rc       - RC (low-pass) cutoff frequency
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_band_fc_set_atomic(p_filter_band_t filter_inst, const float32_t fc_cr, const float32_t fc_rc)
+{
+    filter_status_t status      = eFILTER_OK;
+    float32_t       alpha_cr    = 0.0f;
+    float32_t       alpha_rc    = 0.0f;
+
+    if ( NULL != filter_inst )
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            // Calculate new alphas
+            status  = filter_cr_calculate_alpha( fc_cr, filter_inst->fs, &alpha_cr );
+            status |= filter_rc_calculate_alpha( fc_rc, filter_inst->fs, &alpha_rc );
+
+            // Publish data for newly set cutoff
+            if ( eFILTER_OK == status )
+            {
+                filter_seqlock_write_begin( &filter_inst->lock );
+
+                filter_inst->alpha_cr_new   = alpha_cr;
+                filter_inst->alpha_rc_new   = alpha_rc;
+                filter_inst->fc_cr_new      = fc_cr;
+                filter_inst->fc_rc_new      = fc_rc;
+
+                filter_seqlock_write_end( &filter_inst->lock );
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get band filter cutoff frequencies from concurrent (control) thread
+*
+* @note     Returns cutoffs last set by "filter_band_fc_set_atomic()", even
+*           if sample path did not apply them yet, or by "filter_band_fc_set()".
+*
+* @param[in]    filter_inst - Band filter instance
+* @param[out]   p_fc_cr     - CR (high-pass) cutoff frequency in Hz
+* @param[out]   p_fc_rc     - RC (low-pass) cutoff frequency in Hz
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_band_fc_get_atomic(p_filter_band_t filter_inst, float32_t * const p_fc_cr, float32_t * const p_fc_rc)
+{
+    filter_status_t status  = eFILTER_OK;
+    uint32_t        seq     = 0U;
+    bool            valid   = false;
+
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_fc_cr )
+        &&  ( NULL != p_fc_rc ))
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            // Retry until consistent snapshot is taken
+            do
+            {
+                valid       = filter_seqlock_read_begin( &filter_inst->lock, &seq );
+                *p_fc_cr    = filter_inst->fc_cr_new;
+                *p_fc_rc    = filter_inst->fc_rc_new;
+
+            } while (( false == valid ) || ( false == filter_seqlock_read_end( &filter_inst->lock, seq )));
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get band filter sampling frequency
+*
+* @param[in]    filter_inst - Band filter instance
+* @param[out]   p_fs        - Filter sampling frequency in Hz
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_band_fs_get(p_filter_band_t filter_inst, float32_t * const p_fs)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_fs ))
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            *p_fs = filter_inst->fs;
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*   Initialize integer DC blocker
+*
+* @brief    DC blocker is 1st order CR filter working directly on int16
+*           samples (e.g. raw ADC) in Q15 fixed point:
+*
+*               y[n] = x[n] - x[n-1] + R*y[n-1]
+*
+*           Pole R is calculated from fc and fs same as CR filter alpha,
+*           therefore parameters have same meaning as at "filter_cr_init()".
+*
+* @param[in]    p_filter_inst   - Pointer to DC blocker instance
+* @param[in]    fc              - Cutoff frequency
+* @param[in]    fs              - Sample frequency
+* @return       status          - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_dcb_init(p_filter_dcb_t * p_filter_inst, const float32_t fc, const float32_t fs)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if ( NULL != p_filter_inst )
+    {
+        // Allocate space
+        *p_filter_inst = malloc( sizeof( filter_dcb_t ));
+
+        // Check if allocation succeed
+        if ( NULL != *p_filter_inst )
+        {
+            (*p_filter_inst)->is_init = false;
+
+            // Calculate pole
+            status = filter_dcb_calc_pole( fc, fs, &(*p_filter_inst)->r );
+
+            if ( eFILTER_OK == status )
+            {
+                (*p_filter_inst)->x1    = 0;
+                (*p_filter_inst)->y1    = 0;
+                (*p_filter_inst)->e     = 0;
+                (*p_filter_inst)->fc    = fc;
+                (*p_filter_inst)->fs    = fs;
+
+                // Init success
+                (*p_filter_inst)->is_init = true;
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get initialization status of integer DC blocker
+*
+* @param[in]    filter_inst - DC blocker instance
+* @param[out]   p_is_init   - DC blocker init state
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_dcb_is_init(p_filter_dcb_t filter_inst, bool * const p_is_init)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_is_init ))
+    {
+        *p_is_init = filter_inst->is_init;
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Handle integer DC blocker
+*
+* @note This function must be called in equidistant time period defined by 1/fs!
+*
+* @param[in]    filter_inst - DC blocker instance
+* @param[in]    in          - Input sample
+* @param[out]   p_out       - Output sample
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_dcb_hndl(p_filter_dcb_t filter_inst, const int16_t in, int16_t * const p_out)
+{
+    filter_status_t status = eFILTER_OK;
+
+    // Check for instance and success init
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_out ))
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            *p_out = filter_dcb_step( &filter_inst->x1, &filter_inst->y1, &filter_inst->e, filter_inst->r, in );
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Handle integer DC blocker for block of samples
+*
+* @note This function must be called with samples taken in equidistant time
+*       period defined by 1/fs!
+*
+* @note Input and output buffer can be the same (in-place processing).
+*
+* @param[in]    filter_inst - DC blocker instance
+* @param[in]    p_in        - Input samples
+* @param[out]   p_out       - Output samples
+* @param[in]    size        - Number of samples
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_dcb_hndl_block(p_filter_dcb_t filter_inst, const int16_t * const p_in, int16_t * const p_out, const uint32_t size)
+{
+    filter_status_t status = eFILTER_OK;
+
+    // Check for instance and success init
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_in )
+        &&  ( NULL != p_out ))
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            const int32_t   r   = filter_inst->r;
+            int32_t         x1  = filter_inst->x1;
+            int32_t         y1  = filter_inst->y1;
+            int32_t         e   = filter_inst->e;
+
+            for ( uint32_t i = 0U; i < size; i++ )
+            {
+                p_out[i] = filter_dcb_step( &x1, &y1, &e, r, p_in[i] );
+            }
+
+            filter_inst->x1 = x1;
+            filter_inst->y1 = y1;
+            filter_inst->e  = e;
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Reset integer DC blocker
+*
+* @param[in]    filter_inst - DC blocker instance
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_dcb_reset(p_filter_dcb_t filter_inst)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if ( NULL != filter_inst )
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            filter_inst->x1 = 0;
+            filter_inst->y1 = 0;
+            filter_inst->e  = 0;
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*   Initialize integer DC blocker bank
+*
+* @brief    Bank of "num_of_ch" integer DC blockers with same cutoff
+*           frequency. Channels are processed with AVX2/AVX-512 when
+*           available.
+*
+* @param[in]    p_bank_inst - Pointer to DC blocker bank instance
+* @param[in]    num_of_ch   - Number of channels
+* @param[in]    fc          - Cutoff frequency
+* @param[in]    fs          - Sample frequency
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_dcb_bank_init(p_filter_dcb_bank_t * p_bank_inst, const uint32_t num_of_ch, const float32_t fc, const float32_t fs)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != p_bank_inst )
+        &&  ( num_of_ch > 0UL ))
+    {
+        // Allocate space
+        *p_bank_inst = malloc( sizeof( filter_dcb_bank_t ));
+
+        if ( NULL != *p_bank_inst )
+        {
+            (*p_bank_inst)->p_x1    = malloc( num_of_ch * sizeof( int32_t ));
+            (*p_bank_inst)->p_y1    = malloc( num_of_ch * sizeof( int32_t ));
+            (*p_bank_inst)->p_e     = malloc( num_of_ch * sizeof( int32_t ));
+            (*p_bank_inst)->is_init = false;
+        }
+
+        // Check if allocation succeed
+        if  (   ( NULL != *p_bank_inst )
+            &&  ( NULL != (*p_bank_inst)->p_x1 )
+            &&  ( NULL != (*p_bank_inst)->p_y1 )
+            &&  ( NULL != (*p_bank_inst)->p_e ))
+        {
+            // Calculate pole
+            status = filter_dcb_calc_pole( fc, fs, &(*p_bank_inst)->r );
+
+            if ( eFILTER_OK == status )
+            {
+                // Store configuration
+                (*p_bank_inst)->num_of_ch   = num_of_ch;
+                (*p_bank_inst)->fc          = fc;
+                (*p_bank_inst)->fs          = fs;
+
+                // Initial value
+                for ( uint32_t ch = 0U; ch < num_of_ch; ch++ )
+                {
+                    (*p_bank_inst)->p_x1[ch]    = 0;
+                    (*p_bank_inst)->p_y1[ch]    = 0;
+                    (*p_bank_inst)->p_e[ch]     = 0;
+                }
+
+                // Init success
+                (*p_bank_inst)->is_init = true;
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get initialization status of integer DC blocker bank
+*
+* @param[in]    bank_inst   - DC blocker bank instance
+* @param[out]   p_is_init   - DC blocker bank init state
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_dcb_bank_is_init(p_filter_dcb_bank_t bank_inst, bool * const p_is_init)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != bank_inst )
+        &&  ( NULL != p_is_init ))
+    {
+        *p_is_init = bank_inst->is_init;
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Handle integer DC blocker bank
+*
+* @note This function must be called in equidistant time period defined by 1/fs!
+*
+* @param[in]    bank_inst   - DC blocker bank instance
+* @param[in]    p_in        - Input samples, one per channel
+* @param[out]   p_out       - Output samples, one per channel
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_dcb_bank_hndl(p_filter_dcb_bank_t bank_inst, const int16_t * const p_in, int16_t * const p_out)
+{
+    filter_status_t status = eFILTER_OK;
+
+    // Check for instance and success init
+    if  (   ( NULL != bank_inst )
+        &&  ( NULL != p_in )
+        &&  ( NULL != p_out ))
+    {
+        // Is instance init?
+        if ( true == bank_inst->is_init )
+        {
+            filter_dcb_bank_frame( bank_inst, p_in, p_out );
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Handle integer DC blocker bank for block of frames
+*
+* @note Samples are interleaved by channel (as delivered by multichannel
+*       ADC DMA): p_in[ frame * num_of_ch + ch ].
+*
+* @note Input and output buffer can be the same (in-place processing).
+*
+* @param[in]    bank_inst       - DC blocker bank instance
+* @param[in]    p_in            - Input samples, interleaved
+* @param[out]   p_out           - Output samples, interleaved
+* @param[in]    num_of_frames   - Number of frames
+* @return       status          - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_dcb_bank_hndl_block(p_filter_dcb_bank_t bank_inst, const int16_t * const p_in, int16_t * const p_out, const uint32_t num_of_frames)
+{
+    filter_status_t status = eFILTER_OK;
+
+    // Check for instance and success init
+    if  (   ( NULL != bank_inst )
+        &&  ( NULL != p_in )
+        &&  ( NULL != p_out ))
+    {
+        // Is instance init?
+        if ( true == bank_inst->is_init )
+        {
+            for ( uint32_t i = 0U; i < num_of_frames; i++ )
+            {
+                filter_dcb_bank_frame( bank_inst, &p_in[ i * bank_inst->num_of_ch ], &p_out[ i * bank_inst->num_of_ch ] );
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Reset integer DC blocker bank
+*
+* @param[in]    bank_inst   - DC blocker bank instance
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_dcb_bank_reset(p_filter_dcb_bank_t bank_inst)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if ( NULL != bank_inst )
+    {
+        // Is instance init?
+        if ( true == bank_inst->is_init )
+        {
+            for ( uint32_t ch = 0U; ch < bank_inst->num_of_ch; ch++ )
+            {
+                bank_inst->p_x1[ch] = 0;
+                bank_inst->p_y1[ch] = 0;
+                bank_inst->p_e[ch]  = 0;
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*   Initialize one-euro (adaptive cutoff RC) filter
+*
+* @brief    One-euro filter is 1st order RC filter with cutoff frequency
+*           adapted to speed of input signal:
+*
+*               fc = fc_min + beta * |dx/dt|
+*
+*           Slow changing signal is heavily smoothed (jitter reduction),
+*           while fast changes are followed with low lag. Derivative of
+*           input is smoothed by RC filter with fixed cutoff fc_d.
+*
+* @note     Reference: G. Casiez, N. Roussel, D. Vogel, "1 Euro Filter: A Simple
+*           Speed-based Low-pass Filter for Noisy Input in Interactive Systems"
+*
+* @param[in]    p_filter_inst   - Pointer to one-euro filter instance
+* @param[in]    fc_min          - Minimum cutoff frequency
+* @param[in]    beta            - Cutoff frequency increase per unit of derivative
+* @param[in]    fc_d            - Derivative filter cutoff frequency
+* @param[in]    fs              - Sample frequency
+* @param[in]    init_value      - Initial value
+* @return       status          - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_euro_init(p_filter_euro_t * p_filter_inst, const float32_t fc_min, const float32_t beta, const float32_t fc_d, const float32_t fs, const float32_t init_value)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if ( NULL != p_filter_inst )
+    {
+        // Allocate space
+        *p_filter_inst = malloc( sizeof( filter_euro_t ));
+
+        // Check if allocation succeed
+        if ( NULL != *p_filter_inst )
+        {
+            (*p_filter_inst)->is_init = false;
+
+            // Calculate parameters
+            status = filter_euro_par_calc( *p_filter_inst, fc_min, beta, fc_d, fs );
+
+            if ( eFILTER_OK == status )
+            {
+                // Initial value
+                (*p_filter_inst)->y     = init_value;
+                (*p_filter_inst)->dy    = 0.0f;
+
+                // Init success
+                (*p_filter_inst)->is_init = true;
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get initialization status of one-euro filter
+*
+* @param[in]    filter_inst - One-euro filter instance
+* @param[out]   p_is_init   - One-euro filter init state
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_euro_is_init(p_filter_euro_t filter_inst, bool * const p_is_init)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_is_init ))
+    {
+        *p_is_init = filter_inst->is_init;
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Handle one-euro filter
+*
+* @note This function must be called in equidistant time period defined by 1/fs!
+*
+* @param[in]    filter_inst - One-euro filter instance
+* @param[in]    in          - Input value
+* @param[out]   p_out       - Output (filtered) value
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_euro_hndl(p_filter_euro_t filter_inst, const float32_t in, float32_t * const p_out)
+{
+    filter_status_t status = eFILTER_OK;
+
+    // Check for instance and success init
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_out ))
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            *p_out = filter_euro_step( &filter_inst->y, &filter_inst->dy, in, filter_inst );
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Reset one-euro filter
+*
+* @param[in]    filter_inst - One-euro filter instance
+* @param[in]    rst_value   - Reset value
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_euro_reset(p_filter_euro_t filter_inst, const float32_t rst_value)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if ( NULL != filter_inst )
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            filter_inst->y  = rst_value;
+            filter_inst->dy = 0.0f;
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*   Initialize one-euro (adaptive cutoff RC) filter bank
+*
+* @brief    Filter bank holds multiple independent one-euro filters (channels)
+*           with common parameters. Channel states are stored in contiguous
+*           arrays and all channels are updated with single call. See
+*           "filter_euro_init()" for filter description.
+*
+* @param[in]    p_bank_inst - Pointer to one-euro filter bank instance
+* @param[in]    num_of_ch   - Number of channels
+* @param[in]    fc_min      - Minimum cutoff frequency
+* @param[in]    beta        - Cutoff frequency increase per unit of derivative
+* @param[in]    fc_d        - Derivative filter cutoff frequency
+* @param[in]    fs          - Sample frequency
+* @param[in]    init_value  - Initial value
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_euro_bank_init(p_filter_euro_bank_t * p_bank_inst, const uint32_t num_of_ch, const float32_t fc_min, const float32_t beta, const float32_t fc_d, const float32_t fs, const float32_t init_value)
+{
+    filter_status_t status  = eFILTER_OK;
+    filter_euro_t   par     = { 0 };
+
+    if  (   ( NULL != p_bank_inst )
+        &&  ( num_of_ch > 0UL ))
+    {
+        // Allocate space
+        *p_bank_inst = malloc( sizeof( filter_euro_bank_t ));
+
+        if ( NULL != *p_bank_inst )
+        {
+            (*p_bank_inst)->p_y     = malloc( num_of_ch * sizeof( float32_t ));
+            (*p_bank_inst)->p_dy    = malloc( num_of_ch * sizeof( float32_t ));
+            (*p_bank_inst)->is_init = false;
+        }
+
+        // Check if allocation succeed
+        if  (   ( NULL != *p_bank_inst )
+            &&  ( NULL != (*p_bank_inst)->p_y )
+            &&  ( NULL != (*p_bank_inst)->p_dy ))
+        {
+            // Calculate parameters
+            status = filter_euro_par_calc( &par, fc_min, beta, fc_d, fs );
+
+            if ( eFILTER_OK == status )
+            {
+                (*p_bank_inst)->alpha_d     = par.alpha_d;
+                (*p_bank_inst)->fc_min      = par.fc_min;
+                (*p_bank_inst)->beta        = par.beta;
+                (*p_bank_inst)->fs          = par.fs;
+                (*p_bank_inst)->w_scale     = par.w_scale;
+                (*p_bank_inst)->num_of_ch   = num_of_ch;
+
+                // Initial value
+                for ( uint32_t ch = 0U; ch < num_of_ch; ch++ )
+                {
+                    (*p_bank_inst)->p_y[ch]     = init_value;
+                    (*p_bank_inst)->p_dy[ch]    = 0.0f;
+                }
+
+                // Init success
+                (*p_bank_inst)->is_init = true;
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get initialization status of one-euro filter bank
+*
+* @param[in]    bank_inst   - One-euro filter bank instance
+* @param[out]   p_is_init   - One-euro filter bank init state
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_euro_bank_is_init(p_filter_euro_bank_t bank_inst, bool * const p_is_init)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != bank_inst )
+        &&  ( NULL != p_is_init ))
+    {
+        *p_is_init = bank_inst->is_init;
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Handle one-euro filter bank
+*
+* @note This function must be called in equidistant time period defined by 1/fs!
+*
+* @note Channel loop is free of divisions and branches, so that compiler
+*       can vectorize it across channels.
+*
+* @param[in]    bank_inst   - One-euro filter bank instance
+* @param[in]    p_in        - Input values, one per channel
+* @param[out]   p_out       - Output (filtered) values, one per channel
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_euro_bank_hndl(p_filter_euro_bank_t bank_inst, const float32_t * const p_in, float32_t * const p_out)
+{
+    filter_status_t status = eFILTER_OK;
+
+    // Check for instance and success init
+    if  (   ( NULL != bank_inst )
+        &&  ( NULL != p_in )
+        &&  ( NULL != p_out ))
+    {
+        // Is instance init?
+        if ( true == bank_inst->is_init )
+        {
+            const filter_euro_t par =
+            {
+                .alpha_d    = bank_inst->alpha_d,
+                .fc_min     = bank_inst->fc_min,
+                .beta       = bank_inst->beta,
+                .fs         = bank_inst->fs,
+                .w_scale    = bank_inst->w_scale,
+            };
+
+            float32_t * const p_y   = bank_inst->p_y;
+            float32_t * const p_dy  = bank_inst->p_dy;
+
+            for ( uint32_t ch = 0U; ch < bank_inst->num_of_ch; ch++ )
+            {
+                p_out[ch] = filter_euro_step( &p_y[ch], &p_dy[ch], p_in[ch], &par );
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Reset one-euro filter bank
+*
+* @param[in]    bank_inst   - One-euro filter bank instance
+* @param[in]    rst_value   - Reset value
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_euro_bank_reset(p_filter_euro_bank_t bank_inst, const float32_t rst_value)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if ( NULL != bank_inst )
+    {
+        // Is instance init?
+        if ( true == bank_inst->is_init )
+        {
+            for ( uint32_t ch = 0U; ch < bank_inst->num_of_ch; ch++ )
+            {
+                bank_inst->p_y[ch]  = rst_value;
+                bank_inst->p_dy[ch] = 0.0f;
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*   Initialize boolean/debounce filter
+*
+* @brief    Boolean filter is basically LPF (RC filter) + comparator
+*           at the end of signal path.
+*
+*           Input to filter in bool and output of filer is bool. Signal
+*           in between is being converted to float either 0.0f or 1.0f. That
+*           signal then goes to LPF. Output of LPF goes to schmitt trigger
+*           comparator with configurable trip levels at init phase
+*
+*           Input "comp_lvl" setup comparator trip level symmetrical to 0.5
+*           value. E.g.: comp_lvl = 0.1 will result in levels:
+*
+*               OFF -> ON:  level = 0.9
+*               ON  -> OFF: level = 0.1
+*
+* @param[in]    filter_inst - Pointer to bool filter instance
+* @param[in]    fc          - Cuttoff frequency of LPF
+* @param[in]    fs          - Sample time of filter
+* @param[in]    comp_lvl    - Comparator trip level
+* @return       status      - Status of initialization
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_bool_init(p_filter_bool_t * p_filter_inst, const float32_t fc, const float32_t fs, const float32_t comp_lvl)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if ( NULL != p_filter_inst )
+    {
+        // Allocate space
+        *p_filter_inst = malloc( sizeof( filter_bool_t ));
+
+        // Check if allocation succeed & valid configs
+        if  (   ( NULL != p_filter_inst )
+            &&  (( comp_lvl > 0.0f ) && ( comp_lvl < 0.4f )))
+        {
+            // Init LPF
+            status = filter_rc_init( &(*p_filter_inst)->lpf, fc, fs, 1U, 0.0f );
+
+            if ( eFILTER_OK == status )
+            {
+                (*p_filter_inst)->comp_lvl  = comp_lvl;
+                (*p_filter_inst)->y = false;
+
+                // Init succeed
+                (*p_filter_inst)->is_init = true;
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get initialization status of boolean filter
+*
+* @param[in]    filter_inst - Boolean filter instance
+* @param[out]   p_is_init   - Boolean filter init state
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_bool_is_init(p_filter_bool_t filter_inst, bool * const p_is_init)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_is_init ))
+    {
+        *p_is_init = filter_inst->is_init;
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Handle boolean filter
+*
+* @note This function must be called in equidistant time period defined by 1/fs!
+*
+* @param[in]    filter_inst - Boolean filter instance
+* @param[in]    in          - Input value
+* @param[out]   p_out       - Output (filtered) value
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_bool_hndl(p_filter_bool_t filter_inst, const bool in, bool * const p_out)
+{
+    filter_status_t status      = eFILTER_OK;
+    float32_t       filt_in     = 0.0f;
+    float32_t       filt_out    = 0.0f;
+
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_out ))
+    {
+        // Convert input to floating
+        filt_in = (float32_t) in;
+
+        // Apply filter
+        (void) filter_rc_hndl( filter_inst->lpf, filt_in, &filt_out );
+
+        // Apply comparator
+        if  (   ( false == filter_inst->y )
+            &&  ( filt_out >= ( 1.0f - filter_inst->comp_lvl )))
+        {
+            filter_inst->y  = true;
+        }
+        else if (   ( true == filter_inst->y )
+                &&  ( filt_out <= filter_inst->comp_lvl ))
+        {
+            filter_inst->y  = false;
+        }
+        else
+        {
+            // No actions...
+        }
+
+        // Return output
+        *p_out = filter_inst->y;
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Handle boolean filter for packed bitstream
+*
+* @brief    Input and output samples are packed 64 per word, first sample
+*           in LSB. Result is same as calling "filter_bool_hndl()" for each
+*           bit in order.
+*
+* @note     Word without transitions against current output (all bits
+*           equal to output) cannot change output, therefore RC state is
+*           advanced in closed form: y = x + ( y - x ) * ( 1 - alpha )^64.
+*           Closed form differs from 64 single steps only by float rounding.
+*
+* @note This function must be called with samples taken in equidistant time
+*       period defined by 1/fs!
+*
+* @param[in]    filter_inst     - Boolean filter instance
+* @param[in]    p_in            - Input words, 64 samples per word
+* @param[out]   p_out           - Output (filtered) words, 64 samples per word
+* @param[in]    num_of_words    - Number of words
+* @return       status          - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_bool_hndl_packed(p_filter_bool_t filter_inst, const uint64_t * const p_in, uint64_t * const p_out, const uint32_t num_of_words)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_in )
+        &&  ( NULL != p_out ))
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            // Apply concurrently set LPF parameters before alpha is taken
+            filter_rc_param_apply( filter_inst->lpf );
+
+            const float32_t alpha       = filter_inst->lpf->alpha;
+            const float32_t lvl_on      = ( 1.0f - filter_inst->comp_lvl );
+            const float32_t lvl_off     = filter_inst->comp_lvl;
+            float32_t       decay_64    = ( 1.0f - alpha );
+            float32_t       y           = filter_inst->lpf->p_y[0];
+            bool            out         = filter_inst->y;
+
+            // ( 1 - alpha )^64
+            for ( uint32_t i = 0U; i < 6U; i++ )
+            {
+                decay_64 *= decay_64;
+            }
+
+            for ( uint32_t w = 0U; w < num_of_words; w++ )
+            {
+                const uint64_t in       = p_in[w];
+                const uint64_t stable   = (( true == out ) ? UINT64_MAX : 0U );
+
+                // No transitions against output
+                if ( in == stable )
+                {
+                    const float32_t x = (( true == out ) ? 1.0f : 0.0f );
+
+                    y = ( x + (( y - x ) * decay_64 ));
+                    p_out[w] = stable;
+                }
+                else
+                {
+                    uint64_t y_w = 0U;
+
+                    for ( uint32_t b = 0U; b < 64U; b++ )
+                    {
+                        const float32_t x = (float32_t) (( in >> b ) & 1U );
+
+                        // Apply filter
+                        y = ( y + ( alpha * ( x - y )));
+
+                        // Apply comparator
+                        if  (   ( false == out )
+                            &&  ( y >= lvl_on ))
+                        {
+                            out = true;
+                        }
+                        else if (   ( true == out )
+                                &&  ( y <= lvl_off ))
+                        {
+                            out = false;
+                        }
+                        else
+                        {
+                            // No actions...
+                        }
+
+                        y_w |= ((uint64_t) out << b );
+                    }
+
+                    p_out[w] = y_w;
+                }
+            }
+
+            filter_inst->lpf->p_y[0]    = y;
+            filter_inst->y              = out;
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Handle boolean filter for packed bitstream with edge output
+*
+* @brief    Same as "filter_bool_hndl_packed()" but instead of output
+*           samples list of output transitions is returned. Edge index
+*           is bit position within block ( word * 64 + bit ).
+*
+* @note     All edges are counted in "p_num_of_edges", but only first
+*           "max_edges" are stored. Caller detects overflow as
+*           *p_num_of_edges > max_edges.
+*
+* @param[in]    filter_inst     - Boolean filter instance
+* @param[in]    p_in            - Input words, 64 samples per word
+* @param[in]    num_of_words    - Number of words
+* @param[out]   p_edge          - Edge list
+* @param[in]    max_edges       - Size of edge list
+* @param[out]   p_num_of_edges  - Number of edges in block
+* @return       status          - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_bool_hndl_edges(p_filter_bool_t filter_inst, const uint64_t * const p_in, const uint32_t num_of_words, filter_bool_edge_t * const p_edge, const uint32_t max_edges, uint32_t * const p_num_of_edges)
+{
+    filter_status_t status                      = eFILTER_OK;
+    uint64_t        y[FILTER_BOOL_EDGE_CHUNK]   = { 0U };
+    uint32_t        num_of_edges                = 0U;
+
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_in )
+        &&  ( NULL != p_num_of_edges )
+        &&  (( NULL != p_edge ) || ( 0U == max_edges )))
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            uint64_t y_last = (uint64_t) filter_inst->y;
+
+            for ( uint32_t w = 0U; w < num_of_words; w += FILTER_BOOL_EDGE_CHUNK )
+            {
+                const uint32_t size = ((( num_of_words - w ) < FILTER_BOOL_EDGE_CHUNK ) ? ( num_of_words - w ) : FILTER_BOOL_EDGE_CHUNK );
+
+                (void) filter_bool_hndl_packed( filter_inst, &p_in[w], y, size );
+
+                for ( uint32_t i = 0U; i < size; i++ )
+                {
+                    num_of_edges = filter_bool_edges_add( y[i], (( y[i] << 1U ) | y_last ), (( w + i ) * 64U ), p_edge, max_edges, num_of_edges );
+                    y_last = ( y[i] >> 63U );
+                }
+            }
+
+            *p_num_of_edges = num_of_edges;
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Reset Boolean filter buffers
+*
+* @param[in]    filter_inst - Boolean filter instance
+* @param[in]    rst_value   - Reset value
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_bool_reset(p_filter_bool_t filter_inst)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if ( NULL != filter_inst )
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            // Reset LPF
+            (void) filter_rc_reset( filter_inst->lpf, 0.0f );
+            filter_inst->y = false;
+        }
+        else
+        {
+            status = eFILTER_ERROR;
         }
     }
     else
@@ -970,22 +8469,1849 @@ filter_status_t filter_bool_reset(p_filter_bool_t filter_inst)
 /**
 *       Set cutoff frequency of Boolean filter on-the-fly
 *
-* @param[in]    filter_inst - Boolean filter instance
-* @param[in]    fc          - Cutoff frequency
-* @return       status      - Status of operation
+* @param[in]    filter_inst - Boolean filter instance
+* @param[in]    fc          - Cutoff frequency
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_bool_fc_set(p_filter_bool_t filter_inst, const float32_t fc)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if ( NULL != filter_inst )
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            // Set LPF fc
+            status = filter_rc_fc_set( filter_inst->lpf, fc );
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+#if ( 1 == FILTER_CFG_ATOMIC_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set cutoff frequency of Boolean filter, deferred
+*
+* @note     See "filter_rc_fc_set_deferred()".
+*
+* @param[in]    filter_inst - Boolean filter instance
+* @param[in]    fc          - Cutoff frequency
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_bool_fc_set_deferred(p_filter_bool_t filter_inst, const float32_t fc)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if ( NULL != filter_inst )
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            // Set LPF fc
+            status = filter_rc_fc_set_deferred( filter_inst->lpf, fc );
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get Boolean filter cutoff frequency
+*
+* @param[in]    filter_inst - Boolean filter instance
+* @param[out]   p_fc        - Filter cutoff frequency in Hz
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_bool_fc_get(p_filter_bool_t filter_inst, float32_t * const p_fc)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_fc ))
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            (void) filter_rc_fc_get( filter_inst->lpf, p_fc );
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+#if ( 1 == FILTER_CFG_ATOMIC_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set cutoff frequency of Boolean filter from concurrent (control) thread
+*
+* @note     See "filter_rc_fc_set_atomic()".
+*
+* @param[in]    filter_inst - Boolean filter instance
+* @param[in]    fc          - Cutoff frequency
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_bool_fc_set_atomic(p_filter_bool_t filter_inst, const float32_t fc)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if ( NULL != filter_inst )
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            // Set LPF fc
+            status = filter_rc_fc_set_atomic( filter_inst->lpf, fc );
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get Boolean filter cutoff frequency from concurrent (control) thread
+*
+* @note     See "filter_rc_fc_get_atomic()".
+*
+* @param[in]    filter_inst - Boolean filter instance
+* @param[out]   p_fc        - Filter cutoff frequency in Hz
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_bool_fc_get_atomic(p_filter_bool_t filter_inst, float32_t * const p_fc)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_fc ))
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            (void) filter_rc_fc_get_atomic( filter_inst->lpf, p_fc );
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get Boolean filter sampling frequency
+*
+* @param[in]    filter_inst - RC filter instance
+* @param[out]   p_fs        - Filter sampling frequency in Hz
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_bool_fs_get(p_filter_bool_t filter_inst, float32_t * const p_fs)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_fs ))
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            (void) filter_rc_fs_get( filter_inst->lpf, p_fs );
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*   Initialize integer boolean/debounce filter
+*
+* @brief    Integer only variant of boolean filter. RC filter is replaced
+*           by fixed point leaky integrator with state and coefficient
+*           in Q30 and 64-bit product:
+*
+*               acc += ((( in << 30 ) - acc ) * alpha ) >> 30
+*
+*           Increment is rounded towards input, so integrator settles
+*           exactly on 0 and 1 << 30.
+*
+*           Comparator levels are near comp_lvl and 1 - comp_lvl, placed
+*           so that step response switches on same sample as
+*           "filter_bool_hndl()". Output therefore follows floating
+*           point boolean filter, including noise rejection, up to
+*           quantization of state.
+*
+* @note     Floating point is used only at initialization, handler is
+*           integer only and therefore suitable for interrupt context.
+*
+* @param[in]    p_filter_inst   - Pointer to integer boolean filter instance
+* @param[in]    fc              - Cutoff frequency
+* @param[in]    fs              - Sample frequency
+* @param[in]    comp_lvl        - Comparator level
+* @return       status          - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_bool_cnt_init(p_filter_bool_cnt_t * p_filter_inst, const float32_t fc, const float32_t fs, const float32_t comp_lvl)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if ( NULL != p_filter_inst )
+    {
+        // Allocate space
+        *p_filter_inst = malloc( sizeof( filter_bool_cnt_t ));
+
+        // Check if allocation succeed
+        if ( NULL != *p_filter_inst )
+        {
+            (*p_filter_inst)->is_init = false;
+
+            // Calculate coefficient and comparator levels
+            status = filter_bool_cnt_calc_par( fc, fs, comp_lvl, *p_filter_inst );
+
+            if ( eFILTER_OK == status )
+            {
+                (*p_filter_inst)->acc   = 0;
+                (*p_filter_inst)->y     = false;
+
+                #if ( 1 == FILTER_CFG_ATOMIC_EN )
+                    // Concurrent setter starts from init parameters
+                    (*p_filter_inst)->fc_new        = (*p_filter_inst)->fc;
+                    (*p_filter_inst)->alpha_new     = (*p_filter_inst)->alpha;
+                    (*p_filter_inst)->lvl_on_new    = (*p_filter_inst)->lvl_on;
+                    (*p_filter_inst)->lvl_off_new   = (*p_filter_inst)->lvl_off;
+                    filter_seqlock_init( &(*p_filter_inst)->lock );
+                #endif
+
+                // Init succeed
+                (*p_filter_inst)->is_init = true;
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get initialization status of integer boolean filter
+*
+* @param[in]    filter_inst - Integer boolean filter instance
+* @param[out]   p_is_init   - Integer boolean filter init state
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_bool_cnt_is_init(p_filter_bool_cnt_t filter_inst, bool * const p_is_init)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_is_init ))
+    {
+        *p_is_init = filter_inst->is_init;
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Handle integer boolean filter
+*
+* @note This function must be called in equidistant time period defined by 1/fs!
+*
+* @param[in]    filter_inst - Integer boolean filter instance
+* @param[in]    in          - Input value
+* @param[out]   p_out       - Output (filtered) value
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_bool_cnt_hndl(p_filter_bool_cnt_t filter_inst, const bool in, bool * const p_out)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_out ))
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            const int32_t x = (( true == in ) ? FILTER_BOOL_CNT_ONE : 0 );
+
+            // Take parameters set by concurrent setter
+            filter_bool_cnt_param_apply( filter_inst );
+
+            // Apply leaky integrator
+            filter_inst->acc = filter_bool_cnt_step( filter_inst->acc, x, filter_inst->alpha );
+
+            // Apply comparator
+            if  (   ( false == filter_inst->y )
+                &&  ( filter_inst->acc >= filter_inst->lvl_on ))
+            {
+                filter_inst->y = true;
+            }
+            else if (   ( true == filter_inst->y )
+                    &&  ( filter_inst->acc <= filter_inst->lvl_off ))
+            {
+                filter_inst->y = false;
+            }
+            else
+            {
+                // No actions...
+            }
+
+            // Return output
+            *p_out = filter_inst->y;
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Reset integer boolean filter
+*
+* @param[in]    filter_inst - Integer boolean filter instance
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_bool_cnt_reset(p_filter_bool_cnt_t filter_inst)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if ( NULL != filter_inst )
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            filter_inst->acc    = 0;
+            filter_inst->y      = false;
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Change integer boolean filter cutoff frequency
+*
+* @note     Integrator state and output are kept.
+*
+* @param[in]    filter_inst - Integer boolean filter instance
+* @param[in]    fc          - Cutoff frequency
+* @param[in]    comp_lvl    - Comparator level
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_bool_cnt_fc_set(p_filter_bool_cnt_t filter_inst, const float32_t fc, const float32_t comp_lvl)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if ( NULL != filter_inst )
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            status = filter_bool_cnt_calc_par( fc, filter_inst->fs, comp_lvl, filter_inst );
+
+            if ( eFILTER_OK == status )
+            {
+                filter_bool_cnt_param_publish( filter_inst );
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get integer boolean filter cutoff frequency
+*
+* @param[in]    filter_inst - Integer boolean filter instance
+* @param[out]   p_fc        - Filter cutoff frequency in Hz
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_bool_cnt_fc_get(p_filter_bool_cnt_t filter_inst, float32_t * const p_fc)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_fc ))
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            *p_fc = filter_inst->fc;
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+#if ( 1 == FILTER_CFG_ATOMIC_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Change integer boolean filter cutoff frequency from concurrent
+*       (control) thread
+*
+* @brief    New parameters are published with sequence lock and taken by
+*           sample path at start of next "filter_bool_cnt_hndl()" call.
+*           Sample path never waits.
+*
+* @note     "filter_bool_cnt_fc_set()" can be used along, but must be called from
+*           sample path thread only! Update from this function pending at
+*           its call takes precedence.
+*
+* @param[in]    filter_inst - Integer boolean filter instance
+* @param[in]    fc          - Cutoff frequency
+* @param[in]    comp_lvl    - Comparator level
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_bool_cnt_fc_set_atomic(p_filter_bool_cnt_t filter_inst, const float32_t fc, const float32_t comp_lvl)
+{
+    filter_status_t     status  = eFILTER_OK;
+    filter_bool_cnt_t   par     = { 0 };
+
+    if ( NULL != filter_inst )
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            status = filter_bool_cnt_calc_par( fc, filter_inst->fs, comp_lvl, &par );
+
+            // Publish data for newly set cutoff
+            if ( eFILTER_OK == status )
+            {
+                filter_seqlock_write_begin( &filter_inst->lock );
+
+                filter_inst->fc_new         = par.fc;
+                filter_inst->alpha_new      = par.alpha;
+                filter_inst->lvl_on_new     = par.lvl_on;
+                filter_inst->lvl_off_new    = par.lvl_off;
+
+                filter_seqlock_write_end( &filter_inst->lock );
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get integer boolean filter cutoff frequency from concurrent (control)
+*       thread
+*
+* @note     Returns cutoff last set by "filter_bool_cnt_fc_set_atomic()",
+*           even if sample path did not apply it yet, or by
+*           "filter_bool_cnt_fc_set()".
+*
+* @param[in]    filter_inst - Integer boolean filter instance
+* @param[out]   p_fc        - Filter cutoff frequency in Hz
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_bool_cnt_fc_get_atomic(p_filter_bool_cnt_t filter_inst, float32_t * const p_fc)
+{
+    filter_status_t status  = eFILTER_OK;
+    uint32_t        seq     = 0U;
+    bool            valid   = false;
+
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_fc ))
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            // Retry until consistent snapshot is taken
+            do
+            {
+                valid   = filter_seqlock_read_begin( &filter_inst->lock, &seq );
+                *p_fc   = filter_inst->fc_new;
+
+            } while (( false == valid ) || ( false == filter_seqlock_read_end( &filter_inst->lock, seq )));
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get integer boolean filter sampling frequency
+*
+* @param[in]    filter_inst - Integer boolean filter instance
+* @param[out]   p_fs        - Filter sampling frequency in Hz
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_bool_cnt_fs_get(p_filter_bool_cnt_t filter_inst, float32_t * const p_fs)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_fs ))
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            *p_fs = filter_inst->fs;
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*   Initialize boolean/debounce filter bank
+*
+* @brief    Debounces "num_of_ch" boolean channels packed in 64-bit words,
+*           one bit per channel (LSB first). Each channel uses integer
+*           leaky integrator with alpha = 2^-shift instead of RC filter and
+*           comparator with hysteresis, levels being inside integrator
+*           range. Alpha is rounded up to power of two and comparator
+*           levels are placed so that debounce time on step input equals
+*           to time of "filter_bool_hndl()" with same parameters.
+*
+* @note     Bank is NOT equivalent to "filter_bool_hndl()" on noisy
+*           input. Larger alpha averages over fewer samples, while
+*           levels are moved apart to keep step timing, so noise
+*           rejection differs. For random input at fs = 1 kHz outputs
+*           are equal at fc <= 5 Hz with comp_lvl <= 0.2, but differ on
+*           5..30 % of samples at fc = 10..100 Hz or comp_lvl = 0.3 (50 %
+*           duty), and can differ completely when duty is close to the
+*           switching threshold of either filter. Use "filter_bool_hndl()"
+*           or "filter_bool_cnt_hndl()" where noise behaviour matters.
+*
+* @note     Integrators are bit-sliced, so whole 64 channel word is
+*           processed with few bitwise operations per integrator bit.
+*
+* @param[in]    p_bank_inst - Pointer to boolean filter bank instance
+* @param[in]    num_of_ch   - Number of channels
+* @param[in]    fc          - Cutoff frequency
+* @param[in]    fs          - Sample frequency
+* @param[in]    comp_lvl    - Comparator level
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_bool_bank_init(p_filter_bool_bank_t * p_bank_inst, const uint32_t num_of_ch, const float32_t fc, const float32_t fs, const float32_t comp_lvl)
+{
+    filter_status_t     status          = eFILTER_OK;
+    filter_bool_bank_t  par             = { 0 };
+    uint32_t            num_of_words    = 0U;
+
+    if  (   ( NULL != p_bank_inst )
+        &&  ( num_of_ch > 0UL ))
+    {
+        // Calculate integrator and comparator levels
+        status = filter_bool_bank_calc_par( fc, fs, comp_lvl, &par );
+
+        if ( eFILTER_OK == status )
+        {
+            num_of_words = (( num_of_ch + 63U ) / 64U );
+
+            // Allocate space
+            *p_bank_inst = malloc( sizeof( filter_bool_bank_t ));
+
+            if ( NULL != *p_bank_inst )
+            {
+                (*p_bank_inst)->p_acc   = malloc( num_of_words * par.num_of_planes * sizeof( uint64_t ));
+                (*p_bank_inst)->p_y     = malloc( num_of_words * sizeof( uint64_t ));
+                (*p_bank_inst)->is_init = false;
+            }
+
+            // Check if allocation succeed
+            if  (   ( NULL != *p_bank_inst )
+                &&  ( NULL != (*p_bank_inst)->p_acc )
+                &&  ( NULL != (*p_bank_inst)->p_y ))
+            {
+                // Store configuration
+                (*p_bank_inst)->fc              = par.fc;
+                (*p_bank_inst)->fs              = par.fs;
+                (*p_bank_inst)->lvl_on          = par.lvl_on;
+                (*p_bank_inst)->lvl_off         = par.lvl_off;
+                (*p_bank_inst)->shift           = par.shift;
+                (*p_bank_inst)->num_of_ch       = num_of_ch;
+                (*p_bank_inst)->num_of_words    = num_of_words;
+                (*p_bank_inst)->num_of_planes   = par.num_of_planes;
+
+                // Initial value
+                memset( (*p_bank_inst)->p_acc, 0, num_of_words * par.num_of_planes * sizeof( uint64_t ));
+                memset( (*p_bank_inst)->p_y, 0, num_of_words * sizeof( uint64_t ));
+
+                // Init success
+                (*p_bank_inst)->is_init = true;
+            }
+            else
+            {
+                status = eFILTER_ERROR;
+            }
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get initialization status of boolean filter bank
+*
+* @param[in]    bank_inst   - Boolean filter bank instance
+* @param[out]   p_is_init   - Boolean filter bank init state
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_bool_bank_is_init(p_filter_bool_bank_t bank_inst, bool * const p_is_init)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != bank_inst )
+        &&  ( NULL != p_is_init ))
+    {
+        *p_is_init = bank_inst->is_init;
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Handle boolean filter bank
+*
+* @note This function must be called in equidistant time period defined by 1/fs!
+*
+* @note Unused bits of last word (above "num_of_ch") are ignored at input
+*       and always cleared at output.
+*
+* @param[in]    bank_inst   - Boolean filter bank instance
+* @param[in]    p_in        - Input words, one bit per channel (LSB first)
+* @param[out]   p_out       - Output (filtered) words, one bit per channel
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_bool_bank_hndl(p_filter_bool_bank_t bank_inst, const uint64_t * const p_in, uint64_t * const p_out)
+{
+    filter_status_t status = eFILTER_OK;
+
+    // Check for instance and success init
+    if  (   ( NULL != bank_inst )
+        &&  ( NULL != p_in )
+        &&  ( NULL != p_out ))
+    {
+        // Is instance init?
+        if ( true == bank_inst->is_init )
+        {
+            for ( uint32_t w = 0U; w < bank_inst->num_of_words; w++ )
+            {
+                p_out[w] = filter_bool_bank_word( bank_inst, w, p_in[w] );
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Handle boolean filter bank with edge output
+*
+* @brief    Same as "filter_bool_bank_hndl()" but instead of output words
+*           list of channels which output changed is returned. Edge index
+*           is channel number.
+*
+* @note     All edges are counted in "p_num_of_edges", but only first
+*           "max_edges" are stored. Caller detects overflow as
+*           *p_num_of_edges > max_edges.
+*
+* @param[in]    bank_inst       - Boolean filter bank instance
+* @param[in]    p_in            - Input words, one bit per channel (LSB first)
+* @param[out]   p_edge          - Edge list
+* @param[in]    max_edges       - Size of edge list
+* @param[out]   p_num_of_edges  - Number of edges
+* @return       status          - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_bool_bank_hndl_edges(p_filter_bool_bank_t bank_inst, const uint64_t * const p_in, filter_bool_edge_t * const p_edge, const uint32_t max_edges, uint32_t * const p_num_of_edges)
+{
+    filter_status_t status          = eFILTER_OK;
+    uint32_t        num_of_edges    = 0U;
+
+    // Check for instance and success init
+    if  (   ( NULL != bank_inst )
+        &&  ( NULL != p_in )
+        &&  ( NULL != p_num_of_edges )
+        &&  (( NULL != p_edge ) || ( 0U == max_edges )))
+    {
+        // Is instance init?
+        if ( true == bank_inst->is_init )
+        {
+            for ( uint32_t w = 0U; w < bank_inst->num_of_words; w++ )
+            {
+                const uint64_t y_prev = bank_inst->p_y[w];
+
+                num_of_edges = filter_bool_edges_add( filter_bool_bank_word( bank_inst, w, p_in[w] ), y_prev, ( w * 64U ), p_edge, max_edges, num_of_edges );
+            }
+
+            *p_num_of_edges = num_of_edges;
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Reset boolean filter bank
+*
+* @param[in]    bank_inst   - Boolean filter bank instance
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_bool_bank_reset(p_filter_bool_bank_t bank_inst)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if ( NULL != bank_inst )
+    {
+        // Is instance init?
+        if ( true == bank_inst->is_init )
+        {
+            memset( bank_inst->p_acc, 0, bank_inst->num_of_words * bank_inst->num_of_planes * sizeof( uint64_t ));
+            memset( bank_inst->p_y, 0, bank_inst->num_of_words * sizeof( uint64_t ));
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*   Initialize FIR filter
+*
+* @note     Filter order cannot be changed later!
+*
+*
+* @param[in]    p_filter_inst   - Pointer to FIR filter instance
+* @param[in]    p_a             - FIR coefficients
+* @param[in]    order           - Number of taps
+* @return       status          - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_fir_init(p_filter_fir_t * p_filter_inst, const float32_t * p_a, const uint32_t order, const float32_t init_value)
+{
+    filter_status_t         status      = eFILTER_OK;
+    ring_buffer_status_t    buf_status  = eRING_BUFFER_OK;
+
+    // Setup sample buffer
+    const ring_buffer_attr_t buf_attr =
+    {
+        .name       = NULL,
+        .p_mem      = NULL,    // dynamic allocation
+        .override   = true,
+        .item_size  = sizeof( float32_t )
+    };
+
+    if  (   ( NULL != p_filter_inst )
+        &&  ( order > 0UL )
+        &&  ( NULL != p_a ))
+    {
+        // Allocate filter space
+        *p_filter_inst = malloc( sizeof( filter_fir_t ));
+
+        // Allocation succeed
+        if ( NULL != *p_filter_inst )
+        {
+            // Allocate filter coefficient memory
+            (*p_filter_inst)->p_a = malloc( order * sizeof(float32_t));
+
+            // Allocate concurrent setter coefficient and stage memory
+            #if ( 1 == FILTER_CFG_ATOMIC_EN )
+                (*p_filter_inst)->p_a_new = malloc( 2U * order * sizeof(float32_t));
+            #endif
+
+            // Create ring buffer
+            buf_status = ring_buffer_init( &(*p_filter_inst)->p_x, order, &buf_attr );
+
+            // Ring buffer created
+            // and filter coefficient memory allocation succeed
+            if  (   ( eRING_BUFFER_OK == buf_status )
+                #if ( 1 == FILTER_CFG_ATOMIC_EN )
+                &&  ( NULL != (*p_filter_inst)->p_a_new )
+                #endif
+                &&  ( NULL != (*p_filter_inst)->p_a ))
+            {
+                // Get filter coefficient & order
+                memcpy( (*p_filter_inst)->p_a, p_a, order * sizeof( float32_t ));
+                (*p_filter_inst)->order = order;
+
+                #if ( 1 == FILTER_CFG_ATOMIC_EN )
+                    // Concurrent setter starts from init coefficients
+                    (*p_filter_inst)->p_a_stage = &(*p_filter_inst)->p_a_new[order];
+                    memcpy( (*p_filter_inst)->p_a_new, p_a, order * sizeof( float32_t ));
+                    filter_seqlock_init( &(*p_filter_inst)->lock );
+                #endif
+
+                // Fill buffer with initial value
+                filter_buf_fill( (*p_filter_inst)->p_x, init_value );
+
+                // Init success
+                (*p_filter_inst)->is_init = true;
+            }
+            else
+            {
+                status = eFILTER_ERROR;
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get initialization status of FIR filter
+*
+* @param[in]    filter_inst - FIR filter instance
+* @param[out]   p_is_init   - FIR filter init state
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_fir_is_init(p_filter_fir_t filter_inst, bool * const p_is_init)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_is_init ))
+    {
+        *p_is_init = filter_inst->is_init;
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*   Handle FIR filter
+*
+*   General FIR differential equation:
+*
+*       y[n] = SUM( a[i] * x[n-i] ),
+*
+*       where:
+*           a - FIR coefficients
+*           x - Input (un-filtered) signal
+*           y - Output (filtered) signal
+*
+* @note Above described equation is basically convolution operation.
+*
+* @note This function must be called in equidistant time period defined by 1/fs,
+*       when calculating FIR filter coefficients (a)!
+*
+* @param[in]    filter_inst - FIR filter instance
+* @param[in]    in          - Input value
+* @param[out]   p_out       - Output (filtered) value
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_fir_hndl(p_filter_fir_t filter_inst, const float32_t in, float32_t * const p_out)
+{
+    filter_status_t status  = eFILTER_OK;
+    float32_t       buf_val = 0.0f;
+
+    // Check for instance and success init
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_out ))
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            // Apply concurrently set parameters
+            filter_fir_param_apply( filter_inst );
+
+            // Add new sample to buffer
+            ring_buffer_add( filter_inst->p_x, (float32_t*) &in );
+
+            // Make convolution
+            for ( uint32_t i = 0U; i < filter_inst->order; i++ )
+            {
+                // Get buffer value
+                ring_buffer_get_by_index( filter_inst->p_x, (float32_t*) &buf_val,  (( -i ) - 1U ));
+
+                // Calculate convolution
+                *p_out += ( filter_inst->p_a[i] * buf_val );
+            }
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Reset FIR filter buffers
+*
+* @param[in]    filter_inst - FIR filter instance
+* @param[in]    rst_value   - Reset value
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_fir_reset(p_filter_fir_t filter_inst, const float32_t rst_value)
+{
+    filter_status_t status  = eFILTER_OK;
+
+    if ( NULL != filter_inst )
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            // First reset buffer
+            (void) ring_buffer_reset( filter_inst->p_x );
+
+            // Fill buffer with reset value
+            filter_buf_fill( filter_inst->p_x, rst_value );
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set coefficient of FIR filter on-the-fly
+*
+* @note     It is recommended to reset filter afterwards!
+*
+* @note     Make sure to provide filter order size of coefficients!
+*
+*
+* @param[in]    filter_inst - FIR filter instance
+* @param[in]    p_a         - New FIR filter coefficients
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_fir_coeff_set(p_filter_fir_t filter_inst, const float32_t * const p_a)
+{
+    filter_status_t status  = eFILTER_OK;
+
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_a ))
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            // Get filter coefficient & order
+            memcpy( filter_inst->p_a, p_a, ( filter_inst->order * sizeof( float32_t )));
+            filter_fir_param_publish( filter_inst );
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get FIR filter cutoff frequency
+*
+* @param[in]    filter_inst - RC filter instance
+* @param[out]   pp_a        - Pointer to pointer of FIR coefficients
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_fir_coeff_get(p_filter_fir_t filter_inst, float32_t ** const pp_a)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != pp_a ))
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            *pp_a = filter_inst->p_a;
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+#if ( 1 == FILTER_CFG_ATOMIC_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set coefficient of FIR filter from concurrent (control) thread
+*
+* @brief    New coefficients are published with sequence lock and taken by
+*           sample path at start of next "filter_fir_hndl()" call as a
+*           whole, so filter never runs with partially updated set.
+*
+* @note     Make sure to provide filter order size of coefficients!
+*
+* @note     "filter_fir_coeff_set()" can be used along, but must be called from
+*           sample path thread only! Update from this function pending at
+*           its call takes precedence.
+*
+* @param[in]    filter_inst - FIR filter instance
+* @param[in]    p_a         - New FIR filter coefficients
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_fir_coeff_set_atomic(p_filter_fir_t filter_inst, const float32_t * const p_a)
+{
+    filter_status_t status  = eFILTER_OK;
+
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_a ))
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            filter_seqlock_write_begin( &filter_inst->lock );
+
+            memcpy( filter_inst->p_a_new, p_a, ( filter_inst->order * sizeof( float32_t )));
+
+            filter_seqlock_write_end( &filter_inst->lock );
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get FIR filter coefficients from concurrent (control) thread
+*
+* @note     Coefficients last set by "filter_fir_coeff_set_atomic()" or
+*           "filter_fir_coeff_set()" are copied to p_a, which must hold filter order
+*           of values.
+*
+* @param[in]    filter_inst - FIR filter instance
+* @param[out]   p_a         - FIR coefficients
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_fir_coeff_get_atomic(p_filter_fir_t filter_inst, float32_t * const p_a)
+{
+    filter_status_t status  = eFILTER_OK;
+    uint32_t        seq     = 0U;
+    bool            valid   = false;
+
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_a ))
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            // Retry until consistent snapshot is taken
+            do
+            {
+                valid = filter_seqlock_read_begin( &filter_inst->lock, &seq );
+                memcpy( p_a, filter_inst->p_a_new, ( filter_inst->order * sizeof( float32_t )));
+
+            } while (( false == valid ) || ( false == filter_seqlock_read_end( &filter_inst->lock, seq )));
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*   Initialize IIR filter
+*
+*   General IIR filter difference equation:
+*
+*       y[n] = 1/a[0] * ( SUM( b[i] * x[n-i]) - ( SUM( a[i+1] * y[n-i-1] )))
+*
+*
+*   General IIR impulse response in time discrete space:
+*
+*       H(z) = ( b0 + b1*z^-1 + b2*z^-2 + ... bn*z^(-n-1) ) / ( -a0 - a1*z^-1 - a2*z^-2 - ... - an*z^(-n-1)),
+*
+*           where:     a - filter poles,
+*                   b - filter zeros
+*
+* @note Make sure that a[0] is non-zero value as it can later result in division by zero error!
+*
+* @note     Number of zeros and poles cannot be change later!
+*
+*
+* @param[in]    p_filter_inst   - Pointer to IIR filter instance
+* @param[in]    p_coeff         - IIR filter coefficients
+* @return       status          - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_iir_init(p_filter_iir_t * p_filter_inst, const filter_iir_coeff_t * const p_coeff)
+{
+    filter_status_t         status      = eFILTER_OK;
+    ring_buffer_status_t    buf_status  = eRING_BUFFER_OK;
+
+    // Setup sample buffer
+    const ring_buffer_attr_t buf_attr =
+    {
+        .name       = NULL,
+        .p_mem      = NULL,    // dynamic allocation
+        .override   = true,
+        .item_size  = sizeof( float32_t )
+    };
+
+    if  (   ( NULL != p_filter_inst )
+        &&  (( p_coeff->num_of_pole > 0UL ) && ( p_coeff->num_of_zero > 0UL ))
+        &&  (( NULL != p_coeff->p_pole )    && ( NULL != p_coeff->p_zero )))
+    {
+        // Allocate filter space
+        *p_filter_inst = malloc( sizeof( filter_iir_t ));
+
+        // Allocation succeed
+        if ( NULL != *p_filter_inst )
+        {
+            // Create ring buffers
+            buf_status  = ring_buffer_init( &(*p_filter_inst)->p_x, p_coeff->num_of_zero, &buf_attr );
+            buf_status |= ring_buffer_init( &(*p_filter_inst)->p_y, p_coeff->num_of_pole, &buf_attr );
+
+            // Allocate space for filter coefficients
+            (*p_filter_inst)->coeff.p_pole = malloc( p_coeff->num_of_pole * sizeof( float32_t ));
+            (*p_filter_inst)->coeff.p_zero = malloc( p_coeff->num_of_zero * sizeof( float32_t ));
+
+            // Allocate concurrent setter coefficient and stage memory
+            #if ( 1 == FILTER_CFG_ATOMIC_EN )
+                (*p_filter_inst)->p_coeff_new = malloc( 2U * ( p_coeff->num_of_pole + p_coeff->num_of_zero ) * sizeof( float32_t ));
+            #endif
+
+            // Check if ring buffer created
+            // and filter coefficient memory allocation succeed
+            if  (   ( eRING_BUFFER_OK == buf_status )
+                &&  ( NULL != (*p_filter_inst)->coeff.p_pole  )
+                #if ( 1 == FILTER_CFG_ATOMIC_EN )
+                &&  ( NULL != (*p_filter_inst)->p_coeff_new  )
+                #endif
+                &&  ( NULL != (*p_filter_inst)->coeff.p_zero  ))
+            {
+                // Get filter coefficient & order
+                memcpy( (*p_filter_inst)->coeff.p_pole, p_coeff->p_pole, p_coeff->num_of_pole * sizeof( float32_t ));
+                memcpy( (*p_filter_inst)->coeff.p_zero, p_coeff->p_zero, p_coeff->num_of_zero * sizeof( float32_t ));
+                (*p_filter_inst)->coeff.num_of_pole = p_coeff->num_of_pole;
+                (*p_filter_inst)->coeff.num_of_zero = p_coeff->num_of_zero;
+
+                #if ( 1 == FILTER_CFG_ATOMIC_EN )
+                    // Concurrent setter starts from init coefficients
+                    (*p_filter_inst)->p_coeff_stage = &(*p_filter_inst)->p_coeff_new[ p_coeff->num_of_pole + p_coeff->num_of_zero ];
+                    memcpy( (*p_filter_inst)->p_coeff_new, p_coeff->p_pole, p_coeff->num_of_pole * sizeof( float32_t ));
+                    memcpy( &(*p_filter_inst)->p_coeff_new[ p_coeff->num_of_pole ], p_coeff->p_zero, p_coeff->num_of_zero * sizeof( float32_t ));
+                    filter_seqlock_init( &(*p_filter_inst)->lock );
+                #endif
+
+                // Fill buffers with zero
+                filter_buf_fill( (*p_filter_inst)->p_x, 0.0f );
+                filter_buf_fill( (*p_filter_inst)->p_y, 0.0f );
+
+                // Init success
+                (*p_filter_inst)->is_init = true;
+            }
+            else
+            {
+                status = eFILTER_ERROR;
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get initialization status of IIR filter
+*
+* @param[in]    filter_inst - IIR filter instance
+* @param[out]   p_is_init   - IIR filter init state
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_iir_is_init(p_filter_iir_t filter_inst, bool * const p_is_init)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_is_init ))
+    {
+        *p_is_init = filter_inst->is_init;
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Handle IIR filter
+*
+* @note     This function must be called in equidistant time period defined by 1/fs,
+*           when zeros and poles are calculated!
+*
+* @note     In case that a[0] is zero, NAN is returned!
+*
+* @param[in]    filter_inst - IIR filter instance
+* @param[in]    in          - Input value
+* @param[out]   p_out       - Output (filtered) value
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_iir_hndl(p_filter_iir_t filter_inst, const float32_t in, float32_t * const p_out)
+{
+    filter_status_t status  = eFILTER_OK;
+    float32_t       buf_val = 0.0f;
+
+    // Check for instance and success init
+    if ( NULL != filter_inst )
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            // Apply concurrently set parameters
+            filter_iir_param_apply( filter_inst );
+
+            // Add new input to buffer
+            ring_buffer_add( filter_inst->p_x, (float32_t*) &in );
+
+            // Calculate filter value
+            for ( uint32_t i = 0; i < filter_inst->coeff.num_of_zero; i++ )
+            {
+                // Get sample
+                ring_buffer_get_by_index( filter_inst->p_x, (float32_t*) &buf_val, (( -i ) - 1 ));
+
+                // Sum zeros
+                *p_out += ( filter_inst->coeff.p_zero[i] * buf_val );
+            }
+
+            for ( uint32_t i = 1; i < filter_inst->coeff.num_of_pole; i++ )
+            {
+                // Get sample
+                ring_buffer_get_by_index( filter_inst->p_y, (float32_t*) &buf_val, -i );
+
+                // Subtract sum of poles
+                *p_out -= ( filter_inst->coeff.p_pole[i] * buf_val );
+            }
+
+            // Check division by
+            if ( filter_inst->coeff.p_pole[0] == 0.0f )
+            {
+                *p_out = NAN;
+            }
+            else
+            {
+                *p_out = ( *p_out / filter_inst->coeff.p_pole[0] );
+            }
+
+            // Add new output to buffer
+            (void) ring_buffer_add( filter_inst->p_y, (float32_t*) p_out );
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Reset IIR filter buffers
+*
+* @param[in]    filter_inst - RC filter instance
+* @param[in]    rst_value   - Reset value
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_iir_reset(p_filter_iir_t filter_inst)
+{
+    filter_status_t status  = eFILTER_OK;
+
+    if ( NULL != filter_inst )
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            // Fill buffers with zero
+            filter_buf_fill( filter_inst->p_x, 0.0f );
+            filter_buf_fill( filter_inst->p_y, 0.0f );
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set coefficient of IIR filter on-the-fly
+*
+* @note     It is recommended to reset filter afterwards!
+*
+* @note     Make sure to provide filter order size of coefficients!
+*
+* @param[in]    filter_inst - FIR filter instance
+* @param[in]    p_coeff     - New IIR filter coefficients
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_iir_coeff_set(p_filter_iir_t filter_inst, const filter_iir_coeff_t * const p_coeff)
+{
+    filter_status_t status  = eFILTER_OK;
+
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_coeff ))
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            memcpy( filter_inst->coeff.p_pole, p_coeff->p_pole, ( filter_inst->coeff.num_of_pole * sizeof(float32_t)));
+            memcpy( filter_inst->coeff.p_zero, p_coeff->p_zero, ( filter_inst->coeff.num_of_zero * sizeof(float32_t)));
+            filter_iir_param_publish( filter_inst );
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*   Get IIR filter coefficients
+*
+* @note This functions copy coefficients into place pointing by p_zero
+*       and p_pole parameter
+*
+* @param[in]    filter_inst - Pointer to FIR filter instance
+* @param[out]   p_zero      - Pointer to read zero coefficient
+* @param[out]   p_pole      - Pointer to read pole coefficient
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_iir_coeff_get(p_filter_iir_t filter_inst, filter_iir_coeff_t ** const pp_coeff)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != pp_coeff ))
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            *pp_coeff = &filter_inst->coeff;
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+#if ( 1 == FILTER_CFG_ATOMIC_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set coefficient of IIR filter from concurrent (control) thread
+*
+* @brief    New coefficients are published with sequence lock and taken by
+*           sample path at start of next "filter_iir_hndl()" call as a
+*           whole, so filter never runs with partially updated set.
+*
+* @note     Number of poles and zeros is taken from filter instance, make
+*           sure to provide filter order size of coefficients!
+*
+* @note     "filter_iir_coeff_set()" can be used along, but must be called from
+*           sample path thread only! Update from this function pending at
+*           its call takes precedence.
+*
+* @param[in]    filter_inst - IIR filter instance
+* @param[in]    p_coeff     - New IIR filter coefficients
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_iir_coeff_set_atomic(p_filter_iir_t filter_inst, const filter_iir_coeff_t * const p_coeff)
+{
+    filter_status_t status  = eFILTER_OK;
+
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_coeff ))
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            filter_seqlock_write_begin( &filter_inst->lock );
+
+            memcpy( filter_inst->p_coeff_new, p_coeff->p_pole, ( filter_inst->coeff.num_of_pole * sizeof( float32_t )));
+            memcpy( &filter_inst->p_coeff_new[ filter_inst->coeff.num_of_pole ], p_coeff->p_zero, ( filter_inst->coeff.num_of_zero * sizeof( float32_t )));
+
+            filter_seqlock_write_end( &filter_inst->lock );
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get IIR filter coefficients from concurrent (control) thread
+*
+* @note     Coefficients last set by "filter_iir_coeff_set_atomic()" or
+*           "filter_iir_coeff_set()" are copied to arrays pointed by p_coeff, which
+*           must hold number of poles and zeros of filter.
+*
+* @param[in]    filter_inst - IIR filter instance
+* @param[out]   p_coeff     - IIR coefficients
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_iir_coeff_get_atomic(p_filter_iir_t filter_inst, filter_iir_coeff_t * const p_coeff)
+{
+    filter_status_t status  = eFILTER_OK;
+    uint32_t        seq     = 0U;
+    bool            valid   = false;
+
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_coeff )
+        &&  ( NULL != p_coeff->p_pole )
+        &&  ( NULL != p_coeff->p_zero ))
+    {
+        // Is instance init?
+        if ( true == filter_inst->is_init )
+        {
+            // Retry until consistent snapshot is taken
+            do
+            {
+                valid = filter_seqlock_read_begin( &filter_inst->lock, &seq );
+                memcpy( p_coeff->p_pole, filter_inst->p_coeff_new, ( filter_inst->coeff.num_of_pole * sizeof( float32_t )));
+                memcpy( p_coeff->p_zero, &filter_inst->p_coeff_new[ filter_inst->coeff.num_of_pole ], ( filter_inst->coeff.num_of_zero * sizeof( float32_t )));
+
+            } while (( false == valid ) || ( false == filter_seqlock_read_end( &filter_inst->lock, seq )));
+
+            p_coeff->num_of_pole = filter_inst->coeff.num_of_pole;
+            p_coeff->num_of_zero = filter_inst->coeff.num_of_zero;
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*   Calculate IIR 2nd order low pass filter coefficients
+*
+* @note      Equations taken from: https://webaudio.github.io/Audio-EQ-Cookbook/audio-eq-cookbook.html
+*
+* @note      Additional check is made if sampling theorem is fulfilled.
+*
+* @param[in]    fc      - Cutoff frequency
+* @param[in]    zeta    - Damping factor
+* @param[in]    fs      - Sampling frequency
+* @param[out]   p_pole  - Pointer to newly calculated IIR poles
+* @param[out]   p_zero  - Pointer to newly calculated IIR zeros
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_iir_coeff_calc_2nd_lpf(const float32_t fc, const float32_t zeta, const float32_t fs, float32_t * const p_pole, float32_t * const p_zero)
+{
+    filter_status_t status      = eFILTER_OK;
+    float32_t       omega       = 0.0f;
+    float32_t       cos_omega   = 0.0f;
+    float32_t       alpha       = 0.0f;
+
+    if  (   ( NULL != p_pole )
+        &&  ( NULL != p_zero ))
+    {
+        // Check Nyquist/Shannon sampling theorem
+        if ( fc < ( fs / 2.0f ))
+        {
+            omega = ( 2.0f * ( M_PI * ( fc / fs )));
+            alpha = ( sinf( omega ) * zeta );
+            cos_omega = cosf( omega );
+
+            // Calculate zeros & poles
+            p_zero[0] = (( 1.0f - cos_omega ) / 2.0f );
+            p_zero[1] = ( 1.0f - cos_omega );
+            p_zero[2] = (( 1.0f - cos_omega ) / 2.0f );
+            p_pole[0] = ( 1.0f + alpha );
+            p_pole[1] = ( -2.0f * cos_omega );
+            p_pole[2] = ( 1.0f - alpha );
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*   Calculate IIR 2nd order high pass filter coefficients
+*
+* @note     Equations taken from: https://webaudio.github.io/Audio-EQ-Cookbook/audio-eq-cookbook.html
+*
+* @note     Additional check is made if sampling theorem is fulfilled.
+*
+* @param[in]    fc      - Cutoff frequency
+* @param[in]    zeta    - Damping factor
+* @param[in]    fs      - Sampling frequency
+* @param[out]   p_pole  - Pointer to newly calculated IIR poles
+* @param[out]   p_zero  - Pointer to newly calculated IIR zeros
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_iir_coeff_calc_2nd_hpf(const float32_t fc, const float32_t zeta, const float32_t fs, float32_t * const p_pole, float32_t * const p_zero)
+{
+    filter_status_t status      = eFILTER_OK;
+    float32_t       omega       = 0.0f;
+    float32_t       cos_omega   = 0.0f;
+    float32_t       alpha       = 0.0f;
+
+    if  (   ( NULL != p_pole )
+        &&  ( NULL != p_zero ))
+    {
+        // Check Nyquist/Shannon sampling theorem
+        if ( fc < ( fs / 2.0f ))
+        {
+            omega = ( 2.0f * ( M_PI * ( fc / fs )));
+            alpha = ( sinf( omega ) * zeta );
+            cos_omega = cosf( omega );
+
+            // Calculate zeros & poles
+            p_zero[0] = (( 1.0f + cos_omega ) / 2.0f );
+            p_zero[1] = -( 1.0f + cos_omega );
+            p_zero[2] = (( 1.0f + cos_omega ) / 2.0f );
+            p_pole[0] = ( 1.0f + alpha );
+            p_pole[1] = ( -2.0f * cos_omega );
+            p_pole[2] = ( 1.0f - alpha );
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*   Calculate IIR 2nd order notch (band stop) filter coefficients
+*
+* @note     Equations taken from: https://webaudio.github.io/Audio-EQ-Cookbook/audio-eq-cookbook.html
+*
+* @note     Additional check is made if sampling theorem is fulfilled.
+*
+* @note     Value of r must be within 0.0 and 1.0, typically it is around
+*            0.80 - 0.99.
+*
+* @param[in]    fc      - Cutoff frequency
+* @param[in]    r       - Bandwidth of filter
+* @param[in]    fs      - Sampling frequency
+* @param[out]   p_pole  - Pointer to newly calculated IIR poles
+* @param[out]   p_zero  - Pointer to newly calculated IIR zeros
+* @return       status  - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-filter_status_t filter_boot_fc_set(p_filter_bool_t filter_inst, const float32_t fc)
+filter_status_t filter_iir_coeff_calc_2nd_bpf(const float32_t fc, const float32_t r, const float32_t fs, float32_t * const p_pole, float32_t * const p_zero)
 {
-    filter_status_t status = eFILTER_OK;
+    filter_status_t status      = eFILTER_OK;
+    float32_t       omega       = 0.0f;
+    float32_t       cos_omega   = 0.0f;
 
-    if ( NULL != filter_inst )
+    if  (   ( NULL != p_pole )
+        &&  ( NULL != p_zero )
+        &&  (( r > 0.0f ) && ( r < 1.0f )))
     {
-        // Is instance init?
-        if ( true == filter_inst->is_init )
+        // Check Nyquist/Shannon sampling theorem
+        if ( fc < ( fs / 2.0f ))
         {
-            // Set LPF fc
-            status = filter_rc_fc_set( filter_inst->lpf, fc );
+            omega = ( 2.0f * ( M_PI * ( fc / fs )));
+            cos_omega = cosf( omega );
+
+            // Calculate zeros & poles
+            p_zero[0] = 1.0f;
+            p_zero[1] = ( -2.0f  * cos_omega );
+            p_zero[2] = 1.0f;
+            p_pole[0] = 1.0f;
+            p_pole[1] = ( -2.0f * ( r * cos_omega ));
+            p_pole[2] = ( r * r );
         }
         else
         {
@@ -1002,62 +10328,214 @@ filter_status_t filter_boot_fc_set(p_filter_bool_t filter_inst, const float32_t
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Get Boolean filter cutoff frequency
+*   Calculate gain at DC frequency of LPF IIR filter based on it's poles & zeros
 *
-* @param[in]    filter_inst - Boolean filter instance
-* @param[out]   p_fc        - Filter cutoff frequency in Hz
-* @return       status      - Status of operation
+* @note     Equations taken from book:
+*
+*        "The Scientist and Engineer's Guide to Digital Signal Processing",
+*
+*        G = 1/a0 * (( b0 + b1 + ... + bn ) / ( 1 + (( a1 + a2 + ... + an+1 ) / a0 ))),
+*
+*        where:  a - poles
+*                b - zeros
+*
+* @param[in]    p_coeff - IIR filter coefficients
+* @return       dc_gain - Gain of filter at zero (DC) frequency
 */
 ////////////////////////////////////////////////////////////////////////////////
-filter_status_t filter_bool_fc_get(p_filter_bool_t filter_inst, float32_t * const p_fc)
+float32_t filter_iir_calc_lpf_gain(const filter_iir_coeff_t * const p_coeff)
 {
-    filter_status_t status = eFILTER_OK;
+    float32_t dc_gain     = NAN;
+    float32_t pole_sum     = 0.0f;
+    float32_t zero_sum     = 0.0f;
 
-    if  (   ( NULL != filter_inst )
-        &&  ( NULL != p_fc ))
+    if ( NULL != p_coeff )
     {
-        // Is instance init?
-        if ( true == filter_inst->is_init )
+        // Sum poles & zeros
+        for( uint32_t i = 1; i < p_coeff->num_of_pole; i++ )
         {
-            (void) filter_rc_fc_get( filter_inst->lpf, p_fc );
+            pole_sum += p_coeff->p_pole[i];
         }
-        else
+
+        for( uint32_t i = 0; i < p_coeff->num_of_zero; i++ )
         {
-            status = eFILTER_ERROR;
+            zero_sum += p_coeff->p_zero[i];
+        }
+
+        // Calculate gain at 0 frequency
+        if ( p_coeff->p_pole[0] != 0.0f )
+        {
+            pole_sum = (( pole_sum / p_coeff->p_pole[0] ) + 1.0f );
+
+            if ( pole_sum != 0.0f )
+            {
+                dc_gain = (( zero_sum / pole_sum ) / p_coeff->p_pole[0] );
+            }
         }
     }
-    else
+
+    return dc_gain;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*   Calculate gain @0.5 normalize frequency (w=fc/fs) of HPF IIR
+*   filter based on it's poles & zeros
+*
+* @note Normalize frequency of 0.5 is the highest cutoff frequency for HPF
+*         filter that don't break Nyquist/Shannon sampling theorem.
+*
+* @note Equations taken from book:
+*
+*        "The Scientist and Engineer's Guide to Digital Signal Processing"
+*
+*
+*        G = 1/a0 * (( b0 - b1 + b2 - b3 +... + bn ) / ( 1 + (( a1 - a2 + a3 - a4 + ... + an+1 ) / a0 )))
+*
+*        where:  a - poles
+*                b - zeros
+*
+* @param[in]     p_pole     - Pointer to IIR poles
+* @param[in]     p_zero     - Pointer to IIR zeros
+* @param[in]     pole_size  - Number of poles
+* @param[in]     zero_size  - Number of zeros
+* @return        dc_gain    - Gain of filter at 0.5 normalized frequency (Nyquist freq)
+*/
+////////////////////////////////////////////////////////////////////////////////
+float32_t filter_iir_calc_hpf_gain(const filter_iir_coeff_t * const p_coeff)
+{
+    float32_t dc_gain   = NAN;
+    float32_t pole_sum  = 0.0f;
+    float32_t zero_sum  = 0.0f;
+
+    if ( NULL != p_coeff)
     {
-        status = eFILTER_ERROR;
+        // Sum poles
+        for( uint32_t i = 1; i < p_coeff->num_of_pole; i++ )
+        {
+            if ( i & 0x01U )
+            {
+                pole_sum -= p_coeff->p_pole[i];
+            }
+            else
+            {
+                pole_sum += p_coeff->p_pole[i];
+            }
+        }
+
+        // Sum zeros
+        for( uint32_t i = 0; i < p_coeff->num_of_zero; i++ )
+        {
+            if ( i & 0x01U )
+            {
+                zero_sum -= p_coeff->p_zero[i];
+            }
+            else
+            {
+                zero_sum += p_coeff->p_zero[i];
+            }
+        }
+
+        // Calculate gain at Nyquist frequency
+        if ( p_coeff->p_pole[0] != 0.0f )
+        {
+            pole_sum = (( pole_sum / p_coeff->p_pole[0] ) + 1.0f );
+
+            if ( pole_sum != 0.0f )
+            {
+                dc_gain = (( zero_sum / pole_sum ) / p_coeff->p_pole[0] );
+            }
+        }
     }
 
-    return status;
+    return dc_gain;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Get Boolean filter sampling frequency
+*   Normalize zeros of IIR filter in order to get unity gain at DC frequency
 *
-* @param[in]    filter_inst - RC filter instance
-* @param[out]   p_fs        - Filter sampling frequency in Hz
-* @return       status      - Status of operation
+* @note     Implementation taken from book:
+*
+*           "The Scientist and Engineer's Guide to Digital Signal Processing"
+*
+*       If requirement is to have a gain of 1 at DC frequency then simply
+*       call this function across already calculated coefficients. This newly
+*       calculated coefficients will result in unity gain filter.
+*
+* @note     This techniques simply calculated DC gain (G) and then divide all
+*           zeros of IIR filter with it. Thus only zeros are affected by
+*           this function math.
+*
+* @param[in]    p_coeff - IIR filter coefficients
+* @return       status  - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-filter_status_t filter_bool_fs_get(p_filter_bool_t filter_inst, float32_t * const p_fs)
+filter_status_t filter_iir_coeff_to_unity_gain_lpf(filter_iir_coeff_t * const p_coeff)
 {
     filter_status_t status = eFILTER_OK;
 
-    if  (   ( NULL != filter_inst )
-        &&  ( NULL != p_fs ))
+    if ( NULL != p_coeff )
     {
-        // Is instance init?
-        if ( true == filter_inst->is_init )
+        // Calculate DC gain
+        const float32_t dc_gain = filter_iir_calc_lpf_gain( p_coeff );
+
+        // Check gain
+        if ( dc_gain > 0.0f )
         {
-            (void) filter_rc_fs_get( filter_inst->lpf, p_fs );
+            // Normalize zeros
+            for ( uint32_t i = 0; i < p_coeff->num_of_zero; i++ )
+            {
+                p_coeff->p_zero[i] = ( p_coeff->p_zero[i] / dc_gain );
+            }
         }
-        else
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*   Normalize zeros of IIR filter in order to get unity gain at
+*   0.5 normalized frequency
+*
+* @note Implementation taken from book:
+*
+*        "The Scientist and Engineer's Guide to Digital Signal Processing"
+*
+*    If requirement is to have a gain of 1 at DC frequency then simply
+*    call this function across already calculated coefficients. This newly
+*    calculated coefficients will result in unity gain filter.
+*
+* @note     This techniques simply calculated DC gain (G) and then divide all
+*           zeros of IIR filter with it. Thus only zeros are affected by
+*           this function math.
+*
+* @param[in]    p_coeff - IIR filter coefficients
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_iir_coeff_to_unity_gain_hpf(filter_iir_coeff_t * const p_coeff)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if ( NULL != p_coeff )
+    {
+        // Calculate DC gain
+        const float32_t dc_gain = filter_iir_calc_hpf_gain( p_coeff );
+
+        // Check gain
+        if ( dc_gain > 0.0f )
         {
-            status = eFILTER_ERROR;
+            // Normalize zeros
+            for ( uint32_t i = 0; i < p_coeff->num_of_zero; i++ )
+            {
+                p_coeff->p_zero[i] = ( p_coeff->p_zero[i] / dc_gain );
+            }
         }
     }
     else
@@ -1070,71 +10548,86 @@ filter_status_t filter_bool_fs_get(p_filter_bool_t filter_inst, float32_t * cons
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*   Initialize FIR filter
+*       Initialize SOS filter
 *
-* @note     Filter order cannot be changed later!
+* @brief    SOS filter is cascade of 1st/2nd order sections, each in
+*           direct form II. Compared to single high order IIR filter its
+*           response is much less sensitive to coefficient rounding.
 *
+* @note     Section coefficients are normalized so that b0 of all sections
+*           is gathered into single gain, therefore b0 and a0 of section
+*           must not be zero.
 *
-* @param[in]    p_filter_inst   - Pointer to FIR filter instance
-* @param[in]    p_a             - FIR coefficients
-* @param[in]    order           - Number of taps
+* @param[in]    p_filter_inst   - Pointer to SOS filter instance
+* @param[in]    p_sect          - Section coefficients, in cascade order
+* @param[in]    num_of_sect     - Number of sections
 * @return       status          - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-filter_status_t filter_fir_init(p_filter_fir_t * p_filter_inst, const float32_t * p_a, const uint32_t order, const float32_t init_value)
+filter_status_t filter_sos_init(p_filter_sos_t * p_filter_inst, const filter_sos_coeff_t * const p_sect, const uint32_t num_of_sect)
 {
-    filter_status_t         status      = eFILTER_OK;
-    ring_buffer_status_t    buf_status  = eRING_BUFFER_OK;
-
-    // Setup sample buffer
-    const ring_buffer_attr_t buf_attr =
-    {
-        .name       = NULL,
-        .p_mem      = NULL,    // dynamic allocation
-        .override   = true,
-        .item_size  = sizeof( float32_t )
-    };
+    filter_status_t status  = eFILTER_OK;
+    double          gain    = 1.0;
 
     if  (   ( NULL != p_filter_inst )
-        &&  ( order > 0UL )
-        &&  ( NULL != p_a ))
+        &&  ( NULL != p_sect )
+        &&  ( num_of_sect > 0UL ))
     {
-        // Allocate filter space
-        *p_filter_inst = malloc( sizeof( filter_fir_t ));
-
-        // Allocation succeed
-        if ( NULL != *p_filter_inst )
+        // Check sections
+        for ( uint32_t s = 0U; s < num_of_sect; s++ )
         {
-            // Allocate filter coefficient memory
-            (*p_filter_inst)->p_a = malloc( order * sizeof(float32_t));
+            if  (   ( 0.0f == p_sect[s].b[0] )
+                ||  ( 0.0f == p_sect[s].a[0] ))
+            {
+                status = eFILTER_ERROR;
+            }
+        }
 
-            // Create ring buffer
-            buf_status = ring_buffer_init( &(*p_filter_inst)->p_x, order, &buf_attr );
+        if ( eFILTER_OK == status )
+        {
+            // Allocate filter space
+            *p_filter_inst = malloc( sizeof( filter_sos_t ));
 
-            // Ring buffer created
-            // and filter coefficient memory allocation succeed
-            if  (   ( eRING_BUFFER_OK == buf_status )
-                &&  ( NULL != (*p_filter_inst)->p_a ))
+            // Allocation succeed
+            if ( NULL != *p_filter_inst )
             {
-                // Get filter coefficient & order
-                memcpy( (*p_filter_inst)->p_a, p_a, order * sizeof( float32_t ));
-                (*p_filter_inst)->order = order;
-
-                // Fill buffer with initial value
-                filter_buf_fill( (*p_filter_inst)->p_x, init_value );
+                (*p_filter_inst)->p_sect = malloc( num_of_sect * sizeof( filter_sos_sect_t ));
 
-                // Init success
-                (*p_filter_inst)->is_init = true;
+                if ( NULL != (*p_filter_inst)->p_sect )
+                {
+                    for ( uint32_t s = 0U; s < num_of_sect; s++ )
+                    {
+                        filter_sos_sect_t * const p_s = &(*p_filter_inst)->p_sect[s];
+
+                        // Normalize to b0 = a0 = 1
+                        p_s->b[0]           = ( p_sect[s].b[1] / p_sect[s].b[0] );
+                        p_s->b[1]           = ( p_sect[s].b[2] / p_sect[s].b[0] );
+                        p_s->a[0]           = ( p_sect[s].a[1] / p_sect[s].a[0] );
+                        p_s->a[1]           = ( p_sect[s].a[2] / p_sect[s].a[0] );
+                        p_s->w[0]           = 0.0f;
+                        p_s->w[1]           = 0.0f;
+                        p_s->num_of_zero    = filter_sos_poly_order( p_sect[s].b );
+                        p_s->num_of_pole    = filter_sos_poly_order( p_sect[s].a );
+
+                        gain *= ((double) p_sect[s].b[0] / (double) p_sect[s].a[0] );
+                    }
+
+                    (*p_filter_inst)->gain          = (float32_t) gain;
+                    (*p_filter_inst)->num_of_sect   = num_of_sect;
+
+                    // Init success
+                    (*p_filter_inst)->is_init = true;
+                }
+                else
+                {
+                    status = eFILTER_ERROR;
+                }
             }
             else
             {
                 status = eFILTER_ERROR;
             }
         }
-        else
-        {
-            status = eFILTER_ERROR;
-        }
     }
     else
     {
@@ -1146,14 +10639,14 @@ filter_status_t filter_fir_init(p_filter_fir_t * p_filter_inst, const float32_t
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Get initialization status of FIR filter
+*       Get initialization status of SOS filter
 *
-* @param[in]    filter_inst - FIR filter instance
-* @param[out]   p_is_init   - FIR filter init state
+* @param[in]    filter_inst - SOS filter instance
+* @param[out]   p_is_init   - SOS filter init state
 * @return       status      - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-filter_status_t filter_fir_is_init(p_filter_fir_t filter_inst, bool * const p_is_init)
+filter_status_t filter_sos_is_init(p_filter_sos_t filter_inst, bool * const p_is_init)
 {
     filter_status_t status = eFILTER_OK;
 
@@ -1172,81 +10665,35 @@ filter_status_t filter_fir_is_init(p_filter_fir_t filter_inst, bool * const p_is
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*   Handle FIR filter
-*
-*   General FIR differential equation:
-*
-*       y[n] = SUM( a[i] * x[n-i] ),
-*
-*       where:
-*           a - FIR coefficients
-*           x - Input (un-filtered) signal
-*           y - Output (filtered) signal
-*
-* @note Above described equation is basically convolution operation.
+*       Handle SOS filter
 *
-* @note This function must be called in equidistant time period defined by 1/fs,
-*       when calculating FIR filter coefficients (a)!
+* @note     This function must be called in equidistant time period defined by 1/fs,
+*           when sections are calculated!
 *
-* @param[in]    filter_inst - FIR filter instance
+* @param[in]    filter_inst - SOS filter instance
 * @param[in]    in          - Input value
 * @param[out]   p_out       - Output (filtered) value
 * @return       status      - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-filter_status_t filter_fir_hndl(p_filter_fir_t filter_inst, const float32_t in, float32_t * const p_out)
+filter_status_t filter_sos_hndl(p_filter_sos_t filter_inst, const float32_t in, float32_t * const p_out)
 {
-    filter_status_t status  = eFILTER_OK;
-    float32_t       buf_val = 0.0f;
+    filter_status_t status = eFILTER_OK;
 
-    // Check for instance and success init
     if  (   ( NULL != filter_inst )
         &&  ( NULL != p_out ))
     {
         // Is instance init?
         if ( true == filter_inst->is_init )
         {
-            // Add new sample to buffer
-            ring_buffer_add( filter_inst->p_x, (float32_t*) &in );
+            float32_t y = ( filter_inst->gain * in );
 
-            // Make convolution
-            for ( uint32_t i = 0U; i < filter_inst->order; i++ )
+            for ( uint32_t s = 0U; s < filter_inst->num_of_sect; s++ )
             {
-                // Get buffer value
-                ring_buffer_get_by_index( filter_inst->p_x, (float32_t*) &buf_val,  (( -i ) - 1U ));
-
-                // Calculate convolution
-                *p_out += ( filter_inst->p_a[i] * buf_val );
+                y = filter_sos_sect_hndl( &filter_inst->p_sect[s], y );
             }
-        }
-    }
-
-    return status;
-}
-
-////////////////////////////////////////////////////////////////////////////////
-/**
-*       Reset FIR filter buffers
-*
-* @param[in]    filter_inst - FIR filter instance
-* @param[in]    rst_value   - Reset value
-* @return       status      - Status of operation
-*/
-////////////////////////////////////////////////////////////////////////////////
-filter_status_t filter_fir_reset(p_filter_fir_t filter_inst, const float32_t rst_value)
-{
-    filter_status_t status  = eFILTER_OK;
-
-    if ( NULL != filter_inst )
-    {
-        // Is instance init?
-        if ( true == filter_inst->is_init )
-        {
-            // First reset buffer
-            (void) ring_buffer_reset( filter_inst->p_x );
 
-            // Fill buffer with reset value
-            filter_buf_fill( filter_inst->p_x, rst_value );
+            *p_out = y;
         }
         else
         {
@@ -1263,30 +10710,49 @@ filter_status_t filter_fir_reset(p_filter_fir_t filter_inst, const float32_t rst
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Set coefficient of FIR filter on-the-fly
-*
-* @note     It is recommended to reset filter afterwards!
+*       Handle block of samples with SOS filter
 *
-* @note     Make sure to provide filter order size of coefficients!
+* @brief    Whole block is passed through one section before next one, so
+*           that section coefficients and states stay in registers.
 *
+* @note     In-place processing ( p_in == p_out ) is supported.
 *
-* @param[in]    filter_inst - FIR filter instance
-* @param[in]    p_a         - New FIR filter coefficients
+* @param[in]    filter_inst - SOS filter instance
+* @param[in]    p_in        - Input samples
+* @param[out]   p_out       - Output (filtered) samples
+* @param[in]    size        - Number of samples
 * @return       status      - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-filter_status_t filter_fir_coeff_set(p_filter_fir_t filter_inst, const float32_t * const p_a)
+filter_status_t filter_sos_hndl_block(p_filter_sos_t filter_inst, const float32_t * const p_in, float32_t * const p_out, const uint32_t size)
 {
-    filter_status_t status  = eFILTER_OK;
+    filter_status_t status = eFILTER_OK;
 
     if  (   ( NULL != filter_inst )
-        &&  ( NULL != p_a ))
+        &&  ( NULL != p_in )
+        &&  ( NULL != p_out ))
     {
         // Is instance init?
         if ( true == filter_inst->is_init )
         {
-            // Get filter coefficient & order
-            memcpy( filter_inst->p_a, p_a, ( filter_inst->order * sizeof( float32_t )));
+            for ( uint32_t i = 0U; i < size; i++ )
+            {
+                p_out[i] = ( filter_inst->gain * p_in[i] );
+            }
+
+            for ( uint32_t s = 0U; s < filter_inst->num_of_sect; s++ )
+            {
+                // Local copy of section
+                filter_sos_sect_t sect = filter_inst->p_sect[s];
+
+                for ( uint32_t i = 0U; i < size; i++ )
+                {
+                    p_out[i] = filter_sos_sect_hndl( &sect, p_out[i] );
+                }
+
+                filter_inst->p_sect[s].w[0] = sect.w[0];
+                filter_inst->p_sect[s].w[1] = sect.w[1];
+            }
         }
         else
         {
@@ -1303,24 +10769,26 @@ filter_status_t filter_fir_coeff_set(p_filter_fir_t filter_inst, const float32_t
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Get FIR filter cutoff frequency
+*       Reset SOS filter states
 *
-* @param[in]    filter_inst - RC filter instance
-* @param[out]   pp_a        - Pointer to pointer of FIR coefficients
+* @param[in]    filter_inst - SOS filter instance
 * @return       status      - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-filter_status_t filter_fir_coeff_get(p_filter_fir_t filter_inst, float32_t ** const pp_a)
+filter_status_t filter_sos_reset(p_filter_sos_t filter_inst)
 {
     filter_status_t status = eFILTER_OK;
 
-    if  (   ( NULL != filter_inst )
-        &&  ( NULL != pp_a ))
+    if ( NULL != filter_inst )
     {
         // Is instance init?
         if ( true == filter_inst->is_init )
         {
-            *pp_a = filter_inst->p_a;
+            for ( uint32_t s = 0U; s < filter_inst->num_of_sect; s++ )
+            {
+                filter_inst->p_sect[s].w[0] = 0.0f;
+                filter_inst->p_sect[s].w[1] = 0.0f;
+            }
         }
         else
         {
@@ -1337,90 +10805,32 @@ filter_status_t filter_fir_coeff_get(p_filter_fir_t filter_inst, float32_t ** co
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*   Initialize IIR filter
-*
-*   General IIR filter difference equation:
-*
-*       y[n] = 1/a[0] * ( SUM( b[i] * x[n-i]) - ( SUM( a[i+1] * y[n-i-1] )))
-*
-*
-*   General IIR impulse response in time discrete space:
-*
-*       H(z) = ( b0 + b1*z^-1 + b2*z^-2 + ... bn*z^(-n-1) ) / ( -a0 - a1*z^-1 - a2*z^-2 - ... - an*z^(-n-1)),
-*
-*           where:     a - filter poles,
-*                   b - filter zeros
+*   Initialize generic filter with custom interface
 *
-* @note Make sure that a[0] is non-zero value as it can later result in division by zero error!
+* @brief    Generic filter wraps any filter stage behind common interface,
+*           so that different filters can be chained and handled without
+*           knowing their type. Custom stages provide their own interface.
 *
-* @note     Number of zeros and poles cannot be change later!
+* @note     Interface handler is mandatory, block, reset, state size and
+*           sampling frequency handlers are optional (NULL). Without block
+*           handler samples are passed one by one to handler.
 *
+* @note     Interface must be valid for whole lifetime of generic filter!
 *
-* @param[in]    p_filter_inst   - Pointer to IIR filter instance
-* @param[in]    p_coeff         - IIR filter coefficients
+* @param[in]    p_filter_inst   - Pointer to generic filter instance
+* @param[in]    p_iface         - Filter interface
+* @param[in]    p_inst          - Custom filter instance, passed to interface
 * @return       status          - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-filter_status_t filter_iir_init(p_filter_iir_t * p_filter_inst, const filter_iir_coeff_t * const p_coeff)
+filter_status_t filter_init(p_filter_t * p_filter_inst, const filter_iface_t * const p_iface, void * const p_inst)
 {
-    filter_status_t         status      = eFILTER_OK;
-    ring_buffer_status_t    buf_status  = eRING_BUFFER_OK;
-
-    // Setup sample buffer
-    const ring_buffer_attr_t buf_attr =
-    {
-        .name       = NULL,
-        .p_mem      = NULL,    // dynamic allocation
-        .override   = true,
-        .item_size  = sizeof( float32_t )
-    };
+    filter_status_t status = eFILTER_OK;
 
-    if  (   ( NULL != p_filter_inst )
-        &&  (( p_coeff->num_of_pole > 0UL ) && ( p_coeff->num_of_zero > 0UL ))
-        &&  (( NULL != p_coeff->p_pole )    && ( NULL != p_coeff->p_zero )))
+    if  (   ( NULL != p_iface )
+        &&  ( NULL != p_iface->pf_hndl ))
     {
-        // Allocate filter space
-        *p_filter_inst = malloc( sizeof( filter_iir_t ));
-
-        // Allocation succeed
-        if ( NULL != *p_filter_inst )
-        {
-            // Create ring buffers
-            buf_status  = ring_buffer_init( &(*p_filter_inst)->p_x, p_coeff->num_of_zero, &buf_attr );
-            buf_status |= ring_buffer_init( &(*p_filter_inst)->p_y, p_coeff->num_of_pole, &buf_attr );
-
-            // Allocate space for filter coefficients
-            (*p_filter_inst)->coeff.p_pole = malloc( p_coeff->num_of_pole * sizeof( float32_t ));
-            (*p_filter_inst)->coeff.p_zero = malloc( p_coeff->num_of_zero * sizeof( float32_t ));
-
-            // Check if ring buffer created
-            // and filter coefficient memory allocation succeed
-            if  (   ( eRING_BUFFER_OK == buf_status )
-                &&  ( NULL != (*p_filter_inst)->coeff.p_pole  )
-                &&  ( NULL != (*p_filter_inst)->coeff.p_zero  ))
-            {
-                // Get filter coefficient & order
-                memcpy( (*p_filter_inst)->coeff.p_pole, p_coeff->p_pole, p_coeff->num_of_pole * sizeof( float32_t ));
-                memcpy( (*p_filter_inst)->coeff.p_zero, p_coeff->p_zero, p_coeff->num_of_zero * sizeof( float32_t ));
-                (*p_filter_inst)->coeff.num_of_pole = p_coeff->num_of_pole;
-                (*p_filter_inst)->coeff.num_of_zero = p_coeff->num_of_zero;
-
-                // Fill buffers with zero
-                filter_buf_fill( (*p_filter_inst)->p_x, 0.0f );
-                filter_buf_fill( (*p_filter_inst)->p_y, 0.0f );
-
-                // Init success
-                (*p_filter_inst)->is_init = true;
-            }
-            else
-            {
-                status = eFILTER_ERROR;
-            }
-        }
-        else
-        {
-            status = eFILTER_ERROR;
-        }
+        status = filter_from_iface( p_filter_inst, p_iface, p_inst, true );
     }
     else
     {
@@ -1432,122 +10842,149 @@ filter_status_t filter_iir_init(p_filter_iir_t * p_filter_inst, const filter_iir
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Get initialization status of IIR filter
+*       Create generic filter from RC filter
+*
+* @note     RC filter must be initialized before!
+*
+* @param[in]    p_filter_inst   - Pointer to generic filter instance
+* @param[in]    rc_inst         - Initialized RC filter instance
+* @return       status          - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_from_rc(p_filter_t * p_filter_inst, p_filter_rc_t rc_inst)
+{
+    return filter_from_iface( p_filter_inst, &g_filter_rc_iface, (void*) rc_inst, (( NULL != rc_inst ) && ( true == rc_inst->is_init )));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Create generic filter from CR filter
+*
+* @note     CR filter must be initialized before!
+*
+* @param[in]    p_filter_inst   - Pointer to generic filter instance
+* @param[in]    cr_inst         - Initialized CR filter instance
+* @return       status          - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_from_cr(p_filter_t * p_filter_inst, p_filter_cr_t cr_inst)
+{
+    return filter_from_iface( p_filter_inst, &g_filter_cr_iface, (void*) cr_inst, (( NULL != cr_inst ) && ( true == cr_inst->is_init )));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Create generic filter from FIR filter
 *
-* @param[in]    filter_inst - IIR filter instance
-* @param[out]   p_is_init   - IIR filter init state
-* @return       status      - Status of operation
+* @note     FIR filter must be initialized before!
+*
+* @param[in]    p_filter_inst   - Pointer to generic filter instance
+* @param[in]    fir_inst        - Initialized FIR filter instance
+* @return       status          - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-filter_status_t filter_iir_is_init(p_filter_iir_t filter_inst, bool * const p_is_init)
+filter_status_t filter_from_fir(p_filter_t * p_filter_inst, p_filter_fir_t fir_inst)
 {
-    filter_status_t status = eFILTER_OK;
-
-    if  (   ( NULL != filter_inst )
-        &&  ( NULL != p_is_init ))
-    {
-        *p_is_init = filter_inst->is_init;
-    }
-    else
-    {
-        status = eFILTER_ERROR;
-    }
-
-    return status;
+    return filter_from_iface( p_filter_inst, &g_filter_fir_iface, (void*) fir_inst, (( NULL != fir_inst ) && ( true == fir_inst->is_init )));
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Handle IIR filter
-*
-* @note     This function must be called in equidistant time period defined by 1/fs,
-*           when zeros and poles are calculated!
+*       Create generic filter from IIR filter
 *
-* @note     In case that a[0] is zero, NAN is returned!
+* @note     IIR filter must be initialized before!
 *
-* @param[in]    filter_inst - IIR filter instance
-* @param[in]    in          - Input value
-* @param[out]   p_out       - Output (filtered) value
-* @return       status      - Status of operation
+* @param[in]    p_filter_inst   - Pointer to generic filter instance
+* @param[in]    iir_inst        - Initialized IIR filter instance
+* @return       status          - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-filter_status_t filter_iir_hndl(p_filter_iir_t filter_inst, const float32_t in, float32_t * const p_out)
+filter_status_t filter_from_iir(p_filter_t * p_filter_inst, p_filter_iir_t iir_inst)
 {
-    filter_status_t status  = eFILTER_OK;
-    float32_t       buf_val = 0.0f;
-
-    // Check for instance and success init
-    if ( NULL != filter_inst )
-    {
-        // Is instance init?
-        if ( true == filter_inst->is_init )
-        {
-            // Add new input to buffer
-            ring_buffer_add( filter_inst->p_x, (float32_t*) &in );
-
-            // Calculate filter value
-            for ( uint32_t i = 0; i < filter_inst->coeff.num_of_zero; i++ )
-            {
-                // Get sample
-                ring_buffer_get_by_index( filter_inst->p_x, (float32_t*) &buf_val, (( -i ) - 1 ));
-
-                // Sum zeros
-                *p_out += ( filter_inst->coeff.p_zero[i] * buf_val );
-            }
-
-            for ( uint32_t i = 1; i < filter_inst->coeff.num_of_pole; i++ )
-            {
-                // Get sample
-                ring_buffer_get_by_index( filter_inst->p_y, (float32_t*) &buf_val, -i );
+    return filter_from_iface( p_filter_inst, &g_filter_iir_iface, (void*) iir_inst, (( NULL != iir_inst ) && ( true == iir_inst->is_init )));
+}
 
-                // Subtract sum of poles
-                *p_out -= ( filter_inst->coeff.p_pole[i] * buf_val );
-            }
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Create generic filter from SOS filter
+*
+* @note     SOS filter must be initialized before!
+*
+* @param[in]    p_filter_inst   - Pointer to generic filter instance
+* @param[in]    sos_inst        - Initialized SOS filter instance
+* @return       status          - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_from_sos(p_filter_t * p_filter_inst, p_filter_sos_t sos_inst)
+{
+    return filter_from_iface( p_filter_inst, &g_filter_sos_iface, (void*) sos_inst, (( NULL != sos_inst ) && ( true == sos_inst->is_init )));
+}
 
-            // Check division by
-            if ( filter_inst->coeff.p_pole[0] == 0.0f )
-            {
-                *p_out = NAN;
-            }
-            else
-            {
-                *p_out = ( *p_out / filter_inst->coeff.p_pole[0] );
-            }
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Create generic filter from Boolean filter
+*
+* @note     Boolean filter must be initialized before!
+*
+* @param[in]    p_filter_inst   - Pointer to generic filter instance
+* @param[in]    bool_inst       - Initialized Boolean filter instance
+* @return       status          - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_from_bool(p_filter_t * p_filter_inst, p_filter_bool_t bool_inst)
+{
+    return filter_from_iface( p_filter_inst, &g_filter_bool_iface, (void*) bool_inst, (( NULL != bool_inst ) && ( true == bool_inst->is_init )));
+}
 
-            // Add new output to buffer
-            (void) ring_buffer_add( filter_inst->p_y, (float32_t*) p_out );
-        }
-    }
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Create generic filter from Band filter
+*
+* @note     Band filter must be initialized before!
+*
+* @param[in]    p_filter_inst   - Pointer to generic filter instance
+* @param[in]    band_inst       - Initialized Band filter instance
+* @return       status          - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_from_band(p_filter_t * p_filter_inst, p_filter_band_t band_inst)
+{
+    return filter_from_iface( p_filter_inst, &g_filter_band_iface, (void*) band_inst, (( NULL != band_inst ) && ( true == band_inst->is_init )));
+}
 
-    return status;
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Create generic filter from One-euro filter
+*
+* @note     One-euro filter must be initialized before!
+*
+* @param[in]    p_filter_inst   - Pointer to generic filter instance
+* @param[in]    euro_inst       - Initialized One-euro filter instance
+* @return       status          - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_from_euro(p_filter_t * p_filter_inst, p_filter_euro_t euro_inst)
+{
+    return filter_from_iface( p_filter_inst, &g_filter_euro_iface, (void*) euro_inst, (( NULL != euro_inst ) && ( true == euro_inst->is_init )));
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Reset IIR filter buffers
+*       Get initialization status of generic filter
 *
-* @param[in]    filter_inst - RC filter instance
-* @param[in]    rst_value   - Reset value
+* @param[in]    filter_inst - Generic filter instance
+* @param[out]   p_is_init   - Generic filter init state
 * @return       status      - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-filter_status_t filter_iir_reset(p_filter_iir_t filter_inst)
+filter_status_t filter_is_init(p_filter_t filter_inst, bool * const p_is_init)
 {
-    filter_status_t status  = eFILTER_OK;
+    filter_status_t status = eFILTER_OK;
 
-    if ( NULL != filter_inst )
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_is_init ))
     {
-        // Is instance init?
-        if ( true == filter_inst->is_init )
-        {
-            // Fill buffers with zero
-            filter_buf_fill( filter_inst->p_x, 0.0f );
-            filter_buf_fill( filter_inst->p_y, 0.0f );
-        }
-        else
-        {
-            status = eFILTER_ERROR;
-        }
+        *p_is_init = filter_inst->is_init;
     }
     else
     {
@@ -1559,29 +10996,25 @@ filter_status_t filter_iir_reset(p_filter_iir_t filter_inst)
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Set coefficient of IIR filter on-the-fly
-*
-* @note     It is recommended to reset filter afterwards!
-*
-* @note     Make sure to provide filter order size of coefficients!
+*       Handle generic filter
 *
-* @param[in]    filter_inst - FIR filter instance
-* @param[in]    p_coeff     - New IIR filter coefficients
+* @param[in]    filter_inst - Generic filter instance
+* @param[in]    in          - Input value
+* @param[out]   p_out       - Output (filtered) value
 * @return       status      - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-filter_status_t filter_iir_coeff_set(p_filter_iir_t filter_inst, const filter_iir_coeff_t * const p_coeff)
+filter_status_t filter_hndl(p_filter_t filter_inst, const float32_t in, float32_t * const p_out)
 {
-    filter_status_t status  = eFILTER_OK;
+    filter_status_t status = eFILTER_OK;
 
     if  (   ( NULL != filter_inst )
-        &&  ( NULL != p_coeff ))
+        &&  ( NULL != p_out ))
     {
         // Is instance init?
         if ( true == filter_inst->is_init )
         {
-            memcpy( filter_inst->coeff.p_pole, p_coeff->p_pole, ( filter_inst->coeff.num_of_pole * sizeof(float32_t)));
-            memcpy( filter_inst->coeff.p_zero, p_coeff->p_zero, ( filter_inst->coeff.num_of_zero * sizeof(float32_t)));
+            status = filter_inst->p_iface->pf_hndl( filter_inst->p_inst, in, p_out );
         }
         else
         {
@@ -1598,28 +11031,42 @@ filter_status_t filter_iir_coeff_set(p_filter_iir_t filter_inst, const filter_ii
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*   Get IIR filter coefficients
+*       Handle generic filter for block of samples
 *
-* @note This functions copy coefficients into place pointing by p_zero
-*       and p_pole parameter
+* @note     Prefer this function over "filter_hndl()" as interface is
+*           dispatched once per block instead of once per sample.
 *
-* @param[in]    filter_inst - Pointer to FIR filter instance
-* @param[out]   p_zero      - Pointer to read zero coefficient
-* @param[out]   p_pole      - Pointer to read pole coefficient
+* @note     Input and output buffer can be the same (in-place processing).
+*
+* @param[in]    filter_inst - Generic filter instance
+* @param[in]    p_in        - Input samples
+* @param[out]   p_out       - Output (filtered) samples
+* @param[in]    size        - Number of samples
 * @return       status      - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-filter_status_t filter_iir_coeff_get(p_filter_iir_t filter_inst, filter_iir_coeff_t ** const pp_coeff)
+filter_status_t filter_hndl_block(p_filter_t filter_inst, const float32_t * const p_in, float32_t * const p_out, const uint32_t size)
 {
     filter_status_t status = eFILTER_OK;
 
     if  (   ( NULL != filter_inst )
-        &&  ( NULL != pp_coeff ))
+        &&  ( NULL != p_in )
+        &&  ( NULL != p_out ))
     {
         // Is instance init?
         if ( true == filter_inst->is_init )
         {
-            *pp_coeff = &filter_inst->coeff;
+            if ( NULL != filter_inst->p_iface->pf_block )
+            {
+                status = filter_inst->p_iface->pf_block( filter_inst->p_inst, p_in, p_out, size );
+            }
+            else
+            {
+                for ( uint32_t i = 0U; i < size; i++ )
+                {
+                    status |= filter_inst->p_iface->pf_hndl( filter_inst->p_inst, p_in[i], &p_out[i] );
+                }
+            }
         }
         else
         {
@@ -1636,44 +11083,27 @@ filter_status_t filter_iir_coeff_get(p_filter_iir_t filter_inst, filter_iir_coef
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*   Calculate IIR 2nd order low pass filter coefficients
-*
-* @note      Equations taken from: https://webaudio.github.io/Audio-EQ-Cookbook/audio-eq-cookbook.html
+*       Reset generic filter
 *
-* @note      Additional check is made if sampling theorem is fulfilled.
+* @note     Filters with reset value (RC, FIR, one-euro) are reset to 0.
 *
-* @param[in]    fc      - Cutoff frequency
-* @param[in]    zeta    - Damping factor
-* @param[in]    fs      - Sampling frequency
-* @param[out]   p_pole  - Pointer to newly calculated IIR poles
-* @param[out]   p_zero  - Pointer to newly calculated IIR zeros
-* @return       status  - Status of operation
+* @param[in]    filter_inst - Generic filter instance
+* @return       status      - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-filter_status_t filter_iir_coeff_calc_2nd_lpf(const float32_t fc, const float32_t zeta, const float32_t fs, float32_t * const p_pole, float32_t * const p_zero)
+filter_status_t filter_reset(p_filter_t filter_inst)
 {
-    filter_status_t status      = eFILTER_OK;
-    float32_t       omega       = 0.0f;
-    float32_t       cos_omega   = 0.0f;
-    float32_t       alpha       = 0.0f;
+    filter_status_t status = eFILTER_OK;
 
-    if  (   ( NULL != p_pole )
-        &&  ( NULL != p_zero ))
+    if ( NULL != filter_inst )
     {
-        // Check Nyquist/Shannon sampling theorem
-        if ( fc < ( fs / 2.0f ))
+        // Is instance init?
+        if ( true == filter_inst->is_init )
         {
-            omega = ( 2.0f * ( M_PI * ( fc / fs )));
-            alpha = ( sinf( omega ) * zeta );
-            cos_omega = cosf( omega );
-
-            // Calculate zeros & poles
-            p_zero[0] = (( 1.0f - cos_omega ) / 2.0f );
-            p_zero[1] = ( 1.0f - cos_omega );
-            p_zero[2] = (( 1.0f - cos_omega ) / 2.0f );
-            p_pole[0] = ( 1.0f + alpha );
-            p_pole[1] = ( -2.0f * cos_omega );
-            p_pole[2] = ( 1.0f - alpha );
+            if ( NULL != filter_inst->p_iface->pf_reset )
+            {
+                status = filter_inst->p_iface->pf_reset( filter_inst->p_inst );
+            }
         }
         else
         {
@@ -1690,44 +11120,32 @@ filter_status_t filter_iir_coeff_calc_2nd_lpf(const float32_t fc, const float32_
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*   Calculate IIR 2nd order high pass filter coefficients
-*
-* @note     Equations taken from: https://webaudio.github.io/Audio-EQ-Cookbook/audio-eq-cookbook.html
+*       Get generic filter state size
 *
-* @note     Additional check is made if sampling theorem is fulfilled.
+* @note     State size is size of filter data (including delay lines) in
+*           bytes. It is 0 if interface does not provide it.
 *
-* @param[in]    fc      - Cutoff frequency
-* @param[in]    zeta    - Damping factor
-* @param[in]    fs      - Sampling frequency
-* @param[out]   p_pole  - Pointer to newly calculated IIR poles
-* @param[out]   p_zero  - Pointer to newly calculated IIR zeros
-* @return       status  - Status of operation
+* @param[in]    filter_inst - Generic filter instance
+* @param[out]   p_size      - Size of filter state in bytes
+* @return       status      - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-filter_status_t filter_iir_coeff_calc_2nd_hpf(const float32_t fc, const float32_t zeta, const float32_t fs, float32_t * const p_pole, float32_t * const p_zero)
+filter_status_t filter_state_size_get(p_filter_t filter_inst, uint32_t * const p_size)
 {
-    filter_status_t status      = eFILTER_OK;
-    float32_t       omega       = 0.0f;
-    float32_t       cos_omega   = 0.0f;
-    float32_t       alpha       = 0.0f;
+    filter_status_t status = eFILTER_OK;
 
-    if  (   ( NULL != p_pole )
-        &&  ( NULL != p_zero ))
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_size ))
     {
-        // Check Nyquist/Shannon sampling theorem
-        if ( fc < ( fs / 2.0f ))
+        // Is instance init?
+        if ( true == filter_inst->is_init )
         {
-            omega = ( 2.0f * ( M_PI * ( fc / fs )));
-            alpha = ( sinf( omega ) * zeta );
-            cos_omega = cosf( omega );
+            *p_size = 0U;
 
-            // Calculate zeros & poles
-            p_zero[0] = (( 1.0f + cos_omega ) / 2.0f );
-            p_zero[1] = -( 1.0f + cos_omega );
-            p_zero[2] = (( 1.0f + cos_omega ) / 2.0f );
-            p_pole[0] = ( 1.0f + alpha );
-            p_pole[1] = ( -2.0f * cos_omega );
-            p_pole[2] = ( 1.0f - alpha );
+            if ( NULL != filter_inst->p_iface->pf_state_size )
+            {
+                *p_size = filter_inst->p_iface->pf_state_size( filter_inst->p_inst );
+            }
         }
         else
         {
@@ -1741,49 +11159,35 @@ filter_status_t filter_iir_coeff_calc_2nd_hpf(const float32_t fc, const float32_
 
     return status;
 }
-
-////////////////////////////////////////////////////////////////////////////////
-/**
-*   Calculate IIR 2nd order notch (band stop) filter coefficients
-*
-* @note     Equations taken from: https://webaudio.github.io/Audio-EQ-Cookbook/audio-eq-cookbook.html
-*
-* @note     Additional check is made if sampling theorem is fulfilled.
-*
-* @note     Value of r must be within 0.0 and 1.0, typically it is around
-*            0.80 - 0.99.
-*
-* @param[in]    fc      - Cutoff frequency
-* @param[in]    r       - Bandwidth of filter
-* @param[in]    fs      - Sampling frequency
-* @param[out]   p_pole  - Pointer to newly calculated IIR poles
-* @param[out]   p_zero  - Pointer to newly calculated IIR zeros
-* @return       status  - Status of operation
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get generic filter sampling frequency
+*
+* @note     Sampling frequency is 0 if interface does not provide it (e.g.
+*           FIR and IIR filters are not aware of sampling frequency).
+*
+* @param[in]    filter_inst - Generic filter instance
+* @param[out]   p_fs        - Filter sampling frequency in Hz
+* @return       status      - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-filter_status_t filter_iir_coeff_calc_2nd_bpf(const float32_t fc, const float32_t r, const float32_t fs, float32_t * const p_pole, float32_t * const p_zero)
+filter_status_t filter_fs_get(p_filter_t filter_inst, float32_t * const p_fs)
 {
-    filter_status_t status      = eFILTER_OK;
-    float32_t       omega       = 0.0f;
-    float32_t       cos_omega   = 0.0f;
+    filter_status_t status = eFILTER_OK;
 
-    if  (   ( NULL != p_pole )
-        &&  ( NULL != p_zero )
-        &&  (( r > 0.0f ) && ( r < 1.0f )))
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_fs ))
     {
-        // Check Nyquist/Shannon sampling theorem
-        if ( fc < ( fs / 2.0f ))
+        // Is instance init?
+        if ( true == filter_inst->is_init )
         {
-            omega = ( 2.0f * ( M_PI * ( fc / fs )));
-            cos_omega = cosf( omega );
+            *p_fs = 0.0f;
 
-            // Calculate zeros & poles
-            p_zero[0] = 1.0f;
-            p_zero[1] = ( -2.0f  * cos_omega );
-            p_zero[2] = 1.0f;
-            p_pole[0] = 1.0f;
-            p_pole[1] = ( -2.0f * ( r * cos_omega ));
-            p_pole[2] = ( r * r );
+            if ( NULL != filter_inst->p_iface->pf_fs_get )
+            {
+                *p_fs = filter_inst->p_iface->pf_fs_get( filter_inst->p_inst );
+            }
         }
         else
         {
@@ -1800,167 +11204,222 @@ filter_status_t filter_iir_coeff_calc_2nd_bpf(const float32_t fc, const float32_
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*   Calculate gain at DC frequency of LPF IIR filter based on it's poles & zeros
-*
-* @note     Equations taken from book:
+*   Initialize filter pipeline
 *
-*        "The Scientist and Engineer's Guide to Digital Signal Processing",
+* @brief    Pipeline chains generic filters, output of one stage is input
+*           of next one. Samples are processed block by block in tiles of
+*           FILTER_PIPE_TILE_SIZE samples, passing tile through all stages
+*           via two scratch buffers, so intermediate data stays in L1 cache.
 *
-*        G = 1/a0 * (( b0 + b1 + ... + bn ) / ( 1 + (( a1 + a2 + ... + an+1 ) / a0 ))),
+* @note     Adjacent 1st order CR and up to 2nd order IIR stages are fused
+*           into single loop.
 *
-*        where:  a - poles
-*                b - zeros
+* @note     Stages are referenced, not copied. Stage can be used in only
+*           one pipeline.
 *
-* @param[in]    p_coeff - IIR filter coefficients
-* @return       dc_gain - Gain of filter at zero (DC) frequency
+* @param[in]    p_pipe_inst     - Pointer to filter pipeline instance
+* @param[in]    p_stage         - List of initialized generic filters
+* @param[in]    num_of_stages   - Number of stages
+* @return       status          - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-float32_t filter_iir_calc_lpf_gain(const filter_iir_coeff_t * const p_coeff)
+filter_status_t filter_pipe_init(p_filter_pipe_t * p_pipe_inst, const p_filter_t * const p_stage, const uint32_t num_of_stages)
 {
-    float32_t dc_gain     = NAN;
-    float32_t pole_sum     = 0.0f;
-    float32_t zero_sum     = 0.0f;
+    filter_status_t status = eFILTER_OK;
 
-    if ( NULL != p_coeff )
+    if  (   ( NULL != p_pipe_inst )
+        &&  ( NULL != p_stage )
+        &&  ( num_of_stages > 0UL ))
     {
-        // Sum poles & zeros
-        for( uint32_t i = 1; i < p_coeff->num_of_pole; i++ )
+        // All stages must be valid
+        for ( uint32_t i = 0U; i < num_of_stages; i++ )
         {
-            pole_sum += p_coeff->p_pole[i];
+            if  (   ( NULL == p_stage[i] )
+                ||  ( false == p_stage[i]->is_init ))
+            {
+                status = eFILTER_ERROR;
+            }
         }
 
-        for( uint32_t i = 0; i < p_coeff->num_of_zero; i++ )
+        if ( eFILTER_OK == status )
         {
-            zero_sum += p_coeff->p_zero[i];
-        }
+            // Allocate space
+            *p_pipe_inst = malloc( sizeof( filter_pipe_t ));
 
-        // Calculate gain at 0 frequency
-        if ( p_coeff->p_pole[0] != 0.0f )
-        {
-            pole_sum = (( pole_sum / p_coeff->p_pole[0] ) + 1.0f );
+            if ( NULL != *p_pipe_inst )
+            {
+                (*p_pipe_inst)->p_stage = malloc( num_of_stages * sizeof( p_filter_t ));
+                (*p_pipe_inst)->p_tile  = malloc( 2U * FILTER_PIPE_TILE_SIZE * sizeof( float32_t ));
+                (*p_pipe_inst)->is_init = false;
+            }
 
-            if ( pole_sum != 0.0f )
+            // Check if allocation succeed
+            if  (   ( NULL != *p_pipe_inst )
+                &&  ( NULL != (*p_pipe_inst)->p_stage )
+                &&  ( NULL != (*p_pipe_inst)->p_tile ))
             {
-                dc_gain = (( zero_sum / pole_sum ) / p_coeff->p_pole[0] );
+                memcpy( (*p_pipe_inst)->p_stage, p_stage, num_of_stages * sizeof( p_filter_t ));
+                (*p_pipe_inst)->num_of_stages = num_of_stages;
+
+                // Init success
+                (*p_pipe_inst)->is_init = true;
+            }
+            else
+            {
+                status = eFILTER_ERROR;
             }
         }
     }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
 
-    return dc_gain;
+    return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*   Calculate gain @0.5 normalize frequency (w=fc/fs) of HPF IIR
-*   filter based on it's poles & zeros
-*
-* @note Normalize frequency of 0.5 is the highest cutoff frequency for HPF
-*         filter that don't break Nyquist/Shannon sampling theorem.
-*
-* @note Equations taken from book:
+*       Get initialization status of filter pipeline
 *
-*        "The Scientist and Engineer's Guide to Digital Signal Processing"
-*
-*
-*        G = 1/a0 * (( b0 - b1 + b2 - b3 +... + bn ) / ( 1 + (( a1 - a2 + a3 - a4 + ... + an+1 ) / a0 )))
+* @param[in]    pipe_inst   - Filter pipeline instance
+* @param[out]   p_is_init   - Filter pipeline init state
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_pipe_is_init(p_filter_pipe_t pipe_inst, bool * const p_is_init)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != pipe_inst )
+        &&  ( NULL != p_is_init ))
+    {
+        *p_is_init = pipe_inst->is_init;
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Handle filter pipeline for block of samples
 *
-*        where:  a - poles
-*                b - zeros
+* @note     Input and output buffer can be the same (in-place processing).
 *
-* @param[in]     p_pole     - Pointer to IIR poles
-* @param[in]     p_zero     - Pointer to IIR zeros
-* @param[in]     pole_size  - Number of poles
-* @param[in]     zero_size  - Number of zeros
-* @return        dc_gain    - Gain of filter at 0.5 normalized frequency (Nyquist freq)
+* @param[in]    pipe_inst   - Filter pipeline instance
+* @param[in]    p_in        - Input samples
+* @param[out]   p_out       - Output (filtered) samples
+* @param[in]    size        - Number of samples
+* @return       status      - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-float32_t filter_iir_calc_hpf_gain(const filter_iir_coeff_t * const p_coeff)
+filter_status_t filter_pipe_hndl_block(p_filter_pipe_t pipe_inst, const float32_t * const p_in, float32_t * const p_out, const uint32_t size)
 {
-    float32_t dc_gain   = NAN;
-    float32_t pole_sum  = 0.0f;
-    float32_t zero_sum  = 0.0f;
+    filter_status_t status = eFILTER_OK;
 
-    if ( NULL != p_coeff)
+    if  (   ( NULL != pipe_inst )
+        &&  ( NULL != p_in )
+        &&  ( NULL != p_out ))
     {
-        // Sum poles
-        for( uint32_t i = 1; i < p_coeff->num_of_pole; i++ )
+        // Is instance init?
+        if ( true == pipe_inst->is_init )
         {
-            if ( i & 0x01U )
-            {
-                pole_sum -= p_coeff->p_pole[i];
-            }
-            else
+            for ( uint32_t ofs = 0U; ofs < size; ofs += FILTER_PIPE_TILE_SIZE )
             {
-                pole_sum += p_coeff->p_pole[i];
-            }
-        }
+                const uint32_t      tile    = ((( size - ofs ) < FILTER_PIPE_TILE_SIZE ) ? ( size - ofs ) : FILTER_PIPE_TILE_SIZE );
+                const float32_t   * p_src   = &p_in[ofs];
+                uint32_t            ping    = 0U;
+                uint32_t            k       = 0U;
 
-        // Sum zeros
-        for( uint32_t i = 0; i < p_coeff->num_of_zero; i++ )
-        {
-            if ( i & 0x01U )
-            {
-                zero_sum -= p_coeff->p_zero[i];
-            }
-            else
-            {
-                zero_sum += p_coeff->p_zero[i];
+                while ( k < pipe_inst->num_of_stages )
+                {
+                    const bool      fuse    = ((( k + 1U ) < pipe_inst->num_of_stages ) && filter_pipe_can_fuse( pipe_inst->p_stage[k], pipe_inst->p_stage[k + 1U] ));
+                    const uint32_t  next    = ( k + (( true == fuse ) ? 2U : 1U ));
+                    float32_t     * p_dst   = &pipe_inst->p_tile[ ping * FILTER_PIPE_TILE_SIZE ];
+
+                    // Last stage writes directly to output
+                    if ( next >= pipe_inst->num_of_stages )
+                    {
+                        p_dst = &p_out[ofs];
+                    }
+
+                    if ( true == fuse )
+                    {
+                        // Fused kernel reads parameters directly
+                        filter_cr_param_apply((filter_cr_t*) pipe_inst->p_stage[k]->p_inst );
+                        filter_iir_param_apply((filter_iir_t*) pipe_inst->p_stage[k + 1U]->p_inst );
+
+                        filter_pipe_cr_iir_fused((filter_cr_t*) pipe_inst->p_stage[k]->p_inst, (filter_iir_t*) pipe_inst->p_stage[k + 1U]->p_inst, p_src, p_dst, tile );
+                    }
+                    else
+                    {
+                        status |= filter_hndl_block( pipe_inst->p_stage[k], p_src, p_dst, tile );
+                    }
+
+                    p_src   = p_dst;
+                    ping    ^= 1U;
+                    k       = next;
+                }
             }
         }
-
-        // Calculate gain at Nyquist frequency
-        if ( p_coeff->p_pole[0] != 0.0f )
+        else
         {
-            pole_sum = (( pole_sum / p_coeff->p_pole[0] ) + 1.0f );
-
-            if ( pole_sum != 0.0f )
-            {
-                dc_gain = (( zero_sum / pole_sum ) / p_coeff->p_pole[0] );
-            }
+            status = eFILTER_ERROR;
         }
     }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
 
-    return dc_gain;
+    return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*   Normalize zeros of IIR filter in order to get unity gain at DC frequency
-*
-* @note     Implementation taken from book:
-*
-*           "The Scientist and Engineer's Guide to Digital Signal Processing"
-*
-*       If requirement is to have a gain of 1 at DC frequency then simply
-*       call this function across already calculated coefficients. This newly
-*       calculated coefficients will result in unity gain filter.
+*       Handle filter pipeline for single sample
 *
-* @note     This techniques simply calculated DC gain (G) and then divide all
-*           zeros of IIR filter with it. Thus only zeros are affected by
-*           this function math.
+* @param[in]    pipe_inst   - Filter pipeline instance
+* @param[in]    in          - Input value
+* @param[out]   p_out       - Output (filtered) value
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_pipe_hndl(p_filter_pipe_t pipe_inst, const float32_t in, float32_t * const p_out)
+{
+    return filter_pipe_hndl_block( pipe_inst, &in, p_out, 1U );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Reset all filter pipeline stages
 *
-* @param[in]    p_coeff - IIR filter coefficients
-* @return       status  - Status of operation
+* @param[in]    pipe_inst   - Filter pipeline instance
+* @return       status      - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-filter_status_t filter_iir_coeff_to_unity_gain_lpf(filter_iir_coeff_t * const p_coeff)
+filter_status_t filter_pipe_reset(p_filter_pipe_t pipe_inst)
 {
     filter_status_t status = eFILTER_OK;
 
-    if ( NULL != p_coeff )
+    if ( NULL != pipe_inst )
     {
-        // Calculate DC gain
-        const float32_t dc_gain = filter_iir_calc_lpf_gain( p_coeff );
-
-        // Check gain
-        if ( dc_gain > 0.0f )
+        // Is instance init?
+        if ( true == pipe_inst->is_init )
         {
-            // Normalize zeros
-            for ( uint32_t i = 0; i < p_coeff->num_of_zero; i++ )
+            for ( uint32_t k = 0U; k < pipe_inst->num_of_stages; k++ )
             {
-                p_coeff->p_zero[i] = ( p_coeff->p_zero[i] / dc_gain );
+                status |= filter_reset( pipe_inst->p_stage[k] );
             }
         }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
     }
     else
     {
@@ -1972,41 +11431,191 @@ filter_status_t filter_iir_coeff_to_unity_gain_lpf(filter_iir_coeff_t * const p_
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*   Normalize zeros of IIR filter in order to get unity gain at
-*   0.5 normalized frequency
+*   Fuse cascade of LTI filters into SOS filter
 *
-* @note Implementation taken from book:
+* @brief    Zeros and poles of all stages are gathered, coincident zero and
+*           pole pairs are cancelled and the rest is factored into real 1st
+*           and 2nd order sections (biquads). Each pole (complex pair)
+*           takes nearest zeros into same section. Supported stages are RC,
+*           CR, band, FIR, IIR and SOS filters (generic filters created by
+*           "filter_from_xxx()").
 *
-*        "The Scientist and Engineer's Guide to Digital Signal Processing"
+* @note     Fusion is refused (error) when fused filter is not cheaper than
+*           stages: it must not need more operations nor more states and
+*           must save at least one of them. It is also refused when stage
+*           polynomial can not be factored (e.g. leading zero coefficient -
+*           pure delay) or when response of fused filter deviates from
+*           cascade by more than FILTER_FUSE_RESP_TOL relative.
 *
-*    If requirement is to have a gain of 1 at DC frequency then simply
-*    call this function across already calculated coefficients. This newly
-*    calculated coefficients will result in unity gain filter.
+* @note     Report is filled whenever stages are valid LTI filters, also
+*           when fusion is refused. Fused cost is 0 when cascade can not be
+*           factored.
 *
-* @note     This techniques simply calculated DC gain (G) and then divide all
-*           zeros of IIR filter with it. Thus only zeros are affected by
-*           this function math.
+* @note     Fused filter starts with zeroed states. Stages are not modified.
 *
-* @param[in]    p_coeff - IIR filter coefficients
-* @return       status  - Status of operation
+* @param[in]    p_filter_inst   - Pointer to fused SOS filter instance
+* @param[in]    p_stage         - List of LTI generic filters, in cascade order
+* @param[in]    num_of_stages   - Number of stages
+* @param[out]   p_report        - Operation count before/after fusion (can be NULL)
+* @return       status          - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-filter_status_t filter_iir_coeff_to_unity_gain_hpf(filter_iir_coeff_t * const p_coeff)
+filter_status_t filter_fuse_to_sos(p_filter_sos_t * p_filter_inst, const p_filter_t * const p_stage, const uint32_t num_of_stages, filter_fuse_report_t * const p_report)
 {
-    filter_status_t status = eFILTER_OK;
+    filter_status_t         status      = eFILTER_OK;
+    filter_fuse_report_t    report      = { 0U };
+    filter_fuse_zpk_t       zpk         = { .gain = 1.0, .is_valid = true };
+    uint32_t                num_deg     = 0U;
+    uint32_t                den_deg     = 0U;
+    uint32_t                len_max     = 1U;
+    uint32_t                num_of_zu   = 0U;
+    uint32_t                num_of_pu   = 0U;
+    uint32_t                num_of_sect = 0U;
+    filter_fuse_unit_t    * p_zu        = NULL;
+    filter_fuse_unit_t    * p_pu        = NULL;
+    filter_fuse_sect_t    * p_sect      = NULL;
+    filter_sos_coeff_t    * p_coeff     = NULL;
 
-    if ( NULL != p_coeff )
+    if  (   ( NULL != p_filter_inst )
+        &&  ( NULL != p_stage )
+        &&  ( num_of_stages > 0UL ))
     {
-        // Calculate DC gain
-        const float32_t dc_gain = filter_iir_calc_hpf_gain( p_coeff );
+        // Check stages and get size of fused filter
+        for ( uint32_t k = 0U; ( k < num_of_stages ) && ( eFILTER_OK == status ); k++ )
+        {
+            uint32_t stage_num  = 0U;
+            uint32_t stage_den  = 0U;
+            uint32_t ops        = 0U;
+            uint32_t states     = 0U;
 
-        // Check gain
-        if ( dc_gain > 0.0f )
+            if  (   ( NULL != p_stage[k] )
+                &&  ( true == p_stage[k]->is_init ))
+            {
+                status = filter_fuse_stage_info( p_stage[k], &stage_num, &stage_den, &ops, &states );
+
+                num_deg                 += stage_num;
+                den_deg                 += stage_den;
+                len_max                  = FILTER_MAX_OF( len_max, ( FILTER_MAX_OF( stage_num, stage_den ) + 1U ));
+                report.ops_before       += ops;
+                report.states_before    += states;
+            }
+            else
+            {
+                status = eFILTER_ERROR;
+            }
+        }
+
+        if ( eFILTER_OK == status )
         {
-            // Normalize zeros
-            for ( uint32_t i = 0; i < p_coeff->num_of_zero; i++ )
+            // Temporary space, one item more for empty cascades
+            zpk.p_zero  = malloc(( num_deg + 1U ) * sizeof( filter_fuse_cplx_t ));
+            zpk.p_pole  = malloc(( den_deg + 1U ) * sizeof( filter_fuse_cplx_t ));
+            zpk.p_poly  = malloc(( len_max + 2U ) * sizeof( double ));
+            zpk.p_q     = malloc(( len_max + 2U ) * sizeof( double ));
+            zpk.p_taken = malloc(( FILTER_MAX_OF( num_deg, den_deg ) + 1U ) * sizeof( bool ));
+            p_zu        = malloc(( num_deg + 1U ) * sizeof( filter_fuse_unit_t ));
+            p_pu        = malloc(( den_deg + 1U ) * sizeof( filter_fuse_unit_t ));
+            p_sect      = malloc(( num_deg + den_deg + 1U ) * sizeof( filter_fuse_sect_t ));
+            p_coeff     = malloc(( num_deg + den_deg + 1U ) * sizeof( filter_sos_coeff_t ));
+
+            if  (   ( NULL != zpk.p_zero )
+                &&  ( NULL != zpk.p_pole )
+                &&  ( NULL != zpk.p_poly )
+                &&  ( NULL != zpk.p_q )
+                &&  ( NULL != zpk.p_taken )
+                &&  ( NULL != p_zu )
+                &&  ( NULL != p_pu )
+                &&  ( NULL != p_sect )
+                &&  ( NULL != p_coeff ))
             {
-                p_coeff->p_zero[i] = ( p_coeff->p_zero[i] / dc_gain );
+                for ( uint32_t k = 0U; k < FILTER_FUSE_NUM_OF_FREQ; k++ )
+                {
+                    zpk.h_ref[k].re = 1.0;
+                    zpk.h_ref[k].im = 0.0;
+                }
+
+                // Gather zeros, poles and gain of cascade
+                for ( uint32_t k = 0U; k < num_of_stages; k++ )
+                {
+                    filter_fuse_stage_zpk( p_stage[k], &zpk );
+                }
+
+                filter_fuse_zpk_cancel( &zpk );
+
+                // Factor into sections
+                if  (   ( true == zpk.is_valid )
+                    &&  ( true == filter_fuse_units( zpk.p_zero, zpk.num_of_zero, zpk.p_taken, p_zu, &num_of_zu ))
+                    &&  ( true == filter_fuse_units( zpk.p_pole, zpk.num_of_pole, zpk.p_taken, p_pu, &num_of_pu )))
+                {
+                    num_of_sect = filter_fuse_sect_build( p_zu, num_of_zu, p_pu, num_of_pu, p_sect );
+
+                    for ( uint32_t s = 0U; s < num_of_sect; s++ )
+                    {
+                        p_coeff[s].b[0] = 1.0f;
+                        p_coeff[s].b[1] = (float32_t) p_sect[s].b[0];
+                        p_coeff[s].b[2] = (float32_t) p_sect[s].b[1];
+                        p_coeff[s].a[0] = 1.0f;
+                        p_coeff[s].a[1] = (float32_t) p_sect[s].a[0];
+                        p_coeff[s].a[2] = (float32_t) p_sect[s].a[1];
+                    }
+
+                    // Pure gain
+                    if ( 0U == num_of_sect )
+                    {
+                        p_coeff[0].b[0] = 1.0f;
+                        p_coeff[0].b[1] = 0.0f;
+                        p_coeff[0].b[2] = 0.0f;
+                        p_coeff[0].a[0] = 1.0f;
+                        p_coeff[0].a[1] = 0.0f;
+                        p_coeff[0].a[2] = 0.0f;
+                        num_of_sect     = 1U;
+                    }
+
+                    // Gain into numerator of first section
+                    for ( uint32_t i = 0U; i < 3U; i++ )
+                    {
+                        p_coeff[0].b[i] = (float32_t) ( zpk.gain * (double) p_coeff[0].b[i] );
+                    }
+
+                    filter_sos_coeff_cost( p_coeff, num_of_sect, &report.ops_after, &report.states_after );
+
+                    // Fuse only if cheaper and response matches
+                    if  (   ( report.ops_after <= report.ops_before )
+                        &&  ( report.states_after <= report.states_before )
+                        &&  (   ( report.ops_after < report.ops_before )
+                            ||  ( report.states_after < report.states_before ))
+                        &&  ( true == filter_fuse_resp_check( &zpk, p_coeff, num_of_sect )))
+                    {
+                        status = filter_sos_init( p_filter_inst, p_coeff, num_of_sect );
+                    }
+                    else
+                    {
+                        status = eFILTER_ERROR;
+                    }
+                }
+                else
+                {
+                    status = eFILTER_ERROR;
+                }
+            }
+            else
+            {
+                status = eFILTER_ERROR;
+            }
+
+            free( zpk.p_zero );
+            free( zpk.p_pole );
+            free( zpk.p_poly );
+            free( zpk.p_q );
+            free( zpk.p_taken );
+            free( p_zu );
+            free( p_pu );
+            free( p_sect );
+            free( p_coeff );
+
+            if ( NULL != p_report )
+            {
+                *p_report = report;
             }
         }
     }
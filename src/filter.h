@@ -6,8 +6,8 @@
 *@file      filter.h
 *@brief     Various filter designs
 *@author    Ziga Miklosic
-*@date      26.10.2023
-*@version   V2.0.0
+*@date      17.10.2026
+*@version   V2.1.0
 */
 ////////////////////////////////////////////////////////////////////////////////
 /**
@@ -34,9 +34,22 @@
  *     Module version
  */
 #define FILTER_VER_MAJOR        ( 2 )
-#define FILTER_VER_MINOR        ( 0 )
+#define FILTER_VER_MINOR        ( 1 )
 #define FILTER_VER_DEVELOP      ( 0 )
 
+/**
+ *     Concurrency safe parameter setters and getters ("_atomic" and
+ *     "_deferred" suffix) enable
+ *
+ * @note    Uses C11 <stdatomic.h>. When disabled, handlers contain no
+ *          atomic operations and parameters can be changed only from
+ *          sample path thread. Enable by compiler flag
+ *          -DFILTER_CFG_ATOMIC_EN=1.
+ */
+#ifndef FILTER_CFG_ATOMIC_EN
+    #define FILTER_CFG_ATOMIC_EN    ( 0 )
+#endif
+
 /**
  *     Filter status
  */
@@ -66,11 +79,65 @@ typedef struct filter_fir_s * p_filter_fir_t;
  */
 typedef struct filter_iir_s * p_filter_iir_t;
 
+/**
+ *     SOS (cascade of 1st/2nd order sections) filter instance type
+ */
+typedef struct filter_sos_s * p_filter_sos_t;
+
 /**
  *     Boolean filter instance type
  */
 typedef struct filter_bool_s * p_filter_bool_t;
 
+/**
+ *     Integer boolean filter instance type
+ */
+typedef struct filter_bool_cnt_s * p_filter_bool_cnt_t;
+
+/**
+ *     Boolean filter bank instance type
+ *
+ *     Bank approximates Boolean filter with power of two alpha: debounce
+ *     time on step input is same, noise rejection is not (see
+ *     "filter_bool_bank_init()").
+ */
+typedef struct filter_bool_bank_s * p_filter_bool_bank_t;
+
+/**
+ *     RC filter bank instance type
+ */
+typedef struct filter_rc_bank_s * p_filter_rc_bank_t;
+
+/**
+ *     CR filter bank instance type
+ */
+typedef struct filter_cr_bank_s * p_filter_cr_bank_t;
+
+/**
+ *     Band (CR + RC) filter instance type
+ */
+typedef struct filter_band_s * p_filter_band_t;
+
+/**
+ *     Integer DC blocker instance type
+ */
+typedef struct filter_dcb_s * p_filter_dcb_t;
+
+/**
+ *     Integer DC blocker bank instance type
+ */
+typedef struct filter_dcb_bank_s * p_filter_dcb_bank_t;
+
+/**
+ *     One-euro (adaptive cutoff RC) filter instance type
+ */
+typedef struct filter_euro_s * p_filter_euro_t;
+
+/**
+ *     One-euro (adaptive cutoff RC) filter bank instance type
+ */
+typedef struct filter_euro_bank_s * p_filter_euro_bank_t;
+
 /**
  *  32-bit floating data type definition
  */
@@ -87,6 +154,65 @@ typedef struct
     uint32_t    num_of_zero;    /**<Number of zeros */
 } filter_iir_coeff_t;
 
+/**
+ *  SOS section coefficients
+ *
+ * @note    Section is H(z) = ( b0 + b1*z^-1 + b2*z^-2 ) / ( a0 + a1*z^-1 + a2*z^-2 ),
+ *          1st order section has b2 = a2 = 0.
+ */
+typedef struct
+{
+    float32_t   b[3];   /**<Numerator coefficients b0, b1, b2 */
+    float32_t   a[3];   /**<Denominator coefficients a0, a1, a2 */
+} filter_sos_coeff_t;
+
+/**
+ *     Generic filter instance type
+ */
+typedef struct filter_s * p_filter_t;
+
+/**
+ *     Filter pipeline instance type
+ */
+typedef struct filter_pipe_s * p_filter_pipe_t;
+
+/**
+ *  Generic filter interface
+ *
+ * @note    All functions get filter instance given at "filter_init()".
+ *          Handler is mandatory, other functions are optional (NULL).
+ */
+typedef struct
+{
+    filter_status_t (*pf_hndl)       (void * const p_inst, const float32_t in, float32_t * const p_out);                                 /**<Handle single sample */
+    filter_status_t (*pf_block)      (void * const p_inst, const float32_t * const p_in, float32_t * const p_out, const uint32_t size);  /**<Handle block of samples */
+    filter_status_t (*pf_reset)      (void * const p_inst);                                                                              /**<Reset filter */
+    uint32_t        (*pf_state_size) (const void * const p_inst);                                                                        /**<Size of filter data in bytes */
+    float32_t       (*pf_fs_get)     (const void * const p_inst);                                                                        /**<Filter sampling frequency in Hz (0 if unknown) */
+} filter_iface_t;
+
+/**
+ *  LTI stages fusion report
+ *
+ * @note    Operations are multiplications, additions and divisions per sample.
+ */
+typedef struct
+{
+    uint32_t    ops_before;     /**<Operations of separate stages */
+    uint32_t    ops_after;      /**<Operations of fused filter */
+    uint32_t    states_before;  /**<State variables of separate stages */
+    uint32_t    states_after;   /**<State variables of fused filter */
+} filter_fuse_report_t;
+
+/**
+ *  Boolean filter output transition (edge)
+ */
+typedef struct
+{
+    uint32_t    idx;    /**<Sample index within block (or channel index for bank) */
+    bool        state;  /**<New output state */
+} filter_bool_edge_t;
+
 ////////////////////////////////////////////////////////////////////////////////
 // Functions
 ////////////////////////////////////////////////////////////////////////////////
@@ -95,29 +221,151 @@ typedef struct
 filter_status_t filter_rc_init          (p_filter_rc_t * p_filter_inst, const float32_t fc, const float32_t fs, const uint8_t order, const float32_t init_value);
 filter_status_t filter_rc_is_init       (p_filter_rc_t filter_inst, bool * const p_is_init);
 filter_status_t filter_rc_hndl          (p_filter_rc_t filter_inst, const float32_t in, float32_t * const p_out);
+filter_status_t filter_rc_hndl_block    (p_filter_rc_t filter_inst, const float32_t * const p_in, float32_t * const p_out, const uint32_t size);
+filter_status_t filter_rc_hndl_dt       (p_filter_rc_t filter_inst, const float32_t in, const float32_t dt, float32_t * const p_out);
+filter_status_t filter_rc_hndl_block_fc (p_filter_rc_t filter_inst, const float32_t * const p_in, const float32_t * const p_fc, float32_t * const p_out, const uint32_t size);
 filter_status_t filter_rc_reset         (p_filter_rc_t filter_inst, const float32_t rst_value);
 filter_status_t filter_rc_fc_set        (p_filter_rc_t filter_inst, const float32_t fc);
+filter_status_t filter_rc_fc_set_fast   (p_filter_rc_t filter_inst, const float32_t fc);
 filter_status_t filter_rc_fc_get        (p_filter_rc_t filter_inst, float32_t * const p_fc);
 filter_status_t filter_rc_fs_get        (p_filter_rc_t filter_inst, float32_t * const p_fs);
 
+#if ( 1 == FILTER_CFG_ATOMIC_EN )
+filter_status_t filter_rc_fc_set_deferred (p_filter_rc_t filter_inst, const float32_t fc);
+filter_status_t filter_rc_fc_set_atomic (p_filter_rc_t filter_inst, const float32_t fc);
+filter_status_t filter_rc_fc_get_atomic (p_filter_rc_t filter_inst, float32_t * const p_fc);
+#endif
+
 // CR filter API
 filter_status_t filter_cr_init          (p_filter_cr_t * p_filter_inst, const float32_t fc, const float32_t fs, const uint8_t order);
 filter_status_t filter_cr_is_init       (p_filter_cr_t filter_inst, bool * const p_is_init);
 filter_status_t filter_cr_hndl          (p_filter_cr_t filter_inst, const float32_t in, float32_t * const p_out);
+filter_status_t filter_cr_hndl_block    (p_filter_cr_t filter_inst, const float32_t * const p_in, float32_t * const p_out, const uint32_t size);
+filter_status_t filter_cr_hndl_dt       (p_filter_cr_t filter_inst, const float32_t in, const float32_t dt, float32_t * const p_out);
+filter_status_t filter_cr_hndl_block_fc (p_filter_cr_t filter_inst, const float32_t * const p_in, const float32_t * const p_fc, float32_t * const p_out, const uint32_t size);
 filter_status_t filter_cr_reset         (p_filter_cr_t filter_inst);
 filter_status_t filter_cr_fc_set        (p_filter_cr_t filter_inst, const float32_t fc);
+filter_status_t filter_cr_fc_set_fast   (p_filter_cr_t filter_inst, const float32_t fc);
 filter_status_t filter_cr_fc_get        (p_filter_cr_t filter_inst, float32_t * const p_fc);
 filter_status_t filter_cr_fs_get        (p_filter_cr_t filter_inst, float32_t * const p_fs);
 
+#if ( 1 == FILTER_CFG_ATOMIC_EN )
+filter_status_t filter_cr_fc_set_deferred (p_filter_cr_t filter_inst, const float32_t fc);
+filter_status_t filter_cr_fc_set_atomic (p_filter_cr_t filter_inst, const float32_t fc);
+filter_status_t filter_cr_fc_get_atomic (p_filter_cr_t filter_inst, float32_t * const p_fc);
+#endif
+
+// RC filter bank API
+filter_status_t filter_rc_bank_init     (p_filter_rc_bank_t * p_bank_inst, const uint32_t num_of_ch, const float32_t fc, const float32_t fs, const uint8_t order, const float32_t init_value);
+filter_status_t filter_rc_bank_is_init  (p_filter_rc_bank_t bank_inst, bool * const p_is_init);
+filter_status_t filter_rc_bank_hndl     (p_filter_rc_bank_t bank_inst, const float32_t * const p_in, float32_t * const p_out);
+filter_status_t filter_rc_bank_reset    (p_filter_rc_bank_t bank_inst, const float32_t rst_value);
+filter_status_t filter_rc_bank_fc_set   (p_filter_rc_bank_t bank_inst, const float32_t * const p_fc);
+filter_status_t filter_rc_bank_ch_fc_set(p_filter_rc_bank_t bank_inst, const uint32_t ch, const float32_t fc);
+filter_status_t filter_rc_bank_fc_get   (p_filter_rc_bank_t bank_inst, float32_t * const p_fc);
+filter_status_t filter_rc_bank_fs_get   (p_filter_rc_bank_t bank_inst, float32_t * const p_fs);
+
+#if ( 1 == FILTER_CFG_ATOMIC_EN )
+filter_status_t filter_rc_bank_fc_set_atomic    (p_filter_rc_bank_t bank_inst, const float32_t * const p_fc);
+filter_status_t filter_rc_bank_ch_fc_set_atomic (p_filter_rc_bank_t bank_inst, const uint32_t ch, const float32_t fc);
+filter_status_t filter_rc_bank_fc_get_atomic    (p_filter_rc_bank_t bank_inst, float32_t * const p_fc);
+#endif
+
+// CR filter bank API
+filter_status_t filter_cr_bank_init     (p_filter_cr_bank_t * p_bank_inst, const uint32_t num_of_ch, const float32_t fc, const float32_t fs, const uint8_t order);
+filter_status_t filter_cr_bank_is_init  (p_filter_cr_bank_t bank_inst, bool * const p_is_init);
+filter_status_t filter_cr_bank_hndl     (p_filter_cr_bank_t bank_inst, const float32_t * const p_in, float32_t * const p_out);
+filter_status_t filter_cr_bank_reset    (p_filter_cr_bank_t bank_inst);
+filter_status_t filter_cr_bank_fc_set   (p_filter_cr_bank_t bank_inst, const float32_t * const p_fc);
+filter_status_t filter_cr_bank_ch_fc_set(p_filter_cr_bank_t bank_inst, const uint32_t ch, const float32_t fc);
+filter_status_t filter_cr_bank_fc_get   (p_filter_cr_bank_t bank_inst, float32_t * const p_fc);
+filter_status_t filter_cr_bank_fs_get   (p_filter_cr_bank_t bank_inst, float32_t * const p_fs);
+
+#if ( 1 == FILTER_CFG_ATOMIC_EN )
+filter_status_t filter_cr_bank_fc_set_atomic    (p_filter_cr_bank_t bank_inst, const float32_t * const p_fc);
+filter_status_t filter_cr_bank_ch_fc_set_atomic (p_filter_cr_bank_t bank_inst, const uint32_t ch, const float32_t fc);
+filter_status_t filter_cr_bank_fc_get_atomic    (p_filter_cr_bank_t bank_inst, float32_t * const p_fc);
+#endif
+
+// Band (CR + RC) filter API
+filter_status_t filter_band_init        (p_filter_band_t * p_filter_inst, const float32_t fc_cr, const float32_t fc_rc, const float32_t fs, const uint8_t order_cr, const uint8_t order_rc);
+filter_status_t filter_band_is_init     (p_filter_band_t filter_inst, bool * const p_is_init);
+filter_status_t filter_band_hndl        (p_filter_band_t filter_inst, const float32_t in, float32_t * const p_out);
+filter_status_t filter_band_hndl_block  (p_filter_band_t filter_inst, const float32_t * const p_in, float32_t * const p_out, const uint32_t size);
+filter_status_t filter_band_reset       (p_filter_band_t filter_inst);
+filter_status_t filter_band_fc_set      (p_filter_band_t filter_inst, const float32_t fc_cr, const float32_t fc_rc);
+filter_status_t filter_band_fc_get      (p_filter_band_t filter_inst, float32_t * const p_fc_cr, float32_t * const p_fc_rc);
+filter_status_t filter_band_fs_get      (p_filter_band_t filter_inst, float32_t * const p_fs);
+
+#if ( 1 == FILTER_CFG_ATOMIC_EN )
+filter_status_t filter_band_fc_set_atomic   (p_filter_band_t filter_inst, const float32_t fc_cr, const float32_t fc_rc);
+filter_status_t filter_band_fc_get_atomic   (p_filter_band_t filter_inst, float32_t * const p_fc_cr, float32_t * const p_fc_rc);
+#endif
+
+// Integer DC blocker API
+filter_status_t filter_dcb_init         (p_filter_dcb_t * p_filter_inst, const float32_t fc, const float32_t fs);
+filter_status_t filter_dcb_is_init      (p_filter_dcb_t filter_inst, bool * const p_is_init);
+filter_status_t filter_dcb_hndl         (p_filter_dcb_t filter_inst, const int16_t in, int16_t * const p_out);
+filter_status_t filter_dcb_hndl_block   (p_filter_dcb_t filter_inst, const int16_t * const p_in, int16_t * const p_out, const uint32_t size);
+filter_status_t filter_dcb_reset        (p_filter_dcb_t filter_inst);
+
+// Integer DC blocker bank API
+filter_status_t filter_dcb_bank_init        (p_filter_dcb_bank_t * p_bank_inst, const uint32_t num_of_ch, const float32_t fc, const float32_t fs);
+filter_status_t filter_dcb_bank_is_init     (p_filter_dcb_bank_t bank_inst, bool * const p_is_init);
+filter_status_t filter_dcb_bank_hndl        (p_filter_dcb_bank_t bank_inst, const int16_t * const p_in, int16_t * const p_out);
+filter_status_t filter_dcb_bank_hndl_block  (p_filter_dcb_bank_t bank_inst, const int16_t * const p_in, int16_t * const p_out, const uint32_t num_of_frames);
+filter_status_t filter_dcb_bank_reset       (p_filter_dcb_bank_t bank_inst);
+
+// One-euro (adaptive cutoff RC) filter API
+filter_status_t filter_euro_init        (p_filter_euro_t * p_filter_inst, const float32_t fc_min, const float32_t beta, const float32_t fc_d, const float32_t fs, const float32_t init_value);
+filter_status_t filter_euro_is_init     (p_filter_euro_t filter_inst, bool * const p_is_init);
+filter_status_t filter_euro_hndl        (p_filter_euro_t filter_inst, const float32_t in, float32_t * const p_out);
+filter_status_t filter_euro_reset       (p_filter_euro_t filter_inst, const float32_t rst_value);
+
+// One-euro (adaptive cutoff RC) filter bank API
+filter_status_t filter_euro_bank_init   (p_filter_euro_bank_t * p_bank_inst, const uint32_t num_of_ch, const float32_t fc_min, const float32_t beta, const float32_t fc_d, const float32_t fs, const float32_t init_value);
+filter_status_t filter_euro_bank_is_init(p_filter_euro_bank_t bank_inst, bool * const p_is_init);
+filter_status_t filter_euro_bank_hndl   (p_filter_euro_bank_t bank_inst, const float32_t * const p_in, float32_t * const p_out);
+filter_status_t filter_euro_bank_reset  (p_filter_euro_bank_t bank_inst, const float32_t rst_value);
+
 // Boolean (debouncing) LPF filter API
 filter_status_t filter_bool_init        (p_filter_bool_t * p_filter_inst, const float32_t fc, const float32_t fs, const float32_t comp_lvl);
 filter_status_t filter_bool_is_init     (p_filter_bool_t filter_inst, bool * const p_is_init);
 filter_status_t filter_bool_hndl        (p_filter_bool_t filter_inst, const bool in, bool * const p_out);
+filter_status_t filter_bool_hndl_packed (p_filter_bool_t filter_inst, const uint64_t * const p_in, uint64_t * const p_out, const uint32_t num_of_words);
+filter_status_t filter_bool_hndl_edges  (p_filter_bool_t filter_inst, const uint64_t * const p_in, const uint32_t num_of_words, filter_bool_edge_t * const p_edge, const uint32_t max_edges, uint32_t * const p_num_of_edges);
 filter_status_t filter_bool_reset       (p_filter_bool_t filter_inst);
 filter_status_t filter_bool_fc_set      (p_filter_bool_t filter_inst, const float32_t fc);
 filter_status_t filter_bool_fc_get      (p_filter_bool_t filter_inst, float32_t * const p_fc);
 filter_status_t filter_bool_fs_get      (p_filter_bool_t filter_inst, float32_t * const p_fs);
 
+#if ( 1 == FILTER_CFG_ATOMIC_EN )
+filter_status_t filter_bool_fc_set_deferred (p_filter_bool_t filter_inst, const float32_t fc);
+filter_status_t filter_bool_fc_set_atomic   (p_filter_bool_t filter_inst, const float32_t fc);
+filter_status_t filter_bool_fc_get_atomic   (p_filter_bool_t filter_inst, float32_t * const p_fc);
+#endif
+
+// Integer boolean (debouncing) filter API
+filter_status_t filter_bool_cnt_init    (p_filter_bool_cnt_t * p_filter_inst, const float32_t fc, const float32_t fs, const float32_t comp_lvl);
+filter_status_t filter_bool_cnt_is_init (p_filter_bool_cnt_t filter_inst, bool * const p_is_init);
+filter_status_t filter_bool_cnt_hndl    (p_filter_bool_cnt_t filter_inst, const bool in, bool * const p_out);
+filter_status_t filter_bool_cnt_reset   (p_filter_bool_cnt_t filter_inst);
+filter_status_t filter_bool_cnt_fc_set  (p_filter_bool_cnt_t filter_inst, const float32_t fc, const float32_t comp_lvl);
+filter_status_t filter_bool_cnt_fc_get  (p_filter_bool_cnt_t filter_inst, float32_t * const p_fc);
+filter_status_t filter_bool_cnt_fs_get  (p_filter_bool_cnt_t filter_inst, float32_t * const p_fs);
+
+#if ( 1 == FILTER_CFG_ATOMIC_EN )
+filter_status_t filter_bool_cnt_fc_set_atomic   (p_filter_bool_cnt_t filter_inst, const float32_t fc, const float32_t comp_lvl);
+filter_status_t filter_bool_cnt_fc_get_atomic   (p_filter_bool_cnt_t filter_inst, float32_t * const p_fc);
+#endif
+
+// Boolean (debouncing) filter bank API
+filter_status_t filter_bool_bank_init   (p_filter_bool_bank_t * p_bank_inst, const uint32_t num_of_ch, const float32_t fc, const float32_t fs, const float32_t comp_lvl);
+filter_status_t filter_bool_bank_is_init(p_filter_bool_bank_t bank_inst, bool * const p_is_init);
+filter_status_t filter_bool_bank_hndl   (p_filter_bool_bank_t bank_inst, const uint64_t * const p_in, uint64_t * const p_out);
+filter_status_t filter_bool_bank_hndl_edges(p_filter_bool_bank_t bank_inst, const uint64_t * const p_in, filter_bool_edge_t * const p_edge, const uint32_t max_edges, uint32_t * const p_num_of_edges);
+filter_status_t filter_bool_bank_reset  (p_filter_bool_bank_t bank_inst);
+
 // FIR filter API
 filter_status_t filter_fir_init         (p_filter_fir_t * p_filter_inst, const float32_t * p_a, const uint32_t order, const float32_t init_value);
 filter_status_t filter_fir_is_init      (p_filter_fir_t filter_inst, bool * const p_is_init);
@@ -126,6 +374,11 @@ filter_status_t filter_fir_reset        (p_filter_fir_t filter_inst, const float
 filter_status_t filter_fir_coeff_set    (p_filter_fir_t filter_inst, const float32_t * const p_a);
 filter_status_t filter_fir_coeff_get    (p_filter_fir_t filter_inst, float32_t ** const pp_a);
 
+#if ( 1 == FILTER_CFG_ATOMIC_EN )
+filter_status_t filter_fir_coeff_set_atomic    (p_filter_fir_t filter_inst, const float32_t * const p_a);
+filter_status_t filter_fir_coeff_get_atomic    (p_filter_fir_t filter_inst, float32_t * const p_a);
+#endif
+
 // IIR filter API
 filter_status_t filter_iir_init         (p_filter_iir_t * p_filter_inst, const filter_iir_coeff_t * const p_coeff);
 filter_status_t filter_iir_is_init      (p_filter_iir_t filter_inst, bool * const p_is_init);
@@ -134,6 +387,11 @@ filter_status_t filter_iir_reset        (p_filter_iir_t filter_inst);
 filter_status_t filter_iir_coeff_set    (p_filter_iir_t filter_inst, const filter_iir_coeff_t * const p_coeff);
 filter_status_t filter_iir_coeff_get    (p_filter_iir_t filter_inst, filter_iir_coeff_t ** const pp_coeff);
 
+#if ( 1 == FILTER_CFG_ATOMIC_EN )
+filter_status_t filter_iir_coeff_set_atomic    (p_filter_iir_t filter_inst, const filter_iir_coeff_t * const p_coeff);
+filter_status_t filter_iir_coeff_get_atomic    (p_filter_iir_t filter_inst, filter_iir_coeff_t * const p_coeff);
+#endif
+
 // IIR helper functions
 filter_status_t filter_iir_coeff_calc_2nd_lpf       (const float32_t fc, const float32_t zeta, const float32_t fs, float32_t * const p_pole, float32_t * const p_zero);
 filter_status_t filter_iir_coeff_calc_2nd_hpf       (const float32_t fc, const float32_t zeta, const float32_t fs, float32_t * const p_pole, float32_t * const p_zero);
@@ -143,6 +401,40 @@ float32_t       filter_iir_calc_hpf_gain            (const filter_iir_coeff_t *
 filter_status_t filter_iir_coeff_to_unity_gain_lpf  (filter_iir_coeff_t * const p_coeff);
 filter_status_t filter_iir_coeff_to_unity_gain_hpf  (filter_iir_coeff_t * const p_coeff);
 
+// SOS (cascade of 1st/2nd order sections) filter API
+filter_status_t filter_sos_init         (p_filter_sos_t * p_filter_inst, const filter_sos_coeff_t * const p_sect, const uint32_t num_of_sect);
+filter_status_t filter_sos_is_init      (p_filter_sos_t filter_inst, bool * const p_is_init);
+filter_status_t filter_sos_hndl         (p_filter_sos_t filter_inst, const float32_t in, float32_t * const p_out);
+filter_status_t filter_sos_hndl_block   (p_filter_sos_t filter_inst, const float32_t * const p_in, float32_t * const p_out, const uint32_t size);
+filter_status_t filter_sos_reset        (p_filter_sos_t filter_inst);
+
+// Generic filter API
+filter_status_t filter_init             (p_filter_t * p_filter_inst, const filter_iface_t * const p_iface, void * const p_inst);
+filter_status_t filter_from_rc          (p_filter_t * p_filter_inst, p_filter_rc_t rc_inst);
+filter_status_t filter_from_cr          (p_filter_t * p_filter_inst, p_filter_cr_t cr_inst);
+filter_status_t filter_from_fir         (p_filter_t * p_filter_inst, p_filter_fir_t fir_inst);
+filter_status_t filter_from_iir         (p_filter_t * p_filter_inst, p_filter_iir_t iir_inst);
+filter_status_t filter_from_sos         (p_filter_t * p_filter_inst, p_filter_sos_t sos_inst);
+filter_status_t filter_from_bool        (p_filter_t * p_filter_inst, p_filter_bool_t bool_inst);
+filter_status_t filter_from_band        (p_filter_t * p_filter_inst, p_filter_band_t band_inst);
+filter_status_t filter_from_euro        (p_filter_t * p_filter_inst, p_filter_euro_t euro_inst);
+filter_status_t filter_is_init          (p_filter_t filter_inst, bool * const p_is_init);
+filter_status_t filter_hndl             (p_filter_t filter_inst, const float32_t in, float32_t * const p_out);
+filter_status_t filter_hndl_block       (p_filter_t filter_inst, const float32_t * const p_in, float32_t * const p_out, const uint32_t size);
+filter_status_t filter_reset            (p_filter_t filter_inst);
+filter_status_t filter_state_size_get   (p_filter_t filter_inst, uint32_t * const p_size);
+filter_status_t filter_fs_get           (p_filter_t filter_inst, float32_t * const p_fs);
+
+// Filter pipeline API
+filter_status_t filter_pipe_init        (p_filter_pipe_t * p_pipe_inst, const p_filter_t * const p_stage, const uint32_t num_of_stages);
+filter_status_t filter_pipe_is_init     (p_filter_pipe_t pipe_inst, bool * const p_is_init);
+filter_status_t filter_pipe_hndl        (p_filter_pipe_t pipe_inst, const float32_t in, float32_t * const p_out);
+filter_status_t filter_pipe_hndl_block  (p_filter_pipe_t pipe_inst, const float32_t * const p_in, float32_t * const p_out, const uint32_t size);
+filter_status_t filter_pipe_reset       (p_filter_pipe_t pipe_inst);
+
+// LTI stages fusion API
+filter_status_t filter_fuse_to_sos      (p_filter_sos_t * p_filter_inst, const p_filter_t * const p_stage, const uint32_t num_of_stages, filter_fuse_report_t * const p_report);
+
 #endif // __FILTER_H
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,617 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      filter_budget.c
+*@brief     Time budgeted filter executor with quality tiers
+*@author    Ziga Miklosic
+*@date      17.10.2026
+*@version   V2.1.0
+*
+*@section   Description
+*
+*   Executor processes registered set of filter channels once per tick
+*   and measures processing time. Each channel has list of filter tiers,
+*   from full quality down to cheapest approximation. When tick exceeds
+*   time budget, lowest priority channels are switched one tier down until
+*   estimated savings cover the excess. When processing time stays below
+*   FILTER_BUDGET_HEADROOM of budget for configured number of ticks,
+*   highest priority degraded channel is switched one tier up, if its
+*   estimated extra cost still fits into headroom.
+*
+*   Cost of tier relative to current one is estimated from filter state
+*   size, which is proportional to number of multiply-adds per sample.
+*
+*   Tiers do not share state. On tier switch input samples of last tick
+*   are copied into channel history, incoming tier is then reset and primed
+*   with that history, so it starts from same recent input as outgoing tier
+*   instead of from stale state of its last activation. Priming from input
+*   (and not from output) makes it valid for any tier response, including
+*   high-pass or non-unity DC gain tiers. Priming is done at start of next
+*   tick and its time is excluded from tier adjustment decision.
+*
+*   Residual transient remains after switch: tiers with memory longer than
+*   one tick are only partially settled by priming and tiers with different
+*   response (phase, gain) will differ from outgoing tier by that response.
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup FILTER_BUDGET
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "filter_budget.h"
+#include <stdlib.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Fraction of budget below which channels can be upgraded
+ *
+ * @note    Gap between budget and headroom is hysteresis that prevents
+ *          channel toggling between tiers.
+ */
+#define FILTER_BUDGET_HEADROOM      ( 0.75f )
+
+/**
+ *     Budgeted executor channel data
+ */
+typedef struct
+{
+    p_filter_t        * p_tier;         /**<Filter tiers */
+    uint32_t          * p_cost;         /**<Estimated cost of tiers */
+    const float32_t   * p_in;           /**<Input samples */
+    float32_t         * p_out;          /**<Output samples */
+    uint32_t            size;           /**<Number of samples per tick */
+    uint32_t            num_of_tiers;   /**<Number of tiers */
+    uint32_t            tier;           /**<Active tier */
+    uint32_t            time;           /**<Measured processing time of active tier */
+    float32_t         * p_hist;         /**<Input samples of tick before tier switch */
+    uint8_t             priority;       /**<Channel priority */
+    bool                is_primed;      /**<Active tier primed after switch */
+} filter_budget_chan_t;
+
+/**
+ *     Budgeted executor data
+ */
+typedef struct filter_budget_s
+{
+    filter_budget_chan_t  * p_chan;         /**<Channels, in user order */
+    uint32_t              * p_order;        /**<Channel indices from highest to lowest priority */
+    filter_budget_cfg_t     cfg;            /**<Configuration */
+    filter_budget_stats_t   stats;          /**<Statistics */
+    uint32_t                num_of_ch;      /**<Number of channels */
+    uint32_t                hold;           /**<Number of consecutive ticks with headroom */
+    bool                    is_init;        /**<Executor initialization success flag */
+} filter_budget_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static filter_status_t  filter_budget_chan_init     (filter_budget_chan_t * const p_chan, const filter_budget_ch_t * const p_ch);
+static uint32_t         filter_budget_time_scale    (const filter_budget_chan_t * const p_chan, const uint32_t tier);
+static void             filter_budget_switch        (filter_budget_chan_t * const p_chan, const uint32_t tier);
+static filter_status_t  filter_budget_prime         (filter_budget_chan_t * const p_chan);
+static void             filter_budget_degrade       (filter_budget_t * const p_budget, const uint32_t excess);
+static void             filter_budget_upgrade       (filter_budget_t * const p_budget, const uint32_t time);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Initialize executor channel
+*
+* @param[in]    p_chan  - Channel data
+* @param[in]    p_ch    - Channel description
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static filter_status_t filter_budget_chan_init(filter_budget_chan_t * const p_chan, const filter_budget_ch_t * const p_ch)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != p_ch->p_tier )
+        &&  ( p_ch->num_of_tiers > 0UL )
+        &&  ( NULL != p_ch->p_in )
+        &&  ( NULL != p_ch->p_out )
+        &&  ( p_ch->size > 0UL ))
+    {
+        p_chan->p_tier = malloc( p_ch->num_of_tiers * sizeof( p_filter_t ));
+        p_chan->p_cost = malloc( p_ch->num_of_tiers * sizeof( uint32_t ));
+        p_chan->p_hist = malloc( p_ch->size * sizeof( float32_t ));
+
+        if  (   ( NULL != p_chan->p_tier )
+            &&  ( NULL != p_chan->p_cost )
+            &&  ( NULL != p_chan->p_hist ))
+        {
+            for ( uint32_t t = 0U; t < p_ch->num_of_tiers; t++ )
+            {
+                p_chan->p_tier[t] = p_ch->p_tier[t];
+
+                // Cost estimate from state size
+                status |= filter_state_size_get( p_ch->p_tier[t], &p_chan->p_cost[t] );
+                p_chan->p_cost[t] = (( p_chan->p_cost[t] > 0U ) ? p_chan->p_cost[t] : 1U );
+            }
+
+            p_chan->p_in            = p_ch->p_in;
+            p_chan->p_out           = p_ch->p_out;
+            p_chan->size            = p_ch->size;
+            p_chan->num_of_tiers    = p_ch->num_of_tiers;
+            p_chan->tier            = 0U;
+            p_chan->time            = 0U;
+            p_chan->priority        = p_ch->priority;
+            p_chan->is_primed       = true;
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Estimate processing time of channel at given tier
+*
+* @brief    Measured time of active tier scaled by ratio of tier costs.
+*
+* @param[in]    p_chan  - Channel data
+* @param[in]    tier    - Tier
+* @return       time    - Estimated processing time
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t filter_budget_time_scale(const filter_budget_chan_t * const p_chan, const uint32_t tier)
+{
+    return (uint32_t) (((uint64_t) p_chan->time * p_chan->p_cost[tier] ) / p_chan->p_cost[ p_chan->tier ] );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Switch channel to new tier
+*
+* @note     Input of current tick is kept as priming history, because
+*           input samples are overwritten before incoming tier is primed
+*           at start of next tick.
+*
+* @param[in]    p_chan  - Channel data
+* @param[in]    tier    - New tier
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void filter_budget_switch(filter_budget_chan_t * const p_chan, const uint32_t tier)
+{
+    for ( uint32_t n = 0U; n < p_chan->size; n++ )
+    {
+        p_chan->p_hist[n] = p_chan->p_in[n];
+    }
+
+    p_chan->time        = filter_budget_time_scale( p_chan, tier );
+    p_chan->tier        = tier;
+    p_chan->is_primed   = false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Prime active tier of channel
+*
+* @brief    Tier is reset and fed with input samples of tick before switch.
+*           Primed output is overwritten by regular processing.
+*
+* @param[in]    p_chan      - Channel data
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static filter_status_t filter_budget_prime(filter_budget_chan_t * const p_chan)
+{
+    filter_status_t status = eFILTER_OK;
+
+    status = filter_reset( p_chan->p_tier[ p_chan->tier ] );
+
+    status |= filter_hndl_block( p_chan->p_tier[ p_chan->tier ], p_chan->p_hist, p_chan->p_out, p_chan->size );
+
+    p_chan->is_primed = true;
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Step down lowest priority channels to cover excess time
+*
+* @param[in]    p_budget    - Executor
+* @param[in]    excess      - Time over budget
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void filter_budget_degrade(filter_budget_t * const p_budget, const uint32_t excess)
+{
+    uint32_t saved = 0U;
+
+    for ( uint32_t k = p_budget->num_of_ch; ( k > 0U ) && ( saved < excess ); k-- )
+    {
+        filter_budget_chan_t * const p_chan = &p_budget->p_chan[ p_budget->p_order[ k - 1U ]];
+
+        if (( p_chan->tier + 1U ) < p_chan->num_of_tiers )
+        {
+            const uint32_t time_next = filter_budget_time_scale( p_chan, ( p_chan->tier + 1U ));
+
+            if ( time_next < p_chan->time )
+            {
+                saved += ( p_chan->time - time_next );
+            }
+
+            filter_budget_switch( p_chan, ( p_chan->tier + 1U ));
+            p_budget->stats.num_of_degrades++;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Step up highest priority degraded channel if it fits into headroom
+*
+* @note     Tick with switch also primes incoming tier, so it must fit into
+*           budget with priming cost.
+*
+* @param[in]    p_budget    - Executor
+* @param[in]    time        - Processing time of last tick
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void filter_budget_upgrade(filter_budget_t * const p_budget, const uint32_t time)
+{
+    const uint32_t  headroom    = (uint32_t) ( FILTER_BUDGET_HEADROOM * (float32_t) p_budget->cfg.budget );
+    bool            found       = false;
+
+    for ( uint32_t k = 0U; ( k < p_budget->num_of_ch ) && ( false == found ); k++ )
+    {
+        filter_budget_chan_t * const p_chan = &p_budget->p_chan[ p_budget->p_order[k] ];
+
+        if ( p_chan->tier > 0U )
+        {
+            const uint32_t time_prev    = filter_budget_time_scale( p_chan, ( p_chan->tier - 1U ));
+            const uint32_t extra        = (( time_prev > p_chan->time ) ? ( time_prev - p_chan->time ) : 0U );
+
+            // Lower priority channels wait for this one
+            found = true;
+
+            if  (   (( time + extra ) <= headroom )
+                &&  (( time + extra + time_prev ) <= p_budget->cfg.budget ))
+            {
+                filter_budget_switch( p_chan, ( p_chan->tier - 1U ));
+                p_budget->stats.num_of_upgrades++;
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FILTER_BUDGET_API
+* @{ <!-- BEGIN GROUP -->
+*
+*   Following function are part of budgeted executor API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*   Initialize budgeted executor
+*
+* @note     All channels start at tier 0 (full quality).
+*
+* @note     Same generic filter shall not be used by more than one channel!
+*
+* @param[in]    p_budget_inst   - Pointer to budgeted executor instance
+* @param[in]    p_ch            - List of channels
+* @param[in]    num_of_ch       - Number of channels
+* @param[in]    p_cfg           - Executor configuration
+* @return       status          - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_budget_init(p_filter_budget_t * p_budget_inst, const filter_budget_ch_t * const p_ch, const uint32_t num_of_ch, const filter_budget_cfg_t * const p_cfg)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != p_budget_inst )
+        &&  ( NULL != p_ch )
+        &&  ( num_of_ch > 0UL )
+        &&  ( NULL != p_cfg )
+        &&  ( NULL != p_cfg->pf_time_get )
+        &&  ( p_cfg->budget > 0UL ))
+    {
+        // Allocate space
+        *p_budget_inst = malloc( sizeof( filter_budget_t ));
+
+        if ( NULL != *p_budget_inst )
+        {
+            (*p_budget_inst)->p_chan    = malloc( num_of_ch * sizeof( filter_budget_chan_t ));
+            (*p_budget_inst)->p_order   = malloc( num_of_ch * sizeof( uint32_t ));
+            (*p_budget_inst)->is_init   = false;
+        }
+
+        // Check if allocation succeed
+        if  (   ( NULL != *p_budget_inst )
+            &&  ( NULL != (*p_budget_inst)->p_chan )
+            &&  ( NULL != (*p_budget_inst)->p_order ))
+        {
+            for ( uint32_t i = 0U; ( i < num_of_ch ) && ( eFILTER_OK == status ); i++ )
+            {
+                status = filter_budget_chan_init( &(*p_budget_inst)->p_chan[i], &p_ch[i] );
+
+                // Insert into priority order, equal priorities keep user order
+                if ( eFILTER_OK == status )
+                {
+                    uint32_t k = i;
+
+                    while   (   ( k > 0U )
+                            &&  ( p_ch[ (*p_budget_inst)->p_order[ k - 1U ]].priority < p_ch[i].priority ))
+                    {
+                        (*p_budget_inst)->p_order[k] = (*p_budget_inst)->p_order[ k - 1U ];
+                        k--;
+                    }
+
+                    (*p_budget_inst)->p_order[k] = i;
+                }
+            }
+
+            if ( eFILTER_OK == status )
+            {
+                (*p_budget_inst)->cfg       = *p_cfg;
+                (*p_budget_inst)->num_of_ch = num_of_ch;
+                (*p_budget_inst)->hold      = 0U;
+
+                (*p_budget_inst)->stats.time_last           = 0U;
+                (*p_budget_inst)->stats.time_max            = 0U;
+                (*p_budget_inst)->stats.num_of_overloads    = 0U;
+                (*p_budget_inst)->stats.num_of_degrades     = 0U;
+                (*p_budget_inst)->stats.num_of_upgrades     = 0U;
+
+                // Init success
+                (*p_budget_inst)->is_init = true;
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get initialization status of budgeted executor
+*
+* @param[in]    budget_inst - Budgeted executor instance
+* @param[out]   p_is_init   - Budgeted executor init state
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_budget_is_init(p_filter_budget_t budget_inst, bool * const p_is_init)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != budget_inst )
+        &&  ( NULL != p_is_init ))
+    {
+        *p_is_init = budget_inst->is_init;
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Handle budgeted executor
+*
+* @brief    Processes all channels with their active tier, then adjusts
+*           tiers for next tick based on measured processing time.
+*
+* @note     Tier switched at previous tick is primed first (see file
+*           description), output may show short transient after switch.
+*
+* @param[in]    budget_inst - Budgeted executor instance
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_budget_hndl(p_filter_budget_t budget_inst)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if ( NULL != budget_inst )
+    {
+        // Is instance init?
+        if ( true == budget_inst->is_init )
+        {
+            const uint32_t  tick_start  = budget_inst->cfg.pf_time_get();
+            uint32_t        time        = 0U;
+            uint32_t        time_prime  = 0U;
+
+            for ( uint32_t i = 0U; i < budget_inst->num_of_ch; i++ )
+            {
+                filter_budget_chan_t * const    p_chan  = &budget_inst->p_chan[i];
+                uint32_t                        start   = 0U;
+
+                // Prime incoming tier after switch
+                if ( false == p_chan->is_primed )
+                {
+                    start = budget_inst->cfg.pf_time_get();
+
+                    status |= filter_budget_prime( p_chan );
+
+                    time_prime += ( budget_inst->cfg.pf_time_get() - start );
+                }
+
+                start = budget_inst->cfg.pf_time_get();
+
+                status |= filter_hndl_block( p_chan->p_tier[ p_chan->tier ], p_chan->p_in, p_chan->p_out, p_chan->size );
+
+                p_chan->time = ( budget_inst->cfg.pf_time_get() - start );
+            }
+
+            time = ( budget_inst->cfg.pf_time_get() - tick_start );
+
+            budget_inst->stats.time_last = time;
+
+            if ( time > budget_inst->stats.time_max )
+            {
+                budget_inst->stats.time_max = time;
+            }
+
+            if ( time > budget_inst->cfg.budget )
+            {
+                budget_inst->stats.num_of_overloads++;
+            }
+
+            // Priming is one-off cost of previous decision
+            time = (( time > time_prime ) ? ( time - time_prime ) : 0U );
+
+            // Overload
+            if ( time > budget_inst->cfg.budget )
+            {
+                budget_inst->hold = 0U;
+
+                filter_budget_degrade( budget_inst, ( time - budget_inst->cfg.budget ));
+            }
+
+            // Headroom
+            else if ( time <= (uint32_t) ( FILTER_BUDGET_HEADROOM * (float32_t) budget_inst->cfg.budget ))
+            {
+                budget_inst->hold++;
+
+                if ( budget_inst->hold >= budget_inst->cfg.hold_ticks )
+                {
+                    budget_inst->hold = 0U;
+
+                    filter_budget_upgrade( budget_inst, time );
+                }
+            }
+            else
+            {
+                budget_inst->hold = 0U;
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get active tier of budgeted executor channel
+*
+* @param[in]    budget_inst - Budgeted executor instance
+* @param[in]    ch          - Channel index, as given at initialization
+* @param[out]   p_tier      - Active tier, 0 is full quality
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_budget_tier_get(p_filter_budget_t budget_inst, const uint32_t ch, uint32_t * const p_tier)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != budget_inst )
+        &&  ( NULL != p_tier ))
+    {
+        // Is instance init?
+        if  (   ( true == budget_inst->is_init )
+            &&  ( ch < budget_inst->num_of_ch ))
+        {
+            *p_tier = budget_inst->p_chan[ch].tier;
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get budgeted executor statistics
+*
+* @param[in]    budget_inst - Budgeted executor instance
+* @param[out]   p_stats     - Statistics
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_budget_stats_get(p_filter_budget_t budget_inst, filter_budget_stats_t * const p_stats)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != budget_inst )
+        &&  ( NULL != p_stats ))
+    {
+        // Is instance init?
+        if ( true == budget_inst->is_init )
+        {
+            *p_stats = budget_inst->stats;
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
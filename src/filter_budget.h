@@ -0,0 +1,94 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      filter_budget.h
+*@brief     Time budgeted filter executor with quality tiers
+*@author    Ziga Miklosic
+*@date      17.10.2026
+*@version   V2.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FILTER_BUDGET_API
+* @{ <!-- BEGIN GROUP -->
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __FILTER_BUDGET_H
+#define __FILTER_BUDGET_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "filter.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Budgeted executor instance type
+ */
+typedef struct filter_budget_s * p_filter_budget_t;
+
+/**
+ *  Budgeted executor channel
+ *
+ * @note    Tier 0 is full quality filter, each next tier shall be cheaper
+ *          approximation of previous one (e.g. 1k tap FIR -> 128 tap FIR
+ *          -> RC filter).
+ */
+typedef struct
+{
+    const p_filter_t  * p_tier;         /**<Filter tiers, from full quality down */
+    uint32_t            num_of_tiers;   /**<Number of tiers */
+    const float32_t   * p_in;           /**<Input samples */
+    float32_t         * p_out;          /**<Output samples */
+    uint32_t            size;           /**<Number of samples per tick */
+    uint8_t             priority;       /**<Channel priority, lower priority channels are degraded first */
+} filter_budget_ch_t;
+
+/**
+ *  Budgeted executor configuration
+ */
+typedef struct
+{
+    uint32_t    (*pf_time_get)  (void);     /**<Get time, free running counter */
+    uint32_t    budget;                     /**<Processing time budget per tick in time counter units */
+    uint32_t    hold_ticks;                 /**<Number of ticks with headroom before channel is upgraded */
+} filter_budget_cfg_t;
+
+/**
+ *  Budgeted executor statistics
+ */
+typedef struct
+{
+    uint32_t    time_last;          /**<Processing time of last tick */
+    uint32_t    time_max;           /**<Max. processing time of tick */
+    uint32_t    num_of_overloads;   /**<Number of ticks exceeding budget */
+    uint32_t    num_of_degrades;    /**<Number of tier steps down */
+    uint32_t    num_of_upgrades;    /**<Number of tier steps up */
+} filter_budget_stats_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_budget_init      (p_filter_budget_t * p_budget_inst, const filter_budget_ch_t * const p_ch, const uint32_t num_of_ch, const filter_budget_cfg_t * const p_cfg);
+filter_status_t filter_budget_is_init   (p_filter_budget_t budget_inst, bool * const p_is_init);
+filter_status_t filter_budget_hndl      (p_filter_budget_t budget_inst);
+filter_status_t filter_budget_tier_get  (p_filter_budget_t budget_inst, const uint32_t ch, uint32_t * const p_tier);
+filter_status_t filter_budget_stats_get (p_filter_budget_t budget_inst, filter_budget_stats_t * const p_stats);
+
+#endif // __FILTER_BUDGET_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,618 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      filter_rate.c
+*@brief     Multi-rate tick scheduler for filters
+*@author    Ziga Miklosic
+*@date      17.10.2026
+*@version   V2.1.0
+*
+*@section   Description
+*
+*   Scheduler runs filters with different sampling frequencies from single
+*   base tick. Filters are grouped by rate (base tick divider) and each
+*   group is executed on its own divided tick. Groups are executed from
+*   highest to lowest rate (rate monotonic), channels within group are laid
+*   out in contiguous array and each channel reads its input and writes its
+*   output directly.
+*
+*   Generic filter channel is executed with one handler call per sample
+*   (through generic interface). Same rate RC or CR filters shall be put
+*   into RC/CR filter bank and registered as single bank channel, then all
+*   bank channels are executed with single batched (SoA) bank handler call.
+*
+*   Channel sampling frequency is checked against sampling frequency of
+*   filter instance (when generic interface provides it), so filter designed
+*   for one rate can not silently be run at another one.
+*
+*   When time source is provided, time from start of base tick to end of
+*   each group execution is compared against group period and counted as
+*   overrun if longer.
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup FILTER_RATE
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "filter_rate.h"
+#include <stdlib.h>
+#include <math.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Allowed relative difference between requested filter sampling
+ *  frequency and base frequency divided by integer
+ */
+#define FILTER_RATE_FS_TOL          ( 1e-3f )
+
+/**
+ *     Multi-rate scheduler group
+ */
+typedef struct
+{
+    filter_rate_ch_t      * p_ch;           /**<Channels of group */
+    filter_rate_stats_t     stats;          /**<Group statistics */
+    uint32_t                divider;        /**<Base tick divider */
+    uint32_t                cnt;            /**<Base tick counter */
+    uint32_t                deadline;       /**<Group period in time counter units */
+} filter_rate_group_t;
+
+/**
+ *     Multi-rate scheduler data
+ */
+typedef struct filter_rate_s
+{
+    filter_rate_group_t   * p_group;        /**<Groups, sorted from highest rate */
+    filter_rate_cfg_t       cfg;            /**<Configuration */
+    uint32_t                num_of_groups;  /**<Number of groups */
+    bool                    is_init;        /**<Scheduler initialization success flag */
+} filter_rate_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static filter_status_t  filter_rate_divider_calc    (const float32_t fs, const float32_t base_fs, uint32_t * const p_divider);
+static filter_status_t  filter_rate_ch_check        (const filter_rate_ch_t * const p_ch);
+static filter_status_t  filter_rate_fs_resolve      (const filter_rate_ch_t * const p_ch, float32_t * const p_fs);
+static void             filter_rate_group_run       (const filter_rate_group_t * const p_group);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Calculate base tick divider
+*
+* @param[in]    fs          - Filter sampling frequency
+* @param[in]    base_fs     - Base tick frequency
+* @param[out]   p_divider   - Base tick divider
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static filter_status_t filter_rate_divider_calc(const float32_t fs, const float32_t base_fs, uint32_t * const p_divider)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( fs > 0.0f )
+        &&  ( fs <= base_fs ))
+    {
+        *p_divider = (uint32_t) lroundf( base_fs / fs );
+
+        // Rate must be integer fraction of base rate
+        if ( fabsf(( base_fs / (float32_t) *p_divider ) - fs ) > ( FILTER_RATE_FS_TOL * fs ))
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Check channel configuration
+*
+* @param[in]    p_ch    - Channel
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static filter_status_t filter_rate_ch_check(const filter_rate_ch_t * const p_ch)
+{
+    filter_status_t status      = eFILTER_OK;
+    uint32_t        num_of_inst = 0U;
+
+    num_of_inst += (( NULL != p_ch->filter )  ? 1U : 0U );
+    num_of_inst += (( NULL != p_ch->rc_bank ) ? 1U : 0U );
+    num_of_inst += (( NULL != p_ch->cr_bank ) ? 1U : 0U );
+
+    // Exactly one filter instance
+    if  (   ( 1U != num_of_inst )
+        ||  ( NULL == p_ch->p_in )
+        ||  ( NULL == p_ch->p_out ))
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Resolve channel sampling frequency
+*
+* @note     Sampling frequency of filter instance is taken when channel
+*           does not specify it (0). When both are known they must match.
+*
+* @param[in]    p_ch    - Channel
+* @param[out]   p_fs    - Channel sampling frequency
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static filter_status_t filter_rate_fs_resolve(const filter_rate_ch_t * const p_ch, float32_t * const p_fs)
+{
+    filter_status_t status  = eFILTER_OK;
+    float32_t       fs_inst = 0.0f;
+
+    if ( NULL != p_ch->rc_bank )
+    {
+        status = filter_rc_bank_fs_get( p_ch->rc_bank, &fs_inst );
+    }
+    else if ( NULL != p_ch->cr_bank )
+    {
+        status = filter_cr_bank_fs_get( p_ch->cr_bank, &fs_inst );
+    }
+    else
+    {
+        status = filter_fs_get( p_ch->filter, &fs_inst );
+    }
+
+    if ( eFILTER_OK == status )
+    {
+        if ( p_ch->fs <= 0.0f )
+        {
+            *p_fs = fs_inst;
+        }
+        else
+        {
+            *p_fs = p_ch->fs;
+
+            // Filter designed for different rate
+            if  (   ( fs_inst > 0.0f )
+                &&  ( fabsf( fs_inst - p_ch->fs ) > ( FILTER_RATE_FS_TOL * p_ch->fs )))
+            {
+                status = eFILTER_ERROR;
+            }
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Execute all channels of group
+*
+* @note     Filter bank channel processes all of its channels in single
+*           batched call.
+*
+* @param[in]    p_group - Group
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void filter_rate_group_run(const filter_rate_group_t * const p_group)
+{
+    const uint32_t num_of_ch = p_group->stats.num_of_ch;
+
+    for ( uint32_t i = 0U; i < num_of_ch; i++ )
+    {
+        const filter_rate_ch_t * const p_ch = &p_group->p_ch[i];
+
+        if ( NULL != p_ch->filter )
+        {
+            (void) filter_hndl( p_ch->filter, *p_ch->p_in, p_ch->p_out );
+        }
+        else if ( NULL != p_ch->rc_bank )
+        {
+            (void) filter_rc_bank_hndl( p_ch->rc_bank, p_ch->p_in, p_ch->p_out );
+        }
+        else
+        {
+            (void) filter_cr_bank_hndl( p_ch->cr_bank, p_ch->p_in, p_ch->p_out );
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FILTER_RATE_API
+* @{ <!-- BEGIN GROUP -->
+*
+*   Following function are part of multi-rate scheduler API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*   Initialize multi-rate scheduler
+*
+* @note     Filters are grouped by rate, each sampling frequency must be
+*           base frequency divided by integer.
+*
+* @note     Channel sampling frequency can be 0, then it is taken from
+*           filter instance. Init fails if channel and filter instance
+*           sampling frequency differ.
+*
+* @note     Each channel holds exactly one of generic filter, RC filter
+*           bank or CR filter bank. Same rate RC/CR filters put into filter
+*           bank are executed in single batched call per group tick.
+*
+* @note     Same filter (or filter bank) shall not be used by more than one
+*           channel!
+*
+* @param[in]    p_rate_inst - Pointer to multi-rate scheduler instance
+* @param[in]    p_ch        - List of channels
+* @param[in]    num_of_ch   - Number of channels
+* @param[in]    p_cfg       - Scheduler configuration
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_rate_init(p_filter_rate_t * p_rate_inst, const filter_rate_ch_t * const p_ch, const uint32_t num_of_ch, const filter_rate_cfg_t * const p_cfg)
+{
+    filter_status_t status      = eFILTER_OK;
+    uint32_t      * p_divider   = NULL;
+    float32_t       fs          = 0.0f;
+
+    if  (   ( NULL != p_rate_inst )
+        &&  ( NULL != p_ch )
+        &&  ( num_of_ch > 0UL )
+        &&  ( NULL != p_cfg )
+        &&  ( p_cfg->base_fs > 0.0f )
+        &&  (( NULL == p_cfg->pf_time_get ) || ( p_cfg->time_freq > 0.0f )))
+    {
+        p_divider = malloc( num_of_ch * sizeof( uint32_t ));
+
+        // Validate channels and calculate dividers
+        for ( uint32_t i = 0U; ( i < num_of_ch ) && ( NULL != p_divider ); i++ )
+        {
+            if ( eFILTER_OK != filter_rate_ch_check( &p_ch[i] ))
+            {
+                status = eFILTER_ERROR;
+            }
+            else
+            {
+                status |= filter_rate_fs_resolve( &p_ch[i], &fs );
+                status |= filter_rate_divider_calc( fs, p_cfg->base_fs, &p_divider[i] );
+            }
+        }
+
+        if  (   ( eFILTER_OK == status )
+            &&  ( NULL != p_divider ))
+        {
+            // Allocate space
+            *p_rate_inst = malloc( sizeof( filter_rate_t ));
+
+            if ( NULL != *p_rate_inst )
+            {
+                (*p_rate_inst)->p_group = malloc( num_of_ch * sizeof( filter_rate_group_t ));
+                (*p_rate_inst)->is_init = false;
+            }
+
+            // Check if allocation succeed
+            if  (   ( NULL != *p_rate_inst )
+                &&  ( NULL != (*p_rate_inst)->p_group ))
+            {
+                filter_rate_t * const       p_rate      = *p_rate_inst;
+                filter_rate_ch_t * const    p_ch_grp    = malloc( num_of_ch * sizeof( filter_rate_ch_t ));
+                uint32_t                    divider     = 0U;
+                uint32_t                    start       = 0U;
+
+                if ( NULL != p_ch_grp )
+                {
+                    p_rate->cfg             = *p_cfg;
+                    p_rate->num_of_groups   = 0U;
+
+                    // Create groups from smallest divider (highest rate) up
+                    while ( start < num_of_ch )
+                    {
+                        filter_rate_group_t * const p_group = &p_rate->p_group[ p_rate->num_of_groups ];
+                        uint32_t                    next    = UINT32_MAX;
+
+                        // Next smallest divider
+                        for ( uint32_t i = 0U; i < num_of_ch; i++ )
+                        {
+                            if  (   ( p_divider[i] > divider )
+                                &&  ( p_divider[i] < next ))
+                            {
+                                next = p_divider[i];
+                            }
+                        }
+
+                        divider = next;
+
+                        p_group->p_ch               = &p_ch_grp[start];
+                        p_group->divider            = divider;
+                        p_group->cnt                = 0U;
+                        p_group->stats.fs           = ( p_cfg->base_fs / (float32_t) divider );
+                        p_group->stats.num_of_ch    = 0U;
+                        p_group->deadline           = (uint32_t) (( p_cfg->time_freq * (float32_t) divider ) / p_cfg->base_fs );
+
+                        // Lay out group channels contiguously
+                        for ( uint32_t i = 0U; i < num_of_ch; i++ )
+                        {
+                            if ( divider == p_divider[i] )
+                            {
+                                p_ch_grp[start] = p_ch[i];
+                                p_group->stats.num_of_ch++;
+                                start++;
+                            }
+                        }
+
+                        p_rate->num_of_groups++;
+                    }
+
+                    // Init success
+                    p_rate->is_init = true;
+
+                    (void) filter_rate_stats_clear( p_rate );
+                }
+                else
+                {
+                    status = eFILTER_ERROR;
+                }
+            }
+            else
+            {
+                status = eFILTER_ERROR;
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+
+        free( p_divider );
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get initialization status of multi-rate scheduler
+*
+* @param[in]    rate_inst   - Multi-rate scheduler instance
+* @param[out]   p_is_init   - Multi-rate scheduler init state
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_rate_is_init(p_filter_rate_t rate_inst, bool * const p_is_init)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != rate_inst )
+        &&  ( NULL != p_is_init ))
+    {
+        *p_is_init = rate_inst->is_init;
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Handle multi-rate scheduler
+*
+* @note     This function must be called in equidistant time period defined
+*           by 1/base_fs! All groups are due on first call.
+*
+* @param[in]    rate_inst   - Multi-rate scheduler instance
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_rate_hndl(p_filter_rate_t rate_inst)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if ( NULL != rate_inst )
+    {
+        // Is instance init?
+        if ( true == rate_inst->is_init )
+        {
+            const bool      is_timed    = ( NULL != rate_inst->cfg.pf_time_get );
+            const uint32_t  tick_start  = (( true == is_timed ) ? rate_inst->cfg.pf_time_get() : 0U );
+
+            for ( uint32_t g = 0U; g < rate_inst->num_of_groups; g++ )
+            {
+                filter_rate_group_t * const p_group = &rate_inst->p_group[g];
+
+                // Group is due
+                if ( 0U == p_group->cnt )
+                {
+                    filter_rate_group_run( p_group );
+                    p_group->stats.num_of_runs++;
+
+                    if ( true == is_timed )
+                    {
+                        const uint32_t time = ( rate_inst->cfg.pf_time_get() - tick_start );
+
+                        if ( time > p_group->stats.time_max )
+                        {
+                            p_group->stats.time_max = time;
+                        }
+
+                        if ( time > p_group->deadline )
+                        {
+                            p_group->stats.num_of_overruns++;
+                        }
+                    }
+                }
+
+                p_group->cnt++;
+
+                if ( p_group->cnt >= p_group->divider )
+                {
+                    p_group->cnt = 0U;
+                }
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get number of multi-rate scheduler groups
+*
+* @param[in]    rate_inst       - Multi-rate scheduler instance
+* @param[out]   p_num_of_groups - Number of groups (distinct rates)
+* @return       status          - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_rate_group_num_get(p_filter_rate_t rate_inst, uint32_t * const p_num_of_groups)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != rate_inst )
+        &&  ( NULL != p_num_of_groups ))
+    {
+        // Is instance init?
+        if ( true == rate_inst->is_init )
+        {
+            *p_num_of_groups = rate_inst->num_of_groups;
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get multi-rate scheduler group statistics
+*
+* @note     Groups are ordered from highest to lowest rate.
+*
+* @param[in]    rate_inst   - Multi-rate scheduler instance
+* @param[in]    group       - Group index
+* @param[out]   p_stats     - Group statistics
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_rate_stats_get(p_filter_rate_t rate_inst, const uint32_t group, filter_rate_stats_t * const p_stats)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != rate_inst )
+        &&  ( NULL != p_stats ))
+    {
+        // Is instance init?
+        if  (   ( true == rate_inst->is_init )
+            &&  ( group < rate_inst->num_of_groups ))
+        {
+            *p_stats = rate_inst->p_group[group].stats;
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Clear multi-rate scheduler statistics
+*
+* @param[in]    rate_inst   - Multi-rate scheduler instance
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_rate_stats_clear(p_filter_rate_t rate_inst)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if ( NULL != rate_inst )
+    {
+        // Is instance init?
+        if ( true == rate_inst->is_init )
+        {
+            for ( uint32_t g = 0U; g < rate_inst->num_of_groups; g++ )
+            {
+                rate_inst->p_group[g].stats.num_of_runs     = 0U;
+                rate_inst->p_group[g].stats.num_of_overruns = 0U;
+                rate_inst->p_group[g].stats.time_max        = 0U;
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,100 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      filter_rate.h
+*@brief     Multi-rate tick scheduler for filters
+*@author    Ziga Miklosic
+*@date      17.10.2026
+*@version   V2.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FILTER_RATE_API
+* @{ <!-- BEGIN GROUP -->
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __FILTER_RATE_H
+#define __FILTER_RATE_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "filter.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Multi-rate scheduler instance type
+ */
+typedef struct filter_rate_s * p_filter_rate_t;
+
+/**
+ *  Multi-rate scheduler channel
+ *
+ * @note    Exactly one of filter, rc_bank or cr_bank must be set. Filter
+ *          bank channel is executed with single (SoA) bank handler call,
+ *          input and output then point to arrays of bank channel samples.
+ *
+ * @note    Input is read and output written only when filter is due.
+ *
+ * @note    Sampling frequency must match sampling frequency of filter
+ *          instance, when generic filter interface provides it.
+ */
+typedef struct
+{
+    p_filter_t          filter;     /**<Generic filter (NULL if bank is used) */
+    p_filter_rc_bank_t  rc_bank;    /**<RC filter bank (NULL if not used) */
+    p_filter_cr_bank_t  cr_bank;    /**<CR filter bank (NULL if not used) */
+    const float32_t   * p_in;       /**<Input sample (bank: input samples of all bank channels) */
+    float32_t         * p_out;      /**<Output sample (bank: output samples of all bank channels) */
+    float32_t           fs;         /**<Filter sampling frequency, must be integer fraction of base frequency (0 - take from filter) */
+} filter_rate_ch_t;
+
+/**
+ *  Multi-rate scheduler configuration
+ */
+typedef struct
+{
+    float32_t   base_fs;                    /**<Base tick frequency */
+    uint32_t    (*pf_time_get)  (void);     /**<Get time, free running counter (can be NULL, no overrun detection) */
+    float32_t   time_freq;                  /**<Time counter frequency, e.g. 1e6 for us */
+} filter_rate_cfg_t;
+
+/**
+ *  Multi-rate scheduler group statistics
+ */
+typedef struct
+{
+    float32_t   fs;                 /**<Group sampling frequency */
+    uint32_t    num_of_ch;          /**<Number of channels in group (filter bank counts as one) */
+    uint32_t    num_of_runs;        /**<Number of group executions */
+    uint32_t    num_of_overruns;    /**<Number of executions finished after group period since tick start */
+    uint32_t    time_max;           /**<Max. time from tick start to group finish in time counter units */
+} filter_rate_stats_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_rate_init            (p_filter_rate_t * p_rate_inst, const filter_rate_ch_t * const p_ch, const uint32_t num_of_ch, const filter_rate_cfg_t * const p_cfg);
+filter_status_t filter_rate_is_init         (p_filter_rate_t rate_inst, bool * const p_is_init);
+filter_status_t filter_rate_hndl            (p_filter_rate_t rate_inst);
+filter_status_t filter_rate_group_num_get   (p_filter_rate_t rate_inst, uint32_t * const p_num_of_groups);
+filter_status_t filter_rate_stats_get       (p_filter_rate_t rate_inst, const uint32_t group, filter_rate_stats_t * const p_stats);
+filter_status_t filter_rate_stats_clear     (p_filter_rate_t rate_inst);
+
+#endif // __FILTER_RATE_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
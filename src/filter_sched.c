@@ -0,0 +1,673 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      filter_sched.c
+*@brief     Work-stealing scheduler for multichannel filter workloads
+*@author    Ziga Miklosic
+*@date      17.10.2026
+*@version   V2.1.0
+*
+*@section   Description
+*
+*   Scheduler runs large set of independent filter jobs every tick on
+*   multiple threads. Jobs are grouped into chunks of similar estimated
+*   cost and distributed to per-worker deques. Worker first processes its
+*   own chunks and then steals chunks from other workers, so uneven
+*   filter costs do not leave threads idle.
+*
+*   Module is OS agnostic: threads are created by user, each of them
+*   calls "filter_sched_worker_run()" with its own worker number, while
+*   thread calling "filter_sched_tick()" acts as worker 0.
+*
+*@section     Dependencies
+*
+*     C11 atomics (stdatomic.h).
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup FILTER_SCHED
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "filter_sched.h"
+#include <stdlib.h>
+#include <stdatomic.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Cache line size, used to keep atomics of different owners apart
+ */
+#define FILTER_SCHED_CACHE_LINE             ( 64U )
+
+/**
+ *  Number of chunks per worker
+ *
+ * @note    More chunks gives better balance, less chunks lower overhead.
+ */
+#define FILTER_SCHED_CHUNKS_PER_WORKER      ( 4U )
+
+/**
+ *     Worker deque (Chase-Lev)
+ *
+ * @note    Deque is filled at start of each tick while all workers are
+ *          idle, so during tick only owner pops from bottom and thieves
+ *          steal from top.
+ */
+typedef struct
+{
+    _Atomic int32_t     top;                                                /**<Steal end */
+    uint8_t             pad_top[ FILTER_SCHED_CACHE_LINE - sizeof( int32_t )];
+    _Atomic int32_t     bottom;                                             /**<Owner end */
+    uint8_t             pad_bottom[ FILTER_SCHED_CACHE_LINE - sizeof( int32_t )];
+    uint32_t          * p_chunk;                                            /**<Chunks owned by worker */
+    uint32_t            num_of_chunks;                                      /**<Number of owned chunks */
+} filter_sched_deque_t;
+
+/**
+ *     Filter scheduler data
+ */
+typedef struct filter_sched_s
+{
+    _Atomic uint32_t        epoch;                                          /**<Tick counter, published to workers */
+    uint8_t                 pad_epoch[ FILTER_SCHED_CACHE_LINE - sizeof( uint32_t )];
+    _Atomic uint32_t        remaining;                                      /**<Chunks not yet done in current tick */
+    uint8_t                 pad_remaining[ FILTER_SCHED_CACHE_LINE - sizeof( uint32_t )];
+    _Atomic uint32_t        active;                                         /**<Number of workers inside tick */
+    _Atomic bool            stop;                                           /**<Stop request */
+    filter_sched_job_t    * p_job;                                          /**<Jobs */
+    uint32_t              * p_chunk_first;                                  /**<First job of chunk */
+    uint32_t              * p_chunk_end;                                    /**<Job after last job of chunk */
+    uint32_t              * p_chunk_order;                                  /**<Chunks grouped by worker */
+    filter_sched_deque_t  * p_deque;                                        /**<Worker deques */
+    filter_sched_cfg_t      cfg;                                            /**<Configuration */
+    uint32_t                num_of_jobs;                                    /**<Number of jobs */
+    uint32_t                num_of_chunks;                                  /**<Number of chunks */
+    bool                    is_init;                                        /**<Scheduler initialization success flag */
+} filter_sched_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static uint64_t         filter_sched_job_cost   (const filter_sched_job_t * const p_job);
+static filter_status_t  filter_sched_chunk      (filter_sched_t * const p_sched);
+static bool             filter_sched_pop        (filter_sched_deque_t * const p_deque, uint32_t * const p_chunk);
+static bool             filter_sched_steal      (filter_sched_deque_t * const p_deque, uint32_t * const p_chunk);
+static void             filter_sched_work       (filter_sched_t * const p_sched, const uint32_t worker);
+static void             filter_sched_idle       (const filter_sched_t * const p_sched);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Estimate job cost
+*
+* @brief    Cost per sample is estimated from filter state size, as number
+*           of states approximately equals to number of multiply-adds per
+*           sample (RC: 1, FIR: number of taps, IIR: poles + zeros).
+*
+* @param[in]    p_job   - Job
+* @return       cost    - Estimated cost per tick
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint64_t filter_sched_job_cost(const filter_sched_job_t * const p_job)
+{
+    uint32_t state_size = 0U;
+
+    (void) filter_state_size_get( p_job->filter, &state_size );
+
+    return ((uint64_t) p_job->size * ( 1U + ( state_size / sizeof( float32_t ))));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Group jobs into chunks and distribute them to workers
+*
+* @brief    Consecutive jobs are grouped into chunks of approximately
+*           total_cost / ( num_of_workers * FILTER_SCHED_CHUNKS_PER_WORKER ).
+*           Each chunk is then given to worker with lowest cost so far.
+*
+* @param[in]    p_sched - Scheduler
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static filter_status_t filter_sched_chunk(filter_sched_t * const p_sched)
+{
+    filter_status_t     status          = eFILTER_OK;
+    const uint32_t      num_of_workers  = p_sched->cfg.num_of_workers;
+    uint64_t          * p_job_cost      = malloc( p_sched->num_of_jobs * sizeof( uint64_t ));
+    uint64_t          * p_worker_cost   = malloc( num_of_workers * sizeof( uint64_t ));
+    uint32_t          * p_chunk_worker  = malloc( p_sched->num_of_jobs * sizeof( uint32_t ));
+    uint64_t            total           = 0U;
+    uint64_t            target          = 0U;
+    uint64_t            acc             = 0U;
+
+    if  (   ( NULL != p_job_cost )
+        &&  ( NULL != p_worker_cost )
+        &&  ( NULL != p_chunk_worker ))
+    {
+        for ( uint32_t j = 0U; j < p_sched->num_of_jobs; j++ )
+        {
+            p_job_cost[j] = filter_sched_job_cost( &p_sched->p_job[j] );
+            total += p_job_cost[j];
+        }
+
+        target = ( total / ( num_of_workers * FILTER_SCHED_CHUNKS_PER_WORKER ));
+        target = (( target > 0U ) ? target : 1U );
+
+        for ( uint32_t w = 0U; w < num_of_workers; w++ )
+        {
+            p_worker_cost[w]                = 0U;
+            p_sched->p_deque[w].num_of_chunks = 0U;
+        }
+
+        // Group consecutive jobs
+        p_sched->num_of_chunks = 0U;
+
+        for ( uint32_t j = 0U; j < p_sched->num_of_jobs; j++ )
+        {
+            if ( 0U == acc )
+            {
+                p_sched->p_chunk_first[ p_sched->num_of_chunks ] = j;
+            }
+
+            acc += p_job_cost[j];
+
+            if  (   ( acc >= target )
+                ||  (( j + 1U ) == p_sched->num_of_jobs ))
+            {
+                uint32_t worker = 0U;
+
+                // Give chunk to least loaded worker
+                for ( uint32_t w = 1U; w < num_of_workers; w++ )
+                {
+                    if ( p_worker_cost[w] < p_worker_cost[worker] )
+                    {
+                        worker = w;
+                    }
+                }
+
+                p_worker_cost[worker] += acc;
+                p_sched->p_deque[worker].num_of_chunks++;
+                p_chunk_worker[ p_sched->num_of_chunks ]        = worker;
+                p_sched->p_chunk_end[ p_sched->num_of_chunks ]  = ( j + 1U );
+                p_sched->num_of_chunks++;
+                acc = 0U;
+            }
+        }
+
+        // Lay out chunks of each worker contiguously
+        for ( uint32_t w = 0U, start = 0U; w < num_of_workers; w++ )
+        {
+            p_sched->p_deque[w].p_chunk = &p_sched->p_chunk_order[start];
+            start += p_sched->p_deque[w].num_of_chunks;
+            p_sched->p_deque[w].num_of_chunks = 0U;
+        }
+
+        for ( uint32_t c = 0U; c < p_sched->num_of_chunks; c++ )
+        {
+            filter_sched_deque_t * const p_deque = &p_sched->p_deque[ p_chunk_worker[c] ];
+
+            p_deque->p_chunk[ p_deque->num_of_chunks ] = c;
+            p_deque->num_of_chunks++;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    free( p_job_cost );
+    free( p_worker_cost );
+    free( p_chunk_worker );
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Pop chunk from own deque
+*
+* @note     Only owner of deque can pop!
+*
+* @param[in]    p_deque - Worker deque
+* @param[out]   p_chunk - Chunk index
+* @return       found   - Chunk taken
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool filter_sched_pop(filter_sched_deque_t * const p_deque, uint32_t * const p_chunk)
+{
+    bool            found   = false;
+    const int32_t   b       = ( atomic_load_explicit( &p_deque->bottom, memory_order_relaxed ) - 1 );
+    int32_t         t       = 0;
+
+    atomic_store_explicit( &p_deque->bottom, b, memory_order_relaxed );
+    atomic_thread_fence( memory_order_seq_cst );
+    t = atomic_load_explicit( &p_deque->top, memory_order_relaxed );
+
+    if ( t <= b )
+    {
+        *p_chunk    = p_deque->p_chunk[b];
+        found       = true;
+
+        // Last chunk, race against thieves
+        if ( t == b )
+        {
+            found = atomic_compare_exchange_strong_explicit( &p_deque->top, &t, ( t + 1 ), memory_order_seq_cst, memory_order_relaxed );
+            atomic_store_explicit( &p_deque->bottom, ( b + 1 ), memory_order_relaxed );
+        }
+    }
+    else
+    {
+        // Empty
+        atomic_store_explicit( &p_deque->bottom, ( b + 1 ), memory_order_relaxed );
+    }
+
+    return found;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Steal chunk from other worker deque
+*
+* @param[in]    p_deque - Other worker deque
+* @param[out]   p_chunk - Chunk index
+* @return       found   - Chunk taken
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool filter_sched_steal(filter_sched_deque_t * const p_deque, uint32_t * const p_chunk)
+{
+    bool    found   = false;
+    int32_t t       = atomic_load_explicit( &p_deque->top, memory_order_acquire );
+    int32_t b       = 0;
+
+    atomic_thread_fence( memory_order_seq_cst );
+    b = atomic_load_explicit( &p_deque->bottom, memory_order_acquire );
+
+    if ( t < b )
+    {
+        // Chunk list is not changed during tick, can be read before claim
+        *p_chunk    = p_deque->p_chunk[t];
+        found       = atomic_compare_exchange_strong_explicit( &p_deque->top, &t, ( t + 1 ), memory_order_seq_cst, memory_order_relaxed );
+    }
+
+    return found;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Process chunks of current tick until all are done
+*
+* @param[in]    p_sched - Scheduler
+* @param[in]    worker  - Worker number
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void filter_sched_work(filter_sched_t * const p_sched, const uint32_t worker)
+{
+    const uint32_t num_of_workers = p_sched->cfg.num_of_workers;
+
+    while ( atomic_load( &p_sched->remaining ) > 0U )
+    {
+        uint32_t    chunk   = 0U;
+        bool        found   = filter_sched_pop( &p_sched->p_deque[worker], &chunk );
+
+        // Steal from others
+        for ( uint32_t i = 1U; ( false == found ) && ( i < num_of_workers ); i++ )
+        {
+            found = filter_sched_steal( &p_sched->p_deque[ ( worker + i ) % num_of_workers ], &chunk );
+        }
+
+        if ( true == found )
+        {
+            for ( uint32_t j = p_sched->p_chunk_first[chunk]; j < p_sched->p_chunk_end[chunk]; j++ )
+            {
+                const filter_sched_job_t * const p_job = &p_sched->p_job[j];
+
+                (void) filter_hndl_block( p_job->filter, p_job->p_in, p_job->p_out, p_job->size );
+            }
+
+            // Last chunk of tick
+            if  (   ( 1U == atomic_fetch_sub( &p_sched->remaining, 1U ))
+                &&  ( NULL != p_sched->cfg.pf_tick_done ))
+            {
+                p_sched->cfg.pf_tick_done( p_sched->cfg.p_arg, atomic_load( &p_sched->epoch ));
+            }
+        }
+        else
+        {
+            // Remaining chunks are in progress on other workers
+            filter_sched_idle( p_sched );
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Wait for work
+*
+* @param[in]    p_sched - Scheduler
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void filter_sched_idle(const filter_sched_t * const p_sched)
+{
+    if ( NULL != p_sched->cfg.pf_idle )
+    {
+        p_sched->cfg.pf_idle();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FILTER_SCHED_API
+* @{ <!-- BEGIN GROUP -->
+*
+*   Following function are part of filter scheduler API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*   Initialize filter scheduler
+*
+* @note     Jobs are copied, chunking is done once at initialization based
+*           on estimated job costs.
+*
+* @note     Same generic filter shall not be used by more than one job!
+*
+* @param[in]    p_sched_inst    - Pointer to filter scheduler instance
+* @param[in]    p_job           - List of jobs
+* @param[in]    num_of_jobs     - Number of jobs
+* @param[in]    p_cfg           - Scheduler configuration
+* @return       status          - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_sched_init(p_filter_sched_t * p_sched_inst, const filter_sched_job_t * const p_job, const uint32_t num_of_jobs, const filter_sched_cfg_t * const p_cfg)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != p_sched_inst )
+        &&  ( NULL != p_job )
+        &&  ( num_of_jobs > 0UL )
+        &&  ( NULL != p_cfg )
+        &&  ( p_cfg->num_of_workers > 0UL ))
+    {
+        // All jobs must be valid
+        for ( uint32_t j = 0U; j < num_of_jobs; j++ )
+        {
+            if  (   ( NULL == p_job[j].filter )
+                ||  ( NULL == p_job[j].p_in )
+                ||  ( NULL == p_job[j].p_out ))
+            {
+                status = eFILTER_ERROR;
+            }
+        }
+
+        if ( eFILTER_OK == status )
+        {
+            // Allocate space
+            *p_sched_inst = malloc( sizeof( filter_sched_t ));
+
+            if ( NULL != *p_sched_inst )
+            {
+                (*p_sched_inst)->p_job          = malloc( num_of_jobs * sizeof( filter_sched_job_t ));
+                (*p_sched_inst)->p_chunk_first  = malloc( num_of_jobs * sizeof( uint32_t ));
+                (*p_sched_inst)->p_chunk_end    = malloc( num_of_jobs * sizeof( uint32_t ));
+                (*p_sched_inst)->p_chunk_order  = malloc( num_of_jobs * sizeof( uint32_t ));
+                (*p_sched_inst)->p_deque        = malloc( p_cfg->num_of_workers * sizeof( filter_sched_deque_t ));
+                (*p_sched_inst)->is_init        = false;
+            }
+
+            // Check if allocation succeed
+            if  (   ( NULL != *p_sched_inst )
+                &&  ( NULL != (*p_sched_inst)->p_job )
+                &&  ( NULL != (*p_sched_inst)->p_chunk_first )
+                &&  ( NULL != (*p_sched_inst)->p_chunk_end )
+                &&  ( NULL != (*p_sched_inst)->p_chunk_order )
+                &&  ( NULL != (*p_sched_inst)->p_deque ))
+            {
+                for ( uint32_t j = 0U; j < num_of_jobs; j++ )
+                {
+                    (*p_sched_inst)->p_job[j] = p_job[j];
+                }
+
+                (*p_sched_inst)->cfg            = *p_cfg;
+                (*p_sched_inst)->num_of_jobs    = num_of_jobs;
+
+                atomic_init( &(*p_sched_inst)->epoch, 0U );
+                atomic_init( &(*p_sched_inst)->remaining, 0U );
+                atomic_init( &(*p_sched_inst)->active, 0U );
+                atomic_init( &(*p_sched_inst)->stop, false );
+
+                for ( uint32_t w = 0U; w < p_cfg->num_of_workers; w++ )
+                {
+                    atomic_init( &(*p_sched_inst)->p_deque[w].top, 0 );
+                    atomic_init( &(*p_sched_inst)->p_deque[w].bottom, 0 );
+                }
+
+                // Group jobs and distribute to workers
+                status = filter_sched_chunk( *p_sched_inst );
+
+                if ( eFILTER_OK == status )
+                {
+                    // Init success
+                    (*p_sched_inst)->is_init = true;
+                }
+            }
+            else
+            {
+                status = eFILTER_ERROR;
+            }
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get initialization status of filter scheduler
+*
+* @param[in]    sched_inst  - Filter scheduler instance
+* @param[out]   p_is_init   - Filter scheduler init state
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_sched_is_init(p_filter_sched_t sched_inst, bool * const p_is_init)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != sched_inst )
+        &&  ( NULL != p_is_init ))
+    {
+        *p_is_init = sched_inst->is_init;
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Run one tick of filter scheduler
+*
+* @brief    Publishes all jobs to workers and takes part in processing as
+*           worker 0. Function returns when all jobs of tick are done.
+*           Tick done callback is called by thread finishing last chunk.
+*
+* @note     Must be called from single thread only!
+*
+* @param[in]    sched_inst  - Filter scheduler instance
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_sched_tick(p_filter_sched_t sched_inst)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if ( NULL != sched_inst )
+    {
+        // Is instance init?
+        if ( true == sched_inst->is_init )
+        {
+            // Wait for workers to leave previous tick
+            while ( atomic_load( &sched_inst->active ) > 0U )
+            {
+                filter_sched_idle( sched_inst );
+            }
+
+            // Refill deques
+            for ( uint32_t w = 0U; w < sched_inst->cfg.num_of_workers; w++ )
+            {
+                atomic_store_explicit( &sched_inst->p_deque[w].top, 0, memory_order_relaxed );
+                atomic_store_explicit( &sched_inst->p_deque[w].bottom, (int32_t) sched_inst->p_deque[w].num_of_chunks, memory_order_relaxed );
+            }
+
+            // Publish tick
+            atomic_store( &sched_inst->remaining, sched_inst->num_of_chunks );
+            (void) atomic_fetch_add( &sched_inst->epoch, 1U );
+
+            filter_sched_work( sched_inst, 0U );
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Run filter scheduler worker
+*
+* @brief    Worker loop, to be called from user created thread. Worker
+*           waits for tick, processes chunks (own and stolen) and waits
+*           for next tick. Function returns after "filter_sched_stop()".
+*
+* @note     Worker numbers are from 1 to num_of_workers-1, worker 0 is
+*           thread calling "filter_sched_tick()".
+*
+* @param[in]    sched_inst  - Filter scheduler instance
+* @param[in]    worker      - Worker number
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_sched_worker_run(p_filter_sched_t sched_inst, const uint32_t worker)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != sched_inst )
+        &&  ( worker > 0U ))
+    {
+        // Is instance init?
+        if  (   ( true == sched_inst->is_init )
+            &&  ( worker < sched_inst->cfg.num_of_workers ))
+        {
+            uint32_t epoch = atomic_load( &sched_inst->epoch );
+
+            while ( false == atomic_load_explicit( &sched_inst->stop, memory_order_relaxed ))
+            {
+                const uint32_t epoch_new = atomic_load( &sched_inst->epoch );
+
+                if ( epoch_new != epoch )
+                {
+                    epoch = epoch_new;
+
+                    (void) atomic_fetch_add( &sched_inst->active, 1U );
+                    filter_sched_work( sched_inst, worker );
+                    (void) atomic_fetch_sub( &sched_inst->active, 1U );
+                }
+                else
+                {
+                    filter_sched_idle( sched_inst );
+                }
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Stop filter scheduler workers
+*
+* @note     Workers return from "filter_sched_worker_run()" after finishing
+*           current tick.
+*
+* @param[in]    sched_inst  - Filter scheduler instance
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_sched_stop(p_filter_sched_t sched_inst)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if ( NULL != sched_inst )
+    {
+        // Is instance init?
+        if ( true == sched_inst->is_init )
+        {
+            atomic_store( &sched_inst->stop, true );
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
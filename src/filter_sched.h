@@ -0,0 +1,80 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      filter_sched.h
+*@brief     Work-stealing scheduler for multichannel filter workloads
+*@author    Ziga Miklosic
+*@date      17.10.2026
+*@version   V2.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FILTER_SCHED_API
+* @{ <!-- BEGIN GROUP -->
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __FILTER_SCHED_H
+#define __FILTER_SCHED_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "filter.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Filter scheduler instance type
+ */
+typedef struct filter_sched_s * p_filter_sched_t;
+
+/**
+ *  Filter scheduler job
+ *
+ * @note    Input and output buffers are processed every tick, user shall
+ *          fill inputs before "filter_sched_tick()".
+ */
+typedef struct
+{
+    p_filter_t          filter;     /**<Generic filter */
+    const float32_t   * p_in;       /**<Input samples */
+    float32_t         * p_out;      /**<Output samples */
+    uint32_t            size;       /**<Number of samples per tick */
+} filter_sched_job_t;
+
+/**
+ *  Filter scheduler configuration
+ */
+typedef struct
+{
+    uint32_t    num_of_workers;                                 /**<Number of workers, including thread calling "filter_sched_tick()" */
+    void        (*pf_idle)      (void);                         /**<Called while waiting for work, e.g. thread yield (can be NULL) */
+    void        (*pf_tick_done) (void * p_arg, const uint32_t tick); /**<Called once all jobs of tick are done (can be NULL) */
+    void      * p_arg;                                          /**<Argument of tick done callback */
+} filter_sched_cfg_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_sched_init       (p_filter_sched_t * p_sched_inst, const filter_sched_job_t * const p_job, const uint32_t num_of_jobs, const filter_sched_cfg_t * const p_cfg);
+filter_status_t filter_sched_is_init    (p_filter_sched_t sched_inst, bool * const p_is_init);
+filter_status_t filter_sched_tick       (p_filter_sched_t sched_inst);
+filter_status_t filter_sched_worker_run (p_filter_sched_t sched_inst, const uint32_t worker);
+filter_status_t filter_sched_stop       (p_filter_sched_t sched_inst);
+
+#endif // __FILTER_SCHED_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
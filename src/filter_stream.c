@@ -0,0 +1,565 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      filter_stream.c
+*@brief     Lock-free streaming front end for filters
+*@author    Ziga Miklosic
+*@date      17.10.2026
+*@version   V2.1.0
+*
+*@section   Description
+*
+*   Stream decouples sample acquisition from filtering. Producer pushes
+*   raw samples into input ring without blocking, filter worker processes
+*   them in blocks into output ring and consumer pops filtered samples.
+*
+*   Both rings are single-producer/single-consumer: input ring is written
+*   by producer and read by worker, output ring is written by worker and
+*   read by consumer. Indices are free running, owned by one side only
+*   and placed on separate cache lines. Each side keeps a cached copy of
+*   the opposite index, so shared index is read only when cached one
+*   runs out of space/data.
+*
+*@section     Dependencies
+*
+*     C11 atomics (stdatomic.h).
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup FILTER_STREAM
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "filter_stream.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Cache line size, used to keep indices of producer and consumer apart
+ */
+#define FILTER_STREAM_CACHE_LINE            ( 64U )
+
+/**
+ *     SPSC ring
+ */
+typedef struct
+{
+    _Atomic uint32_t    head;                                               /**<Write index, owned by writer */
+    uint32_t            tail_cache;                                         /**<Writer copy of read index */
+    uint8_t             pad_head[ FILTER_STREAM_CACHE_LINE - ( 2U * sizeof( uint32_t ))];
+    _Atomic uint32_t    tail;                                               /**<Read index, owned by reader */
+    uint32_t            head_cache;                                         /**<Reader copy of write index */
+    uint8_t             pad_tail[ FILTER_STREAM_CACHE_LINE - ( 2U * sizeof( uint32_t ))];
+    float32_t         * p_buf;                                              /**<Samples */
+    uint32_t            size;                                               /**<Size of ring in samples */
+    uint32_t            mask;                                               /**<Index mask */
+} filter_stream_ring_t;
+
+/**
+ *     Filter stream data
+ */
+typedef struct filter_stream_s
+{
+    filter_stream_ring_t    in;                                             /**<Input ring (producer -> worker) */
+    filter_stream_ring_t    out;                                            /**<Output ring (worker -> consumer) */
+    filter_stream_cfg_t     cfg;                                            /**<Configuration */
+    uint32_t                pending;                                        /**<Pushed samples since last worker wake up */
+    bool                    is_init;                                        /**<Stream initialization success flag */
+} filter_stream_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static filter_status_t  filter_stream_ring_init     (filter_stream_ring_t * const p_ring, const uint32_t size);
+static uint32_t         filter_stream_ring_free     (filter_stream_ring_t * const p_ring, const uint32_t size);
+static uint32_t         filter_stream_ring_used     (filter_stream_ring_t * const p_ring, const uint32_t size);
+static void             filter_stream_ring_copy     (float32_t * const p_dst, const float32_t * const p_src, const uint32_t size);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Initialize SPSC ring
+*
+* @param[in]    p_ring  - Ring
+* @param[in]    size    - Ring size in samples, power of 2
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static filter_status_t filter_stream_ring_init(filter_stream_ring_t * const p_ring, const uint32_t size)
+{
+    filter_status_t status = eFILTER_OK;
+
+    p_ring->p_buf = malloc( size * sizeof( float32_t ));
+
+    if ( NULL != p_ring->p_buf )
+    {
+        atomic_init( &p_ring->head, 0U );
+        atomic_init( &p_ring->tail, 0U );
+
+        p_ring->tail_cache  = 0U;
+        p_ring->head_cache  = 0U;
+        p_ring->size        = size;
+        p_ring->mask        = ( size - 1U );
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get free space of ring (writer side)
+*
+* @note     Read index of reader is loaded only if cached copy does not
+*           give enough space.
+*
+* @param[in]    p_ring  - Ring
+* @param[in]    size    - Requested number of samples
+* @return       free    - Number of free samples
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t filter_stream_ring_free(filter_stream_ring_t * const p_ring, const uint32_t size)
+{
+    const uint32_t  head    = atomic_load_explicit( &p_ring->head, memory_order_relaxed );
+    uint32_t        free    = ( p_ring->size - ( head - p_ring->tail_cache ));
+
+    if ( free < size )
+    {
+        p_ring->tail_cache  = atomic_load_explicit( &p_ring->tail, memory_order_acquire );
+        free                = ( p_ring->size - ( head - p_ring->tail_cache ));
+    }
+
+    return free;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get number of samples in ring (reader side)
+*
+* @note     Write index of writer is loaded only if cached copy does not
+*           give enough samples.
+*
+* @param[in]    p_ring  - Ring
+* @param[in]    size    - Requested number of samples
+* @return       used    - Number of available samples
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t filter_stream_ring_used(filter_stream_ring_t * const p_ring, const uint32_t size)
+{
+    const uint32_t  tail    = atomic_load_explicit( &p_ring->tail, memory_order_relaxed );
+    uint32_t        used    = ( p_ring->head_cache - tail );
+
+    if ( used < size )
+    {
+        p_ring->head_cache  = atomic_load_explicit( &p_ring->head, memory_order_acquire );
+        used                = ( p_ring->head_cache - tail );
+    }
+
+    return used;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Copy samples
+*
+* @param[in]    p_dst   - Destination
+* @param[in]    p_src   - Source
+* @param[in]    size    - Number of samples
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void filter_stream_ring_copy(float32_t * const p_dst, const float32_t * const p_src, const uint32_t size)
+{
+    if ( size > 0U )
+    {
+        memcpy( p_dst, p_src, ( size * sizeof( float32_t )));
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FILTER_STREAM_API
+* @{ <!-- BEGIN GROUP -->
+*
+*   Following function are part of filter stream API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*   Initialize filter stream
+*
+* @note     Worker wake up threshold must not be larger than ring size,
+*           otherwise producer could fill the ring without waking worker.
+*
+* @param[in]    p_stream_inst   - Pointer to filter stream instance
+* @param[in]    p_cfg           - Stream configuration
+* @return       status          - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_stream_init(p_filter_stream_t * p_stream_inst, const filter_stream_cfg_t * const p_cfg)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != p_stream_inst )
+        &&  ( NULL != p_cfg )
+        &&  ( NULL != p_cfg->filter )
+        &&  ( p_cfg->size > 0UL )
+        &&  ( 0UL == ( p_cfg->size & ( p_cfg->size - 1UL )))
+        &&  ( p_cfg->block_size > 0UL )
+        &&  ( p_cfg->wake_thr > 0UL )
+        &&  ( p_cfg->wake_thr <= p_cfg->size ))
+    {
+        // Allocate space
+        *p_stream_inst = malloc( sizeof( filter_stream_t ));
+
+        // Check if allocation succeed
+        if ( NULL != *p_stream_inst )
+        {
+            (*p_stream_inst)->is_init = false;
+
+            status |= filter_stream_ring_init( &(*p_stream_inst)->in, p_cfg->size );
+            status |= filter_stream_ring_init( &(*p_stream_inst)->out, p_cfg->size );
+
+            if ( eFILTER_OK == status )
+            {
+                (*p_stream_inst)->cfg       = *p_cfg;
+                (*p_stream_inst)->pending   = 0U;
+
+                // Init success
+                (*p_stream_inst)->is_init = true;
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get initialization status of filter stream
+*
+* @param[in]    stream_inst - Filter stream instance
+* @param[out]   p_is_init   - Filter stream init state
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_stream_is_init(p_filter_stream_t stream_inst, bool * const p_is_init)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != stream_inst )
+        &&  ( NULL != p_is_init ))
+    {
+        *p_is_init = stream_inst->is_init;
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Push raw samples to filter stream
+*
+* @brief    Never blocks. If input ring has not enough space only part of
+*           samples is pushed. Worker is woken up each time "wake_thr"
+*           samples are pushed. Remaining samples below threshold (e.g.
+*           tail of burst) are handed over by "filter_stream_flush()".
+*
+* @note     Must be called from producer thread only!
+*
+* @param[in]    stream_inst - Filter stream instance
+* @param[in]    p_in        - Input samples
+* @param[in]    size        - Number of samples
+* @param[out]   p_pushed    - Number of pushed samples (can be NULL)
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_stream_push(p_filter_stream_t stream_inst, const float32_t * const p_in, const uint32_t size, uint32_t * const p_pushed)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != stream_inst )
+        &&  ( NULL != p_in ))
+    {
+        // Is instance init?
+        if ( true == stream_inst->is_init )
+        {
+            filter_stream_ring_t * const    p_ring  = &stream_inst->in;
+            const uint32_t                  head    = atomic_load_explicit( &p_ring->head, memory_order_relaxed );
+            const uint32_t                  idx     = ( head & p_ring->mask );
+            const uint32_t                  free    = filter_stream_ring_free( p_ring, size );
+            const uint32_t                  num     = (( size < free ) ? size : free );
+            const uint32_t                  first   = ((( p_ring->size - idx ) < num ) ? ( p_ring->size - idx ) : num );
+
+            // Copy with wrap around
+            filter_stream_ring_copy( &p_ring->p_buf[idx], p_in, first );
+            filter_stream_ring_copy( &p_ring->p_buf[0], &p_in[first], ( num - first ));
+
+            // Publish samples
+            atomic_store_explicit( &p_ring->head, ( head + num ), memory_order_release );
+
+            // Batched wake up of worker
+            stream_inst->pending += num;
+
+            if ( stream_inst->pending >= stream_inst->cfg.wake_thr )
+            {
+                stream_inst->pending = 0U;
+
+                if ( NULL != stream_inst->cfg.pf_wake_worker )
+                {
+                    stream_inst->cfg.pf_wake_worker( stream_inst->cfg.p_arg );
+                }
+            }
+
+            if ( NULL != p_pushed )
+            {
+                *p_pushed = num;
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Flush pushed samples of filter stream to worker
+*
+* @brief    Wakes up worker if any sample was pushed since last wake up,
+*           regardless of "wake_thr", so that samples below threshold
+*           are not left waiting for next push.
+*
+* @note     Must be called from producer thread only!
+*
+* @param[in]    stream_inst - Filter stream instance
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_stream_flush(p_filter_stream_t stream_inst)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if ( NULL != stream_inst )
+    {
+        // Is instance init?
+        if ( true == stream_inst->is_init )
+        {
+            if ( stream_inst->pending > 0U )
+            {
+                stream_inst->pending = 0U;
+
+                if ( NULL != stream_inst->cfg.pf_wake_worker )
+                {
+                    stream_inst->cfg.pf_wake_worker( stream_inst->cfg.p_arg );
+                }
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Process pending samples of filter stream
+*
+* @brief    Filters all available input samples in blocks of up to
+*           "block_size" samples directly from input ring into output
+*           ring. Processing stops when input ring is empty or output ring
+*           is full. Consumer is woken up once per call if any sample was
+*           processed.
+*
+* @note     Must be called from filter worker thread only!
+*
+* @param[in]    stream_inst - Filter stream instance
+* @param[out]   p_processed - Number of processed samples (can be NULL)
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_stream_process(p_filter_stream_t stream_inst, uint32_t * const p_processed)
+{
+    filter_status_t status  = eFILTER_OK;
+    uint32_t        total   = 0U;
+
+    if ( NULL != stream_inst )
+    {
+        // Is instance init?
+        if ( true == stream_inst->is_init )
+        {
+            filter_stream_ring_t * const    p_in    = &stream_inst->in;
+            filter_stream_ring_t * const    p_out   = &stream_inst->out;
+            const uint32_t                  block   = stream_inst->cfg.block_size;
+            uint32_t                        num     = 0U;
+
+            do
+            {
+                const uint32_t  tail    = atomic_load_explicit( &p_in->tail, memory_order_relaxed );
+                const uint32_t  head    = atomic_load_explicit( &p_out->head, memory_order_relaxed );
+                const uint32_t  in_idx  = ( tail & p_in->mask );
+                const uint32_t  out_idx = ( head & p_out->mask );
+                const uint32_t  used    = filter_stream_ring_used( p_in, block );
+                const uint32_t  free    = filter_stream_ring_free( p_out, block );
+
+                // Limit to block size and contiguous part of both rings
+                num = (( used < free ) ? used : free );
+                num = (( num < block ) ? num : block );
+                num = (( num < ( p_in->size - in_idx )) ? num : ( p_in->size - in_idx ));
+                num = (( num < ( p_out->size - out_idx )) ? num : ( p_out->size - out_idx ));
+
+                if ( num > 0U )
+                {
+                    status |= filter_hndl_block( stream_inst->cfg.filter, &p_in->p_buf[in_idx], &p_out->p_buf[out_idx], num );
+
+                    atomic_store_explicit( &p_in->tail, ( tail + num ), memory_order_release );
+                    atomic_store_explicit( &p_out->head, ( head + num ), memory_order_release );
+
+                    total += num;
+                }
+
+            } while ( num > 0U );
+
+            // Batched wake up of consumer
+            if  (   ( total > 0U )
+                &&  ( NULL != stream_inst->cfg.pf_wake_consumer ))
+            {
+                stream_inst->cfg.pf_wake_consumer( stream_inst->cfg.p_arg );
+            }
+
+            if ( NULL != p_processed )
+            {
+                *p_processed = total;
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Pop filtered samples from filter stream
+*
+* @brief    Never blocks. If output ring has less samples than requested
+*           only available samples are popped.
+*
+* @note     Must be called from consumer thread only!
+*
+* @param[in]    stream_inst - Filter stream instance
+* @param[out]   p_out       - Filtered samples
+* @param[in]    size        - Max. number of samples
+* @param[out]   p_popped    - Number of popped samples (can be NULL)
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_stream_pop(p_filter_stream_t stream_inst, float32_t * const p_out, const uint32_t size, uint32_t * const p_popped)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != stream_inst )
+        &&  ( NULL != p_out ))
+    {
+        // Is instance init?
+        if ( true == stream_inst->is_init )
+        {
+            filter_stream_ring_t * const    p_ring  = &stream_inst->out;
+            const uint32_t                  tail    = atomic_load_explicit( &p_ring->tail, memory_order_relaxed );
+            const uint32_t                  idx     = ( tail & p_ring->mask );
+            const uint32_t                  used    = filter_stream_ring_used( p_ring, size );
+            const uint32_t                  num     = (( size < used ) ? size : used );
+            const uint32_t                  first   = ((( p_ring->size - idx ) < num ) ? ( p_ring->size - idx ) : num );
+
+            // Copy with wrap around
+            filter_stream_ring_copy( p_out, &p_ring->p_buf[idx], first );
+            filter_stream_ring_copy( &p_out[first], &p_ring->p_buf[0], ( num - first ));
+
+            // Release space
+            atomic_store_explicit( &p_ring->tail, ( tail + num ), memory_order_release );
+
+            if ( NULL != p_popped )
+            {
+                *p_popped = num;
+            }
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,70 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      filter_stream.h
+*@brief     Lock-free streaming front end for filters
+*@author    Ziga Miklosic
+*@date      17.10.2026
+*@version   V2.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FILTER_STREAM_API
+* @{ <!-- BEGIN GROUP -->
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __FILTER_STREAM_H
+#define __FILTER_STREAM_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "filter.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Filter stream instance type
+ */
+typedef struct filter_stream_s * p_filter_stream_t;
+
+/**
+ *  Filter stream configuration
+ */
+typedef struct
+{
+    p_filter_t  filter;                                 /**<Generic filter processing stream */
+    uint32_t    size;                                   /**<Input and output ring size in samples, power of 2 */
+    uint32_t    block_size;                             /**<Max. number of samples processed in one block */
+    uint32_t    wake_thr;                               /**<Number of pushed samples after which worker is woken up */
+    void        (*pf_wake_worker)   (void * p_arg);     /**<Wake up filter worker thread (can be NULL) */
+    void        (*pf_wake_consumer) (void * p_arg);     /**<Wake up consumer thread, new output ready (can be NULL) */
+    void      * p_arg;                                  /**<Argument of wake up callbacks */
+} filter_stream_cfg_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_stream_init      (p_filter_stream_t * p_stream_inst, const filter_stream_cfg_t * const p_cfg);
+filter_status_t filter_stream_is_init   (p_filter_stream_t stream_inst, bool * const p_is_init);
+filter_status_t filter_stream_push      (p_filter_stream_t stream_inst, const float32_t * const p_in, const uint32_t size, uint32_t * const p_pushed);
+filter_status_t filter_stream_flush     (p_filter_stream_t stream_inst);
+filter_status_t filter_stream_process   (p_filter_stream_t stream_inst, uint32_t * const p_processed);
+filter_status_t filter_stream_pop       (p_filter_stream_t stream_inst, float32_t * const p_out, const uint32_t size, uint32_t * const p_popped);
+
+#endif // __FILTER_STREAM_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,1118 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      filter_conformance.c
+*@brief     Conformance test of filter kernel variants
+*@author    Ziga Miklosic
+*@date      17.10.2026
+*@version   V2.1.0
+*
+*@brief     Every kernel variant is run over chirp, noise, impulse, step and
+*           denormal inducing input and compared against double precision
+*           reference or against scalar handler. Error bounds are the ones
+*           listed in README "Kernel Variants Accuracy" table.
+*
+*           Build from root of "General Embedded C Libraries Ecosystem"
+*           (add -mavx2 or -mavx512f to cover vectorized DC blocker bank):
+*
+*           gcc -std=gnu11 -O2 -I. -Imiddleware/filter/src
+*               middleware/filter/test/filter_conformance.c
+*               middleware/filter/src/filter.c
+*               middleware/ring_buffer/src/ring_buffer.c -lm
+*
+*           Returns number of failed checks (0 on success).
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <float.h>
+#include <math.h>
+
+#include "filter.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Number of samples per test signal
+ */
+#define TEST_SIZE                   ( 4096U )
+
+/**
+ *  Sampling frequency of tests
+ */
+#define TEST_FS                     ( 1000.0f )
+
+/**
+ *  Block size for block handlers, not multiple of any vector width
+ */
+#define TEST_BLOCK_SIZE             ( 77U )
+
+/**
+ *  "Floating point rounding" bound, in ULPs of signal scale. Reordered
+ *  operations round differently and low cutoff filter states carry that
+ *  difference for about 1/alpha samples.
+ */
+#define TEST_ROUNDING_ULP           ( 1024.0 )
+
+/**
+ *  Float kernel vs. double precision reference bound, in ULPs of signal
+ *  scale. Covers rounding of coefficients and accumulated rounding of states.
+ */
+#define TEST_REF_ULP                ( 4096.0 )
+
+/**
+ *  Fast cutoff setter relative alpha error bound
+ */
+#define TEST_FAST_ALPHA_TOL         ( 1e-5 )
+
+/**
+ *  Fused SOS filter relative response error bound
+ */
+#define TEST_FUSE_TOL               ( 1e-3 )
+
+/**
+ *  Integer DC blocker vs. double precision reference bound in LSB
+ */
+#define TEST_DCB_LSB                ( 2.0 )
+
+/**
+ *  Number of DC blocker bank channels, not multiple of any vector width
+ */
+#define TEST_DCB_NUM_OF_CH          ( 37U )
+
+/**
+ *  Number of packed boolean words
+ */
+#define TEST_BOOL_NUM_OF_WORDS      ( 64U )
+
+/**
+ *  Integer boolean filter step length in samples, enough to settle at lowest fc
+ */
+#define TEST_BOOL_CNT_STEP          ( 20000U )
+
+/**
+ *  Test input signals
+ */
+typedef enum
+{
+    eTEST_SIG_CHIRP = 0,    /**<Linear chirp from 0 to fs/2 */
+    eTEST_SIG_NOISE,        /**<Uniform white noise */
+    eTEST_SIG_IMPULSE,      /**<Unit impulse */
+    eTEST_SIG_STEP,         /**<Unit step */
+    eTEST_SIG_DENORMAL,     /**<Impulse at smallest normal float, decays through denormals */
+
+    eTEST_SIG_NUM_OF
+} test_sig_t;
+
+/**
+ *  Deviation between tested and reference output
+ */
+typedef struct
+{
+    double  err;    /**<Max. absolute deviation */
+    double  scale;  /**<Max. absolute reference value */
+    bool    finite; /**<All tested values finite */
+} test_dev_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Test signal names
+ */
+static const char * const gp_sig_name[eTEST_SIG_NUM_OF] =
+{
+    [eTEST_SIG_CHIRP]       = "chirp",
+    [eTEST_SIG_NOISE]       = "noise",
+    [eTEST_SIG_IMPULSE]     = "impulse",
+    [eTEST_SIG_STEP]        = "step",
+    [eTEST_SIG_DENORMAL]    = "denormal",
+};
+
+/**
+ *  Test input and output buffers
+ */
+static float32_t    g_x[TEST_SIZE];
+static float32_t    g_y[TEST_SIZE];
+static float32_t    g_y_var[TEST_SIZE];
+static double       g_y_ref[TEST_SIZE];
+
+/**
+ *  Number of executed and failed checks
+ */
+static uint32_t g_num_of_checks = 0U;
+static uint32_t g_num_of_fails  = 0U;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Generate test signal
+*
+* @param[in]    sig     - Signal type
+* @param[out]   p_x     - Signal samples
+* @param[in]    size    - Number of samples
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_sig_gen(const test_sig_t sig, float32_t * const p_x, const uint32_t size)
+{
+    uint32_t seed = 0x12345678U;
+
+    for ( uint32_t n = 0U; n < size; n++ )
+    {
+        switch( sig )
+        {
+            case eTEST_SIG_CHIRP:
+                p_x[n] = (float32_t) sin( M_PI * 0.5 * (double) n * (double) n / (double) size );
+                break;
+
+            case eTEST_SIG_NOISE:
+                seed    = (( seed * 1664525U ) + 1013904223U );
+                p_x[n]  = (float32_t) ((( (double) ( seed >> 8U ) / (double) ( 1U << 24U )) * 2.0 ) - 1.0 );
+                break;
+
+            case eTEST_SIG_IMPULSE:
+                p_x[n] = (( 0U == n ) ? 1.0f : 0.0f );
+                break;
+
+            case eTEST_SIG_STEP:
+                p_x[n] = 1.0f;
+                break;
+
+            case eTEST_SIG_DENORMAL:
+            default:
+                p_x[n] = (( 0U == n ) ? FLT_MIN : 0.0f );
+                break;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Measure deviation of float output from double reference
+*
+* @param[in]    p_y     - Tested output
+* @param[in]    p_ref   - Reference output
+* @param[in]    size    - Number of samples
+* @return       dev     - Deviation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static test_dev_t test_dev_ref(const float32_t * const p_y, const double * const p_ref, const uint32_t size)
+{
+    test_dev_t dev = { .err = 0.0, .scale = 0.0, .finite = true };
+
+    for ( uint32_t n = 0U; n < size; n++ )
+    {
+        dev.err     = fmax( dev.err, fabs((double) p_y[n] - p_ref[n] ));
+        dev.scale   = fmax( dev.scale, fabs( p_ref[n] ));
+
+        if ( 0 == isfinite( p_y[n] ))
+        {
+            dev.finite = false;
+        }
+    }
+
+    return dev;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Measure deviation of float variant output from float output
+*
+* @param[in]    p_y     - Tested output
+* @param[in]    p_ref   - Reference output
+* @param[in]    size    - Number of samples
+* @return       dev     - Deviation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static test_dev_t test_dev(const float32_t * const p_y, const float32_t * const p_ref, const uint32_t size)
+{
+    for ( uint32_t n = 0U; n < size; n++ )
+    {
+        g_y_ref[n] = p_ref[n];
+    }
+
+    return test_dev_ref( p_y, g_y_ref, size );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Check deviation against bound in ULPs of signal scale
+*
+* @note     Scale is at least smallest normal float, so that denormal
+*           signals are compared against denormal resolution.
+*
+* @param[in]    p_name  - Check name
+* @param[in]    sig     - Signal type
+* @param[in]    dev     - Deviation
+* @param[in]    ulp     - Bound in ULPs of signal scale (0 - bit exact)
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_check_ulp(const char * const p_name, const test_sig_t sig, const test_dev_t dev, const double ulp)
+{
+    const double    scale   = fmax( dev.scale, (double) FLT_MIN );
+    const double    err_ulp = ( dev.err / ( scale * (double) FLT_EPSILON ));
+    const bool      pass    = (( true == dev.finite ) && ( err_ulp <= ulp ));
+
+    g_num_of_checks++;
+
+    if ( false == pass )
+    {
+        g_num_of_fails++;
+    }
+
+    printf( "%s %-40s %-9s err %10.3g ulp (bound %g)\n", (( true == pass ) ? "PASS" : "FAIL" ), p_name, gp_sig_name[sig], err_ulp, ulp );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Check condition
+*
+* @param[in]    p_name  - Check name
+* @param[in]    p_case  - Case description
+* @param[in]    pass    - Check result
+* @param[in]    val     - Measured value
+* @param[in]    bound   - Bound of measured value
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_check(const char * const p_name, const char * const p_case, const bool pass, const double val, const double bound)
+{
+    g_num_of_checks++;
+
+    if ( false == pass )
+    {
+        g_num_of_fails++;
+    }
+
+    printf( "%s %-40s %-9s val %10.3g     (bound %g)\n", (( true == pass ) ? "PASS" : "FAIL" ), p_name, p_case, val, bound );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Double precision RC alpha, same formula as filter module
+*
+* @param[in]    fc      - Cutoff frequency
+* @param[in]    fs      - Sampling frequency
+* @return       alpha   - RC smoothing factor
+*/
+////////////////////////////////////////////////////////////////////////////////
+static double test_rc_alpha(const double fc, const double fs)
+{
+    return ( 1.0 / ( 1.0 + ( fs / ( 2.0 * M_PI * fc ))));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Double precision CR alpha, same formula as filter module
+*
+* @param[in]    fc      - Cutoff frequency
+* @param[in]    fs      - Sampling frequency
+* @return       alpha   - CR smoothing factor
+*/
+////////////////////////////////////////////////////////////////////////////////
+static double test_cr_alpha(const double fc, const double fs)
+{
+    return ( fs / ( fs + ( 2.0 * M_PI * fc )));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Double precision reference of cascaded RC filter
+*
+* @param[in]    p_x     - Input samples
+* @param[out]   p_y     - Output samples
+* @param[in]    size    - Number of samples
+* @param[in]    alpha   - Smoothing factor
+* @param[in]    order   - Number of cascaded stages
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_rc_ref(const float32_t * const p_x, double * const p_y, const uint32_t size, const double alpha, const uint8_t order)
+{
+    double y[8] = { 0.0 };
+
+    for ( uint32_t n = 0U; n < size; n++ )
+    {
+        double in = p_x[n];
+
+        for ( uint8_t k = 0U; k < order; k++ )
+        {
+            y[k]    = ( y[k] + ( alpha * ( in - y[k] )));
+            in      = y[k];
+        }
+
+        p_y[n] = in;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Double precision reference of cascaded CR filter
+*
+* @param[in]    p_x     - Input samples
+* @param[out]   p_y     - Output samples
+* @param[in]    size    - Number of samples
+* @param[in]    alpha   - Smoothing factor
+* @param[in]    order   - Number of cascaded stages
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_cr_ref(const float32_t * const p_x, double * const p_y, const uint32_t size, const double alpha, const uint8_t order)
+{
+    double x[8] = { 0.0 };
+    double y[8] = { 0.0 };
+
+    for ( uint32_t n = 0U; n < size; n++ )
+    {
+        double in = p_x[n];
+
+        for ( uint8_t k = 0U; k < order; k++ )
+        {
+            y[k]    = ( alpha * ( y[k] + in - x[k] ));
+            x[k]    = in;
+            in      = y[k];
+        }
+
+        p_y[n] = in;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Double precision reference of direct form IIR filter
+*
+* @param[in]    p_x     - Input samples
+* @param[out]   p_y     - Output samples
+* @param[in]    size    - Number of samples
+* @param[in]    p_b     - Numerator (zeros)
+* @param[in]    nb      - Number of numerator coefficients
+* @param[in]    p_a     - Denominator (poles)
+* @param[in]    na      - Number of denominator coefficients
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_iir_ref(const float32_t * const p_x, double * const p_y, const uint32_t size, const float32_t * const p_b, const uint32_t nb, const float32_t * const p_a, const uint32_t na)
+{
+    for ( uint32_t n = 0U; n < size; n++ )
+    {
+        double acc = 0.0;
+
+        for ( uint32_t i = 0U; ( i < nb ) && ( i <= n ); i++ )
+        {
+            acc += ( (double) p_b[i] * (double) p_x[ n - i ] );
+        }
+
+        for ( uint32_t i = 1U; ( i < na ) && ( i <= n ); i++ )
+        {
+            acc -= ( (double) p_a[i] * p_y[ n - i ] );
+        }
+
+        p_y[n] = ( acc / (double) p_a[0] );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       RC and CR filter: scalar vs. reference and block vs. scalar
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_rc_cr(void)
+{
+    const float32_t fc[2] = { 1.0f, 100.0f };
+
+    for ( uint8_t order = 1U; order <= 5U; order++ )
+    {
+        for ( uint32_t f = 0U; f < 2U; f++ )
+        {
+            for ( test_sig_t sig = 0; sig < eTEST_SIG_NUM_OF; sig++ )
+            {
+                p_filter_rc_t   rc      = NULL;
+                p_filter_rc_t   rc_blk  = NULL;
+                p_filter_cr_t   cr      = NULL;
+                p_filter_cr_t   cr_blk  = NULL;
+                char            name[64];
+
+                test_sig_gen( sig, g_x, TEST_SIZE );
+
+                (void) filter_rc_init( &rc, fc[f], TEST_FS, order, 0.0f );
+                (void) filter_rc_init( &rc_blk, fc[f], TEST_FS, order, 0.0f );
+                (void) filter_cr_init( &cr, fc[f], TEST_FS, order );
+                (void) filter_cr_init( &cr_blk, fc[f], TEST_FS, order );
+
+                // RC
+                for ( uint32_t n = 0U; n < TEST_SIZE; n++ )
+                {
+                    (void) filter_rc_hndl( rc, g_x[n], &g_y[n] );
+                }
+
+                for ( uint32_t n = 0U; n < TEST_SIZE; n += TEST_BLOCK_SIZE )
+                {
+                    (void) filter_rc_hndl_block( rc_blk, &g_x[n], &g_y_var[n], ((( TEST_SIZE - n ) < TEST_BLOCK_SIZE ) ? ( TEST_SIZE - n ) : TEST_BLOCK_SIZE ));
+                }
+
+                test_rc_ref( g_x, g_y_ref, TEST_SIZE, test_rc_alpha( fc[f], TEST_FS ), order );
+
+                snprintf( name, sizeof( name ), "rc_hndl order %u fc %g", order, fc[f] );
+                test_check_ulp( name, sig, test_dev_ref( g_y, g_y_ref, TEST_SIZE ), TEST_REF_ULP );
+                snprintf( name, sizeof( name ), "rc_hndl_block order %u fc %g", order, fc[f] );
+                test_check_ulp( name, sig, test_dev( g_y_var, g_y, TEST_SIZE ), TEST_ROUNDING_ULP );
+
+                // CR
+                for ( uint32_t n = 0U; n < TEST_SIZE; n++ )
+                {
+                    (void) filter_cr_hndl( cr, g_x[n], &g_y[n] );
+                }
+
+                for ( uint32_t n = 0U; n < TEST_SIZE; n += TEST_BLOCK_SIZE )
+                {
+                    (void) filter_cr_hndl_block( cr_blk, &g_x[n], &g_y_var[n], ((( TEST_SIZE - n ) < TEST_BLOCK_SIZE ) ? ( TEST_SIZE - n ) : TEST_BLOCK_SIZE ));
+                }
+
+                test_cr_ref( g_x, g_y_ref, TEST_SIZE, test_cr_alpha( fc[f], TEST_FS ), order );
+
+                snprintf( name, sizeof( name ), "cr_hndl order %u fc %g", order, fc[f] );
+                test_check_ulp( name, sig, test_dev_ref( g_y, g_y_ref, TEST_SIZE ), TEST_REF_ULP );
+                snprintf( name, sizeof( name ), "cr_hndl_block order %u fc %g", order, fc[f] );
+                test_check_ulp( name, sig, test_dev( g_y_var, g_y, TEST_SIZE ), TEST_ROUNDING_ULP );
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       RC and CR fast cutoff setter vs. exact setter
+*
+* @note     Alpha is observed as first output of 1st order filter on unit
+*           step from zero state.
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_fc_set_fast(void)
+{
+    double err_rc = 0.0;
+    double err_cr = 0.0;
+    char   name[32];
+
+    for ( float32_t fc = 0.01f; fc < ( 0.45f * TEST_FS ); fc *= 1.07f )
+    {
+        p_filter_rc_t   rc          = NULL;
+        p_filter_cr_t   cr          = NULL;
+        float32_t       alpha       = 0.0f;
+        float32_t       alpha_fast  = 0.0f;
+
+        (void) filter_rc_init( &rc, fc, TEST_FS, 1U, 0.0f );
+        (void) filter_cr_init( &cr, fc, TEST_FS, 1U );
+
+        (void) filter_rc_fc_set( rc, fc );
+        (void) filter_rc_hndl( rc, 1.0f, &alpha );
+        (void) filter_rc_reset( rc, 0.0f );
+        (void) filter_rc_fc_set_fast( rc, fc );
+        (void) filter_rc_hndl( rc, 1.0f, &alpha_fast );
+        err_rc = fmax( err_rc, fabs((double) alpha_fast - (double) alpha ) / (double) alpha );
+
+        (void) filter_cr_fc_set( cr, fc );
+        (void) filter_cr_hndl( cr, 1.0f, &alpha );
+        (void) filter_cr_reset( cr );
+        (void) filter_cr_fc_set_fast( cr, fc );
+        (void) filter_cr_hndl( cr, 1.0f, &alpha_fast );
+        err_cr = fmax( err_cr, fabs((double) alpha_fast - (double) alpha ) / (double) alpha );
+    }
+
+    snprintf( name, sizeof( name ), "fc %g..%g", 0.01, 0.45 * TEST_FS );
+    test_check( "rc_fc_set_fast relative alpha error", name, ( err_rc < TEST_FAST_ALPHA_TOL ), err_rc, TEST_FAST_ALPHA_TOL );
+    test_check( "cr_fc_set_fast relative alpha error", name, ( err_cr < TEST_FAST_ALPHA_TOL ), err_cr, TEST_FAST_ALPHA_TOL );
+}
+
+#if ( 1 == FILTER_CFG_ATOMIC_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Concurrent getters return cutoff set by any setter (exact)
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_fc_get_atomic(void)
+{
+    p_filter_rc_t       rc          = NULL;
+    p_filter_cr_t       cr          = NULL;
+    p_filter_rc_bank_t  bank        = NULL;
+    float32_t           fc          = 0.0f;
+    float32_t           fc_bank[4]  = { 0.0f };
+    float32_t           y[4]        = { 0.0f };
+    const float32_t     x[4]        = { 0.0f };
+    double              diff        = 0.0;
+
+    (void) filter_rc_init( &rc, 10.0f, TEST_FS, 1U, 0.0f );
+    (void) filter_cr_init( &cr, 10.0f, TEST_FS, 1U );
+    (void) filter_rc_bank_init( &bank, 4U, 10.0f, TEST_FS, 1U, 0.0f );
+
+    // Plain, fast and deferred (applied by handler) setters
+    (void) filter_rc_fc_set( rc, 20.0f );
+    (void) filter_rc_fc_get_atomic( rc, &fc );
+    diff += fabs((double) fc - 20.0 );
+
+    (void) filter_rc_fc_set_fast( rc, 30.0f );
+    (void) filter_rc_fc_get_atomic( rc, &fc );
+    diff += fabs((double) fc - 30.0 );
+
+    (void) filter_rc_fc_set_deferred( rc, 40.0f );
+    (void) filter_rc_hndl( rc, 0.0f, &y[0] );
+    (void) filter_rc_fc_get_atomic( rc, &fc );
+    diff += fabs((double) fc - 40.0 );
+
+    (void) filter_cr_fc_set( cr, 25.0f );
+    (void) filter_cr_fc_get_atomic( cr, &fc );
+    diff += fabs((double) fc - 25.0 );
+
+    // Channel set in sample path is not reverted by concurrent set of other channel
+    (void) filter_rc_bank_ch_fc_set( bank, 1U, 22.0f );
+    (void) filter_rc_bank_ch_fc_set_atomic( bank, 2U, 33.0f );
+    (void) filter_rc_bank_hndl( bank, x, y );
+    (void) filter_rc_bank_fc_get( bank, fc_bank );
+    diff += ( fabs((double) fc_bank[1] - 22.0 ) + fabs((double) fc_bank[2] - 33.0 ));
+
+    test_check( "fc_get_atomic after sample path set [Hz]", "rc/cr/bank", ( 0.0 == diff ), diff, 0.0 );
+}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Band filter: block vs. CR followed by RC filter (bit exact) and
+*       scalar vs. reference
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_band(void)
+{
+    for ( uint8_t order = 1U; order <= 3U; order++ )
+    {
+        for ( test_sig_t sig = 0; sig < eTEST_SIG_NUM_OF; sig++ )
+        {
+            p_filter_band_t band        = NULL;
+            p_filter_band_t band_blk    = NULL;
+            p_filter_cr_t   cr          = NULL;
+            p_filter_rc_t   rc          = NULL;
+            char            name[64];
+
+            test_sig_gen( sig, g_x, TEST_SIZE );
+
+            (void) filter_band_init( &band, 5.0f, 100.0f, TEST_FS, order, order );
+            (void) filter_band_init( &band_blk, 5.0f, 100.0f, TEST_FS, order, order );
+            (void) filter_cr_init( &cr, 5.0f, TEST_FS, order );
+            (void) filter_rc_init( &rc, 100.0f, TEST_FS, order, 0.0f );
+
+            for ( uint32_t n = 0U; n < TEST_SIZE; n++ )
+            {
+                float32_t tmp = 0.0f;
+
+                (void) filter_cr_hndl( cr, g_x[n], &tmp );
+                (void) filter_rc_hndl( rc, tmp, &g_y[n] );
+            }
+
+            for ( uint32_t n = 0U; n < TEST_SIZE; n += TEST_BLOCK_SIZE )
+            {
+                (void) filter_band_hndl_block( band_blk, &g_x[n], &g_y_var[n], ((( TEST_SIZE - n ) < TEST_BLOCK_SIZE ) ? ( TEST_SIZE - n ) : TEST_BLOCK_SIZE ));
+            }
+
+            snprintf( name, sizeof( name ), "band_hndl_block order %u/%u", order, order );
+            test_check_ulp( name, sig, test_dev( g_y_var, g_y, TEST_SIZE ), 0.0 );
+
+            for ( uint32_t n = 0U; n < TEST_SIZE; n++ )
+            {
+                (void) filter_band_hndl( band, g_x[n], &g_y_var[n] );
+            }
+
+            snprintf( name, sizeof( name ), "band_hndl order %u/%u", order, order );
+            test_check_ulp( name, sig, test_dev( g_y_var, g_y, TEST_SIZE ), 0.0 );
+
+            test_cr_ref( g_x, g_y_ref, TEST_SIZE, test_cr_alpha( 5.0, TEST_FS ), order );
+
+            for ( uint32_t n = 0U; n < TEST_SIZE; n++ )
+            {
+                g_y_var[n] = (float32_t) g_y_ref[n];
+            }
+
+            test_rc_ref( g_y_var, g_y_ref, TEST_SIZE, test_rc_alpha( 100.0, TEST_FS ), order );
+
+            snprintf( name, sizeof( name ), "band_hndl vs ref order %u/%u", order, order );
+            test_check_ulp( name, sig, test_dev_ref( g_y, g_y_ref, TEST_SIZE ), TEST_REF_ULP );
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       FIR, IIR and SOS filter vs. reference
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_fir_iir_sos(void)
+{
+    float32_t   fir_a[31];
+    float32_t   pole[3];
+    float32_t   zero[3];
+    double      fir_sum = 0.0;
+
+    // Windowed sinc low-pass
+    for ( uint32_t i = 0U; i < 31U; i++ )
+    {
+        const double t = ( (double) i - 15.0 );
+        const double h = (( 0.0 == t ) ? 0.2 : ( sin( 0.2 * M_PI * t ) / ( M_PI * t )));
+
+        fir_a[i]    = (float32_t) ( h * ( 0.54 - ( 0.46 * cos( 2.0 * M_PI * (double) i / 30.0 ))));
+        fir_sum    += fir_a[i];
+    }
+
+    for ( uint32_t i = 0U; i < 31U; i++ )
+    {
+        fir_a[i] = (float32_t) ( fir_a[i] / fir_sum );
+    }
+
+    (void) filter_iir_coeff_calc_2nd_lpf( 20.0f, 0.5f, TEST_FS, pole, zero );
+    (void) filter_iir_coeff_to_unity_gain_lpf( &(filter_iir_coeff_t){ .p_pole = pole, .p_zero = zero, .num_of_pole = 3U, .num_of_zero = 3U });
+
+    for ( test_sig_t sig = 0; sig < eTEST_SIG_NUM_OF; sig++ )
+    {
+        const filter_iir_coeff_t    coeff   = { .p_pole = pole, .p_zero = zero, .num_of_pole = 3U, .num_of_zero = 3U };
+        const filter_sos_coeff_t    sect    = { .b = { zero[0], zero[1], zero[2] }, .a = { pole[0], pole[1], pole[2] }};
+        p_filter_fir_t              fir     = NULL;
+        p_filter_iir_t              iir     = NULL;
+        p_filter_sos_t              sos     = NULL;
+
+        test_sig_gen( sig, g_x, TEST_SIZE );
+
+        (void) filter_fir_init( &fir, fir_a, 31U, 0.0f );
+        (void) filter_iir_init( &iir, &coeff );
+        (void) filter_sos_init( &sos, &sect, 1U );
+
+        // FIR, accumulates into output
+        for ( uint32_t n = 0U; n < TEST_SIZE; n++ )
+        {
+            g_y[n] = 0.0f;
+            (void) filter_fir_hndl( fir, g_x[n], &g_y[n] );
+        }
+
+        test_iir_ref( g_x, g_y_ref, TEST_SIZE, fir_a, 31U, (const float32_t[]){ 1.0f }, 1U );
+        test_check_ulp( "fir_hndl 31 taps", sig, test_dev_ref( g_y, g_y_ref, TEST_SIZE ), TEST_REF_ULP );
+
+        // IIR, accumulates into output
+        for ( uint32_t n = 0U; n < TEST_SIZE; n++ )
+        {
+            g_y[n] = 0.0f;
+            (void) filter_iir_hndl( iir, g_x[n], &g_y[n] );
+        }
+
+        test_iir_ref( g_x, g_y_ref, TEST_SIZE, zero, 3U, pole, 3U );
+        test_check_ulp( "iir_hndl 2nd order lpf", sig, test_dev_ref( g_y, g_y_ref, TEST_SIZE ), TEST_REF_ULP );
+
+        // SOS, same biquad
+        for ( uint32_t n = 0U; n < TEST_SIZE; n += TEST_BLOCK_SIZE )
+        {
+            (void) filter_sos_hndl_block( sos, &g_x[n], &g_y[n], ((( TEST_SIZE - n ) < TEST_BLOCK_SIZE ) ? ( TEST_SIZE - n ) : TEST_BLOCK_SIZE ));
+        }
+
+        test_check_ulp( "sos_hndl_block 2nd order lpf", sig, test_dev_ref( g_y, g_y_ref, TEST_SIZE ), TEST_REF_ULP );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Integer DC blocker: bank (vectorized) vs. scalar (bit exact) and
+*       scalar vs. reference
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_dcb(void)
+{
+    static int16_t  x[TEST_SIZE * TEST_DCB_NUM_OF_CH];
+    static int16_t  y_bank[TEST_SIZE * TEST_DCB_NUM_OF_CH];
+    static int16_t  y[TEST_SIZE];
+    const float32_t alpha   = (float32_t) ( 1.0f / ( 1.0f + (( 2.0f * (float32_t) M_PI * 5.0f ) / TEST_FS )));
+    const double    r       = ( (double) (int32_t) (( alpha * 32768.0f ) + 0.5f ) / 32768.0 );
+
+    #if defined( __AVX512F__ )
+        const char * const p_name = "dcb_bank (AVX-512) vs dcb_hndl";
+    #elif defined( __AVX2__ )
+        const char * const p_name = "dcb_bank (AVX2) vs dcb_hndl";
+    #else
+        const char * const p_name = "dcb_bank (scalar) vs dcb_hndl";
+    #endif
+
+    for ( test_sig_t sig = 0; sig < eTEST_SIG_NUM_OF; sig++ )
+    {
+        p_filter_dcb_bank_t bank        = NULL;
+        double              err_bank    = 0.0;
+        double              err_ref     = 0.0;
+
+        test_sig_gen( sig, g_x, TEST_SIZE );
+
+        // Channel gets scaled and shifted signal
+        for ( uint32_t n = 0U; n < TEST_SIZE; n++ )
+        {
+            for ( uint32_t ch = 0U; ch < TEST_DCB_NUM_OF_CH; ch++ )
+            {
+                const float32_t v = ((( eTEST_SIG_DENORMAL == sig ) ? ( g_x[n] / FLT_MIN ) : g_x[n] ) * (float32_t) ( 100U * ( ch + 1U )));
+
+                x[ ( n * TEST_DCB_NUM_OF_CH ) + ch ] = (int16_t) ( lrintf( v ) + ((int32_t) ch * 50 ) - 900 );
+            }
+        }
+
+        (void) filter_dcb_bank_init( &bank, TEST_DCB_NUM_OF_CH, 5.0f, TEST_FS );
+        (void) filter_dcb_bank_hndl_block( bank, x, y_bank, TEST_SIZE );
+
+        for ( uint32_t ch = 0U; ch < TEST_DCB_NUM_OF_CH; ch++ )
+        {
+            p_filter_dcb_t  dcb = NULL;
+            double          x1  = 0.0;
+            double          y1  = 0.0;
+
+            (void) filter_dcb_init( &dcb, 5.0f, TEST_FS );
+
+            for ( uint32_t n = 0U; n < TEST_SIZE; n++ )
+            {
+                const double in = x[ ( n * TEST_DCB_NUM_OF_CH ) + ch ];
+
+                (void) filter_dcb_hndl( dcb, x[ ( n * TEST_DCB_NUM_OF_CH ) + ch ], &y[n] );
+
+                y1  = (( in - x1 ) + ( r * y1 ));
+                x1  = in;
+
+                err_bank    = fmax( err_bank, fabs((double) ( y_bank[ ( n * TEST_DCB_NUM_OF_CH ) + ch ] - y[n] )));
+                err_ref     = fmax( err_ref, fabs((double) y[n] - y1 ));
+            }
+        }
+
+        test_check( p_name, gp_sig_name[sig], ( 0.0 == err_bank ), err_bank, 0.0 );
+        test_check( "dcb_hndl vs ref [LSB]", gp_sig_name[sig], ( err_ref <= TEST_DCB_LSB ), err_ref, TEST_DCB_LSB );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Boolean filter: packed and edge handlers vs. scalar (exact)
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_bool(void)
+{
+    static uint64_t             in[TEST_BOOL_NUM_OF_WORDS];
+    static uint64_t             out[TEST_BOOL_NUM_OF_WORDS];
+    static uint64_t             out_ref[TEST_BOOL_NUM_OF_WORDS];
+    static filter_bool_edge_t   edge[TEST_BOOL_NUM_OF_WORDS * 64U];
+    static filter_bool_edge_t   edge_ref[TEST_BOOL_NUM_OF_WORDS * 64U];
+
+    for ( test_sig_t sig = 0; sig < eTEST_SIG_NUM_OF; sig++ )
+    {
+        p_filter_bool_t filter          = NULL;
+        p_filter_bool_t filter_packed   = NULL;
+        p_filter_bool_t filter_edges    = NULL;
+        uint32_t        num_of_edges    = 0U;
+        uint32_t        num_ref         = 0U;
+        bool            y_last          = false;
+        double          diff            = 0.0;
+
+        // Input bit is comparison of test signal (noise is biased to get bursts)
+        test_sig_gen( sig, g_x, TEST_BOOL_NUM_OF_WORDS * 64U );
+
+        for ( uint32_t w = 0U; w < TEST_BOOL_NUM_OF_WORDS; w++ )
+        {
+            in[w] = 0U;
+
+            for ( uint32_t b = 0U; b < 64U; b++ )
+            {
+                const float32_t v = g_x[ ( w * 64U ) + b ];
+                const bool      s = (( eTEST_SIG_NOISE == sig ) ? ((( w / 4U ) % 2U ) ? ( v > -0.8f ) : ( v > 0.8f )) : ( v > 0.0f ));
+
+                in[w] |= (( true == s ) ? ( 1ULL << b ) : 0U );
+            }
+        }
+
+        (void) filter_bool_init( &filter, 10.0f, TEST_FS, 0.2f );
+        (void) filter_bool_init( &filter_packed, 10.0f, TEST_FS, 0.2f );
+        (void) filter_bool_init( &filter_edges, 10.0f, TEST_FS, 0.2f );
+
+        for ( uint32_t w = 0U; w < TEST_BOOL_NUM_OF_WORDS; w++ )
+        {
+            out_ref[w] = 0U;
+
+            for ( uint32_t b = 0U; b < 64U; b++ )
+            {
+                bool y = false;
+
+                (void) filter_bool_hndl( filter, ( 0U != (( in[w] >> b ) & 1U )), &y );
+
+                out_ref[w] |= (( true == y ) ? ( 1ULL << b ) : 0U );
+
+                if ( y != y_last )
+                {
+                    edge_ref[num_ref].idx   = (( w * 64U ) + b );
+                    edge_ref[num_ref].state = y;
+                    num_ref++;
+                }
+
+                y_last = y;
+            }
+        }
+
+        (void) filter_bool_hndl_packed( filter_packed, in, out, TEST_BOOL_NUM_OF_WORDS );
+        (void) filter_bool_hndl_edges( filter_edges, in, TEST_BOOL_NUM_OF_WORDS, edge, ( TEST_BOOL_NUM_OF_WORDS * 64U ), &num_of_edges );
+
+        for ( uint32_t w = 0U; w < TEST_BOOL_NUM_OF_WORDS; w++ )
+        {
+            diff += (double) __builtin_popcountll( out[w] ^ out_ref[w] );
+        }
+
+        test_check( "bool_hndl_packed [differing bits]", gp_sig_name[sig], ( 0.0 == diff ), diff, 0.0 );
+
+        diff = fabs((double) num_of_edges - (double) num_ref );
+
+        for ( uint32_t e = 0U; ( e < num_of_edges ) && ( e < num_ref ); e++ )
+        {
+            if  (   ( edge[e].idx != edge_ref[e].idx )
+                ||  ( edge[e].state != edge_ref[e].state ))
+            {
+                diff += 1.0;
+            }
+        }
+
+        test_check( "bool_hndl_edges [differing edges]", gp_sig_name[sig], ( 0.0 == diff ), diff, 0.0 );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Integer boolean filter vs. boolean filter: step switching instants
+*       and output on noise (exact), down to low fc/fs
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_bool_cnt(void)
+{
+    static const float32_t fc[]         = { 0.5f, 1.0f, 2.0f, 5.0f, 10.0f, 50.0f, 200.0f };
+    static const float32_t comp_lvl[]   = { 0.05f, 0.1f, 0.2f, 0.3f, 0.35f };
+    char                   name[16];
+
+    for ( uint32_t i = 0U; i < ( sizeof( fc ) / sizeof( fc[0] )); i++ )
+    {
+        double diff_step    = 0.0;
+        double diff_noise   = 0.0;
+
+        for ( uint32_t j = 0U; j < ( sizeof( comp_lvl ) / sizeof( comp_lvl[0] )); j++ )
+        {
+            p_filter_bool_t     filter      = NULL;
+            p_filter_bool_cnt_t filter_cnt  = NULL;
+            bool                y           = false;
+            bool                y_cnt       = false;
+
+            (void) filter_bool_init( &filter, fc[i], TEST_FS, comp_lvl[j] );
+            (void) filter_bool_cnt_init( &filter_cnt, fc[i], TEST_FS, comp_lvl[j] );
+
+            // Rising step from rest, then falling step from settled high
+            for ( uint32_t n = 0U; n < ( 2U * TEST_BOOL_CNT_STEP ); n++ )
+            {
+                const bool x = ( n < TEST_BOOL_CNT_STEP );
+
+                (void) filter_bool_hndl( filter, x, &y );
+                (void) filter_bool_cnt_hndl( filter_cnt, x, &y_cnt );
+
+                diff_step += (( y != y_cnt ) ? 1.0 : 0.0 );
+            }
+
+            // Noise
+            test_sig_gen( eTEST_SIG_NOISE, g_x, TEST_SIZE );
+
+            for ( uint32_t n = 0U; n < TEST_SIZE; n++ )
+            {
+                (void) filter_bool_hndl( filter, ( g_x[n] > 0.0f ), &y );
+                (void) filter_bool_cnt_hndl( filter_cnt, ( g_x[n] > 0.0f ), &y_cnt );
+
+                diff_noise += (( y != y_cnt ) ? 1.0 : 0.0 );
+            }
+        }
+
+        (void) snprintf( name, sizeof( name ), "fc=%g", (double) fc[i] );
+
+        test_check( "bool_cnt_hndl step [differing samples]", name, ( 0.0 == diff_step ), diff_step, 0.0 );
+        test_check( "bool_cnt_hndl noise [differing samples]", name, ( 0.0 == diff_noise ), diff_noise, 0.0 );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Filter pipeline with fused CR + biquad vs. stages one by one
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_pipe(void)
+{
+    float32_t pole[3];
+    float32_t zero[3];
+
+    (void) filter_iir_coeff_calc_2nd_lpf( 50.0f, 0.7f, TEST_FS, pole, zero );
+
+    for ( test_sig_t sig = 0; sig < eTEST_SIG_NUM_OF; sig++ )
+    {
+        const filter_iir_coeff_t    coeff       = { .p_pole = pole, .p_zero = zero, .num_of_pole = 3U, .num_of_zero = 3U };
+        p_filter_cr_t               cr[2]       = { NULL };
+        p_filter_iir_t              iir[2]      = { NULL };
+        p_filter_rc_t               rc[2]       = { NULL };
+        p_filter_t                  stage[2][3] = {{ NULL }};
+        p_filter_pipe_t             pipe        = NULL;
+
+        test_sig_gen( sig, g_x, TEST_SIZE );
+
+        for ( uint32_t i = 0U; i < 2U; i++ )
+        {
+            (void) filter_cr_init( &cr[i], 2.0f, TEST_FS, 1U );
+            (void) filter_iir_init( &iir[i], &coeff );
+            (void) filter_rc_init( &rc[i], 200.0f, TEST_FS, 2U, 0.0f );
+            (void) filter_from_cr( &stage[i][0], cr[i] );
+            (void) filter_from_iir( &stage[i][1], iir[i] );
+            (void) filter_from_rc( &stage[i][2], rc[i] );
+        }
+
+        (void) filter_pipe_init( &pipe, stage[1], 3U );
+
+        for ( uint32_t n = 0U; n < TEST_SIZE; n++ )
+        {
+            float32_t v = g_x[n];
+
+            for ( uint32_t s = 0U; s < 3U; s++ )
+            {
+                (void) filter_hndl( stage[0][s], v, &v );
+            }
+
+            g_y[n] = v;
+        }
+
+        for ( uint32_t n = 0U; n < TEST_SIZE; n += TEST_BLOCK_SIZE )
+        {
+            (void) filter_pipe_hndl_block( pipe, &g_x[n], &g_y_var[n], ((( TEST_SIZE - n ) < TEST_BLOCK_SIZE ) ? ( TEST_SIZE - n ) : TEST_BLOCK_SIZE ));
+        }
+
+        test_check_ulp( "pipe_hndl_block cr+biquad+rc", sig, test_dev( g_y_var, g_y, TEST_SIZE ), TEST_ROUNDING_ULP );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       LTI stages fusion vs. stages one by one
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_fuse(void)
+{
+    float32_t pole[3];
+    float32_t zero[3];
+
+    (void) filter_iir_coeff_calc_2nd_lpf( 50.0f, 0.3f, TEST_FS, pole, zero );
+
+    for ( test_sig_t sig = 0; sig < eTEST_SIG_NUM_OF; sig++ )
+    {
+        const filter_iir_coeff_t    coeff   = { .p_pole = pole, .p_zero = zero, .num_of_pole = 3U, .num_of_zero = 3U };
+        p_filter_cr_t               cr      = NULL;
+        p_filter_iir_t              iir     = NULL;
+        p_filter_band_t             band    = NULL;
+        p_filter_sos_t              sos     = NULL;
+        p_filter_t                  stage[3];
+        filter_fuse_report_t        report;
+        filter_status_t             status;
+        char                        name[64];
+
+        test_sig_gen( sig, g_x, TEST_SIZE );
+
+        (void) filter_cr_init( &cr, 1.0f, TEST_FS, 1U );
+        (void) filter_iir_init( &iir, &coeff );
+        (void) filter_band_init( &band, 5.0f, 100.0f, TEST_FS, 1U, 2U );
+        (void) filter_from_cr( &stage[0], cr );
+        (void) filter_from_iir( &stage[1], iir );
+        (void) filter_from_band( &stage[2], band );
+
+        status = filter_fuse_to_sos( &sos, stage, 3U, &report );
+
+        snprintf( name, sizeof( name ), "fuse_to_sos cr+iir+band ops %u->%u", report.ops_before, report.ops_after );
+        test_check( name, gp_sig_name[sig], ( eFILTER_OK == status ), (double) status, 0.0 );
+
+        if ( eFILTER_OK == status )
+        {
+            test_dev_t dev;
+
+            for ( uint32_t n = 0U; n < TEST_SIZE; n++ )
+            {
+                float32_t v = g_x[n];
+
+                for ( uint32_t s = 0U; s < 3U; s++ )
+                {
+                    (void) filter_hndl( stage[s], v, &v );
+                }
+
+                g_y[n] = v;
+
+                (void) filter_sos_hndl( sos, g_x[n], &g_y_var[n] );
+            }
+
+            // Relative to signal scale
+            dev = test_dev( g_y_var, g_y, TEST_SIZE );
+
+            test_check( "fuse_to_sos relative error", gp_sig_name[sig], (( true == dev.finite ) && ( dev.err <= ( TEST_FUSE_TOL * dev.scale ))), ( dev.err / fmax( dev.scale, (double) FLT_MIN )), TEST_FUSE_TOL );
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Run conformance test
+*
+* @return       num_of_fails    - Number of failed checks
+*/
+////////////////////////////////////////////////////////////////////////////////
+int main(void)
+{
+    test_rc_cr();
+    test_fc_set_fast();
+
+    #if ( 1 == FILTER_CFG_ATOMIC_EN )
+        test_fc_get_atomic();
+    #endif
+
+    test_band();
+    test_fir_iir_sos();
+    test_dcb();
+    test_bool();
+    test_bool_cnt();
+    test_pipe();
+    test_fuse();
+
+    printf( "\n%u of %u checks failed\n", g_num_of_fails, g_num_of_checks );
+
+    return (int) g_num_of_fails;
+}